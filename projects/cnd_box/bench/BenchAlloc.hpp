@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Counters of the global allocation functions, read by the benchmark stages.
+///
+/// The counters only move in a binary which replaces the global operator new and operator delete with functions
+/// calling CountAlloc and CountFree, as cnd_bench does.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include <atomic>
+// clang-format on
+
+namespace cnd::bench {
+
+struct AllocCounters {
+  std::atomic<Size> count{0};  ///> Calls to operator new.
+  std::atomic<Size> bytes{0};  ///> Bytes requested from operator new.
+  std::atomic<Size> live{0};   ///> Bytes allocated and not yet freed.
+  std::atomic<Size> peak{0};   ///> Most bytes live at once, since the last PeakHeapBytes.
+};
+
+inline AllocCounters gAllocs{};
+
+inline void CountAlloc(Size n) noexcept {
+  gAllocs.count.fetch_add(1, std::memory_order_relaxed);
+  gAllocs.bytes.fetch_add(n, std::memory_order_relaxed);
+  const Size live = gAllocs.live.fetch_add(n, std::memory_order_relaxed) + n;
+  Size peak = gAllocs.peak.load(std::memory_order_relaxed);
+  while (live > peak && !gAllocs.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+inline void CountFree(Size n) noexcept { gAllocs.live.fetch_sub(n, std::memory_order_relaxed); }
+
+/// @brief Peak heap bytes allocated by one run of 'fn', above the bytes live before it.
+template <class FnT>
+Size PeakHeapBytes(FnT&& fn) {
+  const Size base = gAllocs.live.load(std::memory_order_relaxed);
+  gAllocs.peak.store(base, std::memory_order_relaxed);
+  fn();
+  return gAllocs.peak.load(std::memory_order_relaxed) - base;
+}
+
+}  // namespace cnd::bench
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
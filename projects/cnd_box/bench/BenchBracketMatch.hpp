@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Parse time of nested scopes at depths 10 to 1000, with and without the bracket match index.
+///
+/// Without the index every library body rescans the rest of the source to find its closing brace, so parse time
+/// grows with the square of the nesting depth. With it the parse is linear.
+///
+/// Usage: cnd_bench bracket_match [max depth = 1000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::bracket_match {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseProgram;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+// Libraries nested 'depth' levels deep, each holding a variable with a call expression.
+inline Str MakeNestedSource(Size depth) {
+  Str out;
+  for (Size i = 0; i < depth; i++) out += "lib@L" + std::to_string(i) + ":{def @v" + std::to_string(i) + ":f(a,[b,c]);";
+  for (Size i = 0; i < depth; i++) out += "};";
+  return out;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size max_depth = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 1000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  std::cout << "depth,tokens,scan_ms,indexed_ms,scan_ns_per_token,indexed_ns_per_token,speedup,identical\n";
+  for (Size depth : {Size{10}, Size{30}, Size{100}, Size{300}, Size{1000}}) {
+    if (depth > max_depth) break;
+    const Str src = MakeNestedSource(depth);
+    auto tokens = Lexer::LexSanitized(src);
+    if (!tokens) {
+      std::cerr << "Failed to lex benchmark source at depth " << depth << ".\n";
+      return 1;
+    }
+    std::span<const Tk> tokens_span{*tokens};
+    const TkCursorT program{tokens_span.cbegin(), tokens_span.cend()};
+
+    // ParseProgram runs without an active match index, so every scope search scans.
+    auto scanned = ParseProgram(program);
+    auto indexed = ParseSyntax(program);
+    const double scan_ms = BestOfMs(reps, [&] { scanned = ParseProgram(program); });
+    const double indexed_ms = BestOfMs(reps, [&] { indexed = ParseSyntax(program); });
+    const bool identical =
+        scanned && indexed && scanned->head.Iter() == indexed->head.Iter() && Ast::CompareAst(scanned->ast, indexed->ast);
+
+    const double count = static_cast<double>(tokens->size());
+    std::cout << depth << ',' << tokens->size() << ',' << scan_ms << ',' << indexed_ms << ','
+              << scan_ms * 1e6 / count << ',' << indexed_ms * 1e6 / count << ',' << scan_ms / indexed_ms << ','
+              << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::bracket_match
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
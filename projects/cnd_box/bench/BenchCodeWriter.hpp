@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Emit time and peak heap of a large generated C file, built by string concatenation against a CodeWriter.
+///
+/// 'concat' builds every declaration as a returned string and appends it to the file text, as the code generators
+/// did before they wrote into a CodeWriter. 'writer' emits the same declarations into a CodeWriter buffering the
+/// whole file, and 'sink' into a CodeWriter which writes straight to the output file. Peak heap counts the bytes
+/// live at once through the global allocation functions while emitting, excluding the code model itself.
+///
+/// Usage: cnd_bench code_writer [classes = 20000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "codegen/CLangCodegen.hpp"
+#include "BenchAlloc.hpp"
+#include "BenchCorpus.hpp"
+#include <filesystem>
+#include <fstream>
+// clang-format on
+
+namespace cnd::bench::code_writer {
+using namespace cnd;
+using namespace cnd::clang::codegen;
+using cnd::bench::BestOfMs;
+using cnd::bench::PeakHeapBytes;
+
+inline Vec<ClassDecl> MakeClasses(Size classes) {
+  Vec<ClassDecl> out{};
+  out.reserve(classes);
+  for (Size i = 0; i < classes; i++) {
+    const Str id = std::to_string(i);
+    ClassDecl& cls = out.emplace_back(ClassDecl{.name = "Generated" + id, .base_class = "Base"});
+    for (int m = 0; m < 6; m++) cls.member_variables.push_back("int member_" + std::to_string(m) + "_" + id);
+    for (int m = 0; m < 4; m++) {
+      cls.methods.push_back(MethodDecl{.name = "Method" + std::to_string(m),
+                                       .return_type = "int",
+                                       .params = {{"int", "lhs"}, {"int", "rhs", "0"}},
+                                       .definition = "return lhs * " + std::to_string(m) + " + rhs - member_0_" + id +
+                                                     ";"});
+    }
+  }
+  return out;
+}
+
+// The string returning form of the method and class generators.
+inline Str ConcatMethod(const MethodDecl& method) {
+  Str params{};
+  for (Size i = 0; i < method.params.size(); i++) {
+    const MethodParameter& param = method.params[i];
+    params = params + (i == 0 ? "" : ", ") + param.type + " " + param.name +
+             (param.default_value ? " = " + *param.default_value : "");
+  }
+  return method.return_type + " " + method.name + "(" + params + ")" + "{" + method.definition.value_or("") + "}" +
+         "\n\n";
+}
+
+inline Str ConcatClass(const ClassDecl& cls) {
+  Str result = "class " + cls.name + " : public " + cls.base_class.value_or("") + " {\npublic:\n";
+  for (const auto& member : cls.member_variables) result += "    " + member + ";\n";
+  for (const auto& method : cls.methods) {
+    // Indent every line of the method, as the writer does.
+    Str method_text = ConcatMethod(method);
+    Str indented{};
+    for (Size beg = 0; beg < method_text.size();) {
+      const Size eol = method_text.find('\n', beg) + 1;
+      if (eol - beg > 1) indented += "    ";
+      indented += method_text.substr(beg, eol - beg);
+      beg = eol;
+    }
+    result += indented;
+  }
+  return result + "};\n";
+}
+
+inline void WriteFile(const std::filesystem::path& path, StrView text) {
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+inline Str ReadFile(const std::filesystem::path& path) {
+  std::ifstream file{path, std::ios::binary};
+  return Str{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size classes = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 20000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const auto path = std::filesystem::temp_directory_path() / "BenchCodeWriter.c";
+  const Vec<ClassDecl> model = MakeClasses(classes);
+
+  auto emit_concat = [&] {
+    Str file{};
+    for (const auto& cls : model) file += ConcatClass(cls);
+    WriteFile(path, file);
+  };
+  auto emit_writer = [&] {
+    CodeWriter out{};
+    for (const auto& cls : model) cls.Codegen(out);
+    WriteFile(path, out.ToString());
+  };
+  auto emit_sink = [&] {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    CodeWriter out{file};
+    for (const auto& cls : model) cls.Codegen(out);
+  };
+
+  std::cout << "emitter,classes,file_bytes,emit_ms,peak_heap_bytes\n";
+  Str expected{};
+  const std::pair<StrView, std::function<void()>> emitters[] = {
+      {"concat", emit_concat}, {"writer", emit_writer}, {"sink", emit_sink}};
+  for (const auto& [name, emit] : emitters) {
+    const Size peak = PeakHeapBytes(emit);
+    const double emit_ms = BestOfMs(reps, emit);
+    const Str text = ReadFile(path);
+    std::cout << name << ',' << classes << ',' << text.size() << ',' << emit_ms << ',' << peak << '\n';
+    if (expected.empty()) expected = text;
+    if (text != expected) {
+      std::cerr << name << " output differs from concat.\n";
+      return 1;
+    }
+  }
+  std::filesystem::remove(path);
+  return 0;
+}
+
+}  // namespace cnd::bench::code_writer
+
+/// @} // end of cnd_benchmark
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
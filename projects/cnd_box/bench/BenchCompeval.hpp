@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Compile time evaluation with the Ast walker and with the lowered bytecode on the register virtual machine.
+///
+/// The first table evaluates the same expression repeatedly, the way a loop body would be. The walker re-dispatches
+/// on every node of every evaluation; the virtual machine lowers the expression once and runs the chunk. The second
+/// table runs call and loop heavy programs, which only the virtual machine can evaluate.
+///
+/// Usage: cnd_bench compeval [evaluations = 10000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "hir/Compeval.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::compeval {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::hir::AV;
+using cnd::hir::HirChunk;
+using cnd::hir::HirLowering;
+using cnd::hir::TrUnit;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParsePrimaryExpr;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+// An expression of 'terms' operands over the global 'x', cycling through the arithmetic and bitwise operators.
+inline Str MakeExprSource(Size terms) {
+  static constexpr std::string_view kOps[] = {"+", "*", "-", "^", "|", "&", "+", "%"};
+  Str out = "x";
+  for (Size i = 1; i < terms; i++) {
+    out += kOps[i % std::size(kOps)];
+    out += (i % 3 == 0) ? "x" : std::to_string(i % 5 + 1);
+  }
+  return out;
+}
+
+// Parses 'src' as a source file named 'name' and evaluates it in 'unit'. Tokens must outlive the unit's trees.
+inline bool EvalSourceInto(TrUnit& unit, StrView name, const Vec<Tk>& tokens) {
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return false;
+  unit.trees[name] = parsed.Extract().ast;
+  return unit.EvalSourceFile(name).has_value();
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size evaluations = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 10000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  const Vec<Tk> decl_tokens = Lexer::LexSanitized("def @x:7;").value_or(Vec<Tk>{});
+  if (!EvalSourceInto(unit, "decl", decl_tokens)) {
+    std::cerr << "Failed to evaluate benchmark declarations.\n";
+    return 1;
+  }
+
+  std::cout << "terms,evaluations,walker_ms,vm_ms,speedup,identical\n";
+  for (Size terms : {Size{4}, Size{16}, Size{64}}) {
+    auto tokens = Lexer::LexSanitized(MakeExprSource(terms));
+    if (!tokens) return 1;
+    std::span<const Tk> tokens_span{*tokens};
+    auto parsed = ParsePrimaryExpr(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+    if (!parsed) return 1;
+    HirChunk chunk{.name = "bench"};
+    if (!HirLowering{unit.program, chunk}.LowerExpression(parsed->ast)) return 1;
+
+    ClRes<AV> walked = unit.EvalPrimaryExpr(parsed->ast, unit.global);
+    ClRes<AV> executed = unit.vm.Run(unit.program, chunk);
+    const double walker_ms = BestOfMs(reps, [&] {
+      for (Size i = 0; i < evaluations; i++) walked = unit.EvalPrimaryExpr(parsed->ast, unit.global);
+    });
+    const double vm_ms = BestOfMs(reps, [&] {
+      for (Size i = 0; i < evaluations; i++) executed = unit.vm.Run(unit.program, chunk);
+    });
+    const bool identical = walked && executed && walked->TypeIndex() == executed->TypeIndex() &&
+                           AV::CppRef<hir::Bool>(AV::Eq(*walked, *executed)).data;
+
+    std::cout << terms << ',' << evaluations << ',' << walker_ms << ',' << vm_ms << ',' << walker_ms / vm_ms << ','
+              << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+
+  static constexpr std::pair<std::string_view, std::string_view> kPrograms[] = {
+      {"recursive_fib_20",
+       "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+       "return fib(20);"},
+      {"loop_sum_100000",
+       "fn@sum(const int @n)>const int:{ def int @s:0; for (def int @i:0; i < n; i++) { s = s + i % 7; } return s; };"
+       "return sum(100000);"},
+  };
+  std::cout << "\nprogram,vm_ms,return_value\n";
+  for (const auto& [name, src] : kPrograms) {
+    const Vec<Tk> tokens = Lexer::LexSanitized(src).value_or(Vec<Tk>{});
+    bool evaluated = false;
+    const double vm_ms = BestOfMs(reps, [&] {
+      TrUnit program_unit{input, output};
+      program_unit.vm.memo_budget = 0;  // Measures execution, see the hir_memo stage for memoized calls.
+      evaluated = EvalSourceInto(program_unit, name, tokens);
+    });
+    if (!evaluated) {
+      std::cerr << "Failed to evaluate benchmark program " << name << ".\n";
+      return 1;
+    }
+    std::cout << name << ',' << vm_ms << ',' << output.return_value << '\n';
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::compeval
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Deterministic generators of synthetic C& programs, and the timing and token helpers shared by the benchmarks.
+///
+/// The same shape, size and seed always produce the same bytes on every platform: only std::mt19937 output is used,
+/// never a std distribution, whose results are implementation defined. Every shape is valid C& which parses, and
+/// whose top level statements the compile time evaluator can run.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/tk.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+// clang-format on
+
+namespace cnd::bench {
+
+enum class eCorpusShape {
+  kDeepNesting,      ///> Libraries nested 'nesting' levels deep, each holding a variable.
+  kLongExpressions,  ///> Variables initialized by long arithmetic expressions over literals and a constant.
+  kManyFunctions,    ///> Many small function definitions with parameters and a return constraint.
+  kLargeStrings,     ///> Variables initialized by long string literals.
+  kCommentHeavy,     ///> Short variables buried in line and block comments.
+  COUNT
+};
+
+constexpr const char* eCorpusShapeToCStr(eCorpusShape shape) noexcept {
+  switch (shape) {
+    case eCorpusShape::kDeepNesting:
+      return "deep_nesting";
+    case eCorpusShape::kLongExpressions:
+      return "long_expressions";
+    case eCorpusShape::kManyFunctions:
+      return "many_functions";
+    case eCorpusShape::kLargeStrings:
+      return "large_strings";
+    case eCorpusShape::kCommentHeavy:
+      return "comment_heavy";
+    default:
+      return "unknown";
+  }
+}
+
+struct CorpusConfig {
+  eCorpusShape shape{eCorpusShape::kLongExpressions};
+  Size bytes{1024 * 1024};  ///> Minimum size of the generated source.
+  Size nesting{64};         ///> Library depth of each nested group, for kDeepNesting.
+  Size expr_terms{256};     ///> Operands per expression, for kLongExpressions.
+  Size string_bytes{2048};  ///> Characters per string literal, for kLargeStrings.
+  UI32 seed{42};
+};
+
+namespace detail {
+// Uniform enough for corpus shaping, and identical on every standard library.
+inline Size Pick(std::mt19937& rng, Size n) { return static_cast<Size>(rng() % n); }
+
+inline void AppendWords(Str& out, std::mt19937& rng, Size words) {
+  static constexpr const char* kWords[] = {"the", "lexer", "skips", "every", "comment", "so", "this", "text",
+                                           "only", "costs", "scanning", "time", "and", "nothing", "else"};
+  for (Size i = 0; i < words; i++) {
+    out += kWords[Pick(rng, std::size(kWords))];
+    out += ' ';
+  }
+}
+
+inline void AppendDeepNesting(Str& out, std::mt19937& rng, const CorpusConfig& cfg, Size group) {
+  const Str tag = std::to_string(group);
+  for (Size d = 0; d < cfg.nesting; d++)
+    out += "lib@L" + tag + "_" + std::to_string(d) + ":{def @v" + std::to_string(d) + ":" +
+           std::to_string(Pick(rng, 1000)) + "+f(a,[b,c]);";
+  for (Size d = 0; d < cfg.nesting; d++) out += "};";
+  out += '\n';
+}
+
+inline void AppendLongExpression(Str& out, std::mt19937& rng, const CorpusConfig& cfg, Size group) {
+  // Terms are single digits, digit products or sums with the constant, joined by + and -. Every intermediate value
+  // stays well inside a 32 bit int.
+  out += "def @e" + std::to_string(group) + ":k";
+  for (Size t = 1; t < cfg.expr_terms; t++) {
+    out += Pick(rng, 2) == 0 ? "+" : "-";
+    const Size kind = Pick(rng, 8);
+    if (kind == 0) {
+      out += "(" + std::to_string(Pick(rng, 10)) + "+k)";
+    } else if (kind < 3) {
+      out += std::to_string(Pick(rng, 10));  // Separate statements fix the order of the two draws.
+      out += "*" + std::to_string(Pick(rng, 10));
+    } else {
+      out += std::to_string(Pick(rng, 10));
+    }
+  }
+  out += ";\n";
+}
+
+inline void AppendFunction(Str& out, std::mt19937& rng, const CorpusConfig&, Size group) {
+  out += "fn@f" + std::to_string(group) + "(const int @a,const int @b)>const int:{a+b*" +
+         std::to_string(Pick(rng, 100)) + ";};\n";
+}
+
+inline void AppendLargeString(Str& out, std::mt19937& rng, const CorpusConfig& cfg, Size group) {
+  out += "def @s" + std::to_string(group) + ":\"";
+  for (Size c = 0; c < cfg.string_bytes; c++) out += static_cast<char>('a' + Pick(rng, 26));
+  out += "\";\n";
+}
+
+inline void AppendCommentHeavy(Str& out, std::mt19937& rng, const CorpusConfig&, Size group) {
+  out += "` ";
+  AppendWords(out, rng, 12);
+  out += "\n/` ";
+  for (Size line = 0; line < 4; line++) {
+    AppendWords(out, rng, 10);
+    out += "\n   ";
+  }
+  out += "`/\ndef @c" + std::to_string(group) + ":" + std::to_string(Pick(rng, 1000)) + "; ` ";
+  AppendWords(out, rng, 6);
+  out += '\n';
+}
+}  // namespace detail
+
+/// @brief Generate a program of the configured shape, at least 'cfg.bytes' long.
+inline Str MakeCorpus(const CorpusConfig& cfg) {
+  std::mt19937 rng{cfg.seed};
+  Str out;
+  out.reserve(cfg.bytes + 4096);
+  if (cfg.shape == eCorpusShape::kLongExpressions) out += "def @k:7;\n";
+  for (Size group = 0; out.size() < cfg.bytes; group++) {
+    switch (cfg.shape) {
+      case eCorpusShape::kDeepNesting:
+        detail::AppendDeepNesting(out, rng, cfg, group);
+        break;
+      case eCorpusShape::kLongExpressions:
+        detail::AppendLongExpression(out, rng, cfg, group);
+        break;
+      case eCorpusShape::kManyFunctions:
+        detail::AppendFunction(out, rng, cfg, group);
+        break;
+      case eCorpusShape::kLargeStrings:
+        detail::AppendLargeString(out, rng, cfg, group);
+        break;
+      case eCorpusShape::kCommentHeavy:
+        detail::AppendCommentHeavy(out, rng, cfg, group);
+        break;
+      default:
+        return out;
+    }
+  }
+  return out;
+}
+
+/// @brief At least 'size' bytes of 'fragments' picked in a random order seeded by 'seed'.
+template <std::size_t N>
+Str MakeFragmentCorpus(const char* const (&fragments)[N], UI32 seed, Size size) {
+  std::mt19937 rng{seed};
+  Str out;
+  out.reserve(size + 128);
+  while (out.size() < size) out += fragments[rng() % N];
+  return out;
+}
+
+/// @brief 'copies' concatenations of 'copy_src', each '$' replaced by the index of the copy.
+inline Str MakeIndexedCopies(StrView copy_src, int copies) {
+  Str out{};
+  for (int c = 0; c < copies; c++) {
+    for (char ch : copy_src) {
+      if (ch == '$')
+        out += std::to_string(c);
+      else
+        out += ch;
+    }
+  }
+  return out;
+}
+
+/// @brief Shortest wall time of 'reps' calls to 'fn', in milliseconds.
+template <class FnT>
+double BestOfMs(int reps, FnT&& fn) {
+  double best_ms = std::numeric_limits<double>::max();
+  for (int r = 0; r < reps; r++) {
+    auto beg = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    best_ms = std::min(best_ms, std::chrono::duration<double, std::milli>(end - beg).count());
+  }
+  return best_ms;
+}
+
+/// @brief True if the token streams are equal down to the locations and the source chars each literal views.
+inline bool IsTkStreamIdentical(const Vec<Tk>& a, const Vec<Tk>& b) {
+  if (a.size() != b.size()) return false;
+  for (Size i = 0; i < a.size(); i++)
+    if (a[i].type_ != b[i].type_ || a[i].beg_line_ != b[i].beg_line_ || a[i].end_line_ != b[i].end_line_ ||
+        a[i].beg_col_ != b[i].beg_col_ || a[i].end_col_ != b[i].end_col_ ||
+        a[i].literal_.data() != b[i].literal_.data() || a[i].literal_.size() != b[i].literal_.size())
+      return false;
+  return true;
+}
+
+}  // namespace cnd::bench
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
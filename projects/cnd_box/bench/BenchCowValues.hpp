@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Cost of passing large arrays by value through compile time function calls.
+///
+/// Every call copies its argument into the parameter, then releases it on return. 'eager' clones the elements on
+/// each copy, the way values were copied before copy on write. 'cow' shares the elements until the callee mutates
+/// them. The 'read' callee only indexes its parameter, the 'write' callee stores into it and pays for one clone.
+///
+/// Usage: cnd_bench cow_values [calls = 1000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "hir/AnyValue.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::cow_values {
+using namespace cnd;
+using namespace cnd::hir;
+using cnd::bench::BestOfMs;
+
+inline AV MakeArray(Size elements) {
+  Array::DataT data{};
+  data.reserve(elements);
+  for (Size i = 0; i < elements; i++) data.push_back(AV::Make<I32>(static_cast<I32::DataT>(i)));
+  return AV::Make<Array>(std::move(data));
+}
+
+inline AV EagerCopy(const AV& value) { return AV::Make<Array>(CowClone(AV::CppRef<Array>(value))); }
+
+// Body of the called function: reads the first and last elements, and stores into the first one if 'write'.
+inline I32::DataT Callee(AV& param, I32::DataT call, bool write) {
+  if (write) AV::CppRef<Array>(param).data.front() = AV::Make<I32>(call);
+  const auto& data = AV::CppRef<Array>(std::as_const(param)).data;
+  return AV::CppRef<I32>(data.front()).data + AV::CppRef<I32>(data.back()).data;
+}
+
+template <class CopyFnT>
+I64::DataT PassThroughCalls(const AV& arg, Size calls, bool write, CopyFnT&& copy) {
+  I64::DataT checksum = 0;
+  for (Size i = 0; i < calls; i++) {
+    AV param = copy(arg);
+    checksum += Callee(param, static_cast<I32::DataT>(i), write);
+    AV::Release(param);
+  }
+  return checksum;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size calls = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 1000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  RefArena arena{};
+  RefArenaScope scope{arena};
+  std::cout << "elements,callee,calls,eager_ms,cow_ms,speedup,identical\n";
+  for (Size elements : {Size{100}, Size{10000}, Size{100000}}) {
+    AV arg = MakeArray(elements);
+    for (bool write : {false, true}) {
+      I64::DataT eager_sum = 0;
+      I64::DataT cow_sum = 0;
+      const double eager_ms = BestOfMs(reps, [&] { eager_sum = PassThroughCalls(arg, calls, write, EagerCopy); });
+      const double cow_ms = BestOfMs(reps, [&] {
+        cow_sum = PassThroughCalls(arg, calls, write, [](const AV& value) { return AV::Copy(value); });
+      });
+      // The argument is never observed through the mutated parameters.
+      const AV& first = AV::CppRef<Array>(std::as_const(arg)).data.front();
+      const bool identical = eager_sum == cow_sum && AV::CppRef<I32>(first).data == 0;
+
+      std::cout << elements << ',' << (write ? "write" : "read") << ',' << calls << ',' << eager_ms << ',' << cow_ms
+                << ',' << eager_ms / cow_ms << ',' << (identical ? "true" : "false") << '\n';
+      if (!identical) return 1;
+    }
+    AV::Release(arg);
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::cow_values
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Parse time of long mixed-operator expressions with the recursive descent and the Pratt expression parsers.
+///
+/// The recursive descent parser descends through every precedence level for every operand, and rescans each operator
+/// run once per level. The Pratt parser reads each operand and operator once.
+///
+/// Usage: cnd_bench expr_parse [max terms = 10000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::expr_parse {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParsePrimaryExpr;
+using cnd::trtools::parser::TkCursorT;
+namespace detail = cnd::trtools::parser::detail;
+
+// A single expression of 'terms' operands joined by operators cycling through every binary precedence level.
+inline Str MakeExprSource(Size terms) {
+  static constexpr std::string_view kOps[] = {"||", "&&", "|", "^", "&", "==", "<", "<=>", "<<", "+", "*", "-", "/"};
+  Str out = "a0";
+  for (Size i = 1; i < terms; i++) {
+    out += kOps[i % std::size(kOps)];
+    out += (i % 7 == 0) ? "f(b" + std::to_string(i) + ")" : "a" + std::to_string(i);
+  }
+  return out;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size max_terms = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 10000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  std::cout << "terms,tokens,recursive_ms,pratt_ms,recursive_ns_per_token,pratt_ns_per_token,speedup,identical\n";
+  for (Size terms : {Size{10}, Size{100}, Size{1000}, Size{10000}}) {
+    if (terms > max_terms) break;
+    const Str src = MakeExprSource(terms);
+    auto tokens = Lexer::LexSanitized(src);
+    if (!tokens) {
+      std::cerr << "Failed to lex benchmark source with " << terms << " terms.\n";
+      return 1;
+    }
+    std::span<const Tk> tokens_span{*tokens};
+    const TkCursorT expr{tokens_span.cbegin(), tokens_span.cend()};
+
+    auto parse_with = [&expr](detail::eExprParser parser) {
+      detail::ExprParserScope selected{parser};
+      return ParsePrimaryExpr(expr);
+    };
+    auto recursive = parse_with(detail::eExprParser::kRecursiveDescent);
+    auto pratt = parse_with(detail::eExprParser::kPratt);
+    const double recursive_ms =
+        BestOfMs(reps, [&] { recursive = parse_with(detail::eExprParser::kRecursiveDescent); });
+    const double pratt_ms = BestOfMs(reps, [&] { pratt = parse_with(detail::eExprParser::kPratt); });
+    const bool identical =
+        recursive && pratt && recursive->head.Iter() == pratt->head.Iter() && Ast::CompareAst(recursive->ast, pratt->ast);
+
+    const double count = static_cast<double>(tokens->size());
+    std::cout << terms << ',' << tokens->size() << ',' << recursive_ms << ',' << pratt_ms << ','
+              << recursive_ms * 1e6 / count << ',' << pratt_ms * 1e6 / count << ',' << recursive_ms / pratt_ms << ','
+              << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::expr_parse
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
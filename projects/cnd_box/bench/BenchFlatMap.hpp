@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Insert, lookup and iteration cost of FlatMap against std::unordered_map.
+///
+/// 'map' has the shape of a C& map value, string keys to AnyValues. 'namespace' has the shape of a namespace table,
+/// interned symbols to variable slots. Lookups alternate between present and missing keys.
+///
+/// Usage: cnd_bench flat_map [elements = 100000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/SymbolTable.hpp"
+#include "hir/AnyValue.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::flat_map {
+using namespace cnd;
+using namespace cnd::hir;
+using cnd::bench::BestOfMs;
+
+struct Timings {
+  double insert_ms;
+  double lookup_ms;
+  double iterate_ms;
+  UI64 checksum;
+};
+
+// 'keys' are inserted with 'make_value', then looked up along with 'missing', then iterated through 'weigh'.
+template <class MapT, class KeyT, class MakeValueFnT, class WeighFnT>
+Timings Measure(int reps, const Vec<KeyT>& keys, const Vec<KeyT>& missing, MakeValueFnT&& make_value,
+                WeighFnT&& weigh) {
+  Timings out{};
+  MapT map{};
+  out.insert_ms = BestOfMs(reps, [&] {
+    map = MapT{};
+    for (Size i = 0; i < keys.size(); i++) map.try_emplace(keys[i], make_value(i));
+  });
+  UI64 found = 0;
+  out.lookup_ms = BestOfMs(reps, [&] {
+    found = 0;
+    for (Size i = 0; i < keys.size(); i++) {
+      found += map.find(keys[i]) != map.end();
+      found += map.find(missing[i]) != map.end();
+    }
+  });
+  UI64 weight = 0;
+  out.iterate_ms = BestOfMs(reps, [&] {
+    weight = 0;
+    for (const auto& [key, value] : map) weight += weigh(value);
+  });
+  out.checksum = found * 31 + weight;
+  return out;
+}
+
+inline void PrintRow(StrView shape, StrView op, Size elements, double std_ms, double flat_ms) {
+  std::cout << shape << ',' << op << ',' << elements << ',' << std_ms << ',' << flat_ms << ',' << std_ms / flat_ms
+            << '\n';
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size elements = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 100000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  Vec<Str> names{};
+  Vec<Str> missing_names{};
+  Vec<SymbolId> symbols{};
+  Vec<SymbolId> missing_symbols{};
+  for (Size i = 0; i < elements; i++) {
+    names.push_back("key_" + std::to_string(i * 7919));
+    missing_names.push_back("absent_" + std::to_string(i));
+    symbols.push_back(Symbols().Intern(names.back()));
+    missing_symbols.push_back(Symbols().Intern(missing_names.back()));
+  }
+
+  RefArena arena{};
+  RefArenaScope scope{arena};
+  auto make_av = [](Size i) { return AV::Make<I32>(static_cast<I32::DataT>(i)); };
+  auto weigh_av = [](const AV& value) { return static_cast<UI64>(AV::CppRef<I32>(value).data); };
+  auto make_slot = [](Size i) { return static_cast<UI32>(i); };
+  auto weigh_slot = [](UI32 slot) { return static_cast<UI64>(slot); };
+
+  const Timings std_map = Measure<std::unordered_map<Str, AV>>(reps, names, missing_names, make_av, weigh_av);
+  const Timings flat_map = Measure<Map::DataT>(reps, names, missing_names, make_av, weigh_av);
+  const Timings std_ns =
+      Measure<std::unordered_map<SymbolId, UI32>>(reps, symbols, missing_symbols, make_slot, weigh_slot);
+  const Timings flat_ns = Measure<FlatMap<SymbolId, UI32>>(reps, symbols, missing_symbols, make_slot, weigh_slot);
+
+  std::cout << "shape,op,elements,unordered_map_ms,flat_map_ms,speedup\n";
+  PrintRow("map", "insert", elements, std_map.insert_ms, flat_map.insert_ms);
+  PrintRow("map", "lookup", elements, std_map.lookup_ms, flat_map.lookup_ms);
+  PrintRow("map", "iterate", elements, std_map.iterate_ms, flat_map.iterate_ms);
+  PrintRow("namespace", "insert", elements, std_ns.insert_ms, flat_ns.insert_ms);
+  PrintRow("namespace", "lookup", elements, std_ns.lookup_ms, flat_ns.lookup_ms);
+  PrintRow("namespace", "iterate", elements, std_ns.iterate_ms, flat_ns.iterate_ms);
+  if (std_map.checksum != flat_map.checksum || std_ns.checksum != flat_ns.checksum) {
+    std::cerr << "FlatMap and std::unordered_map disagree.\n";
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::flat_map
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Front end stage benchmarks over generated corpora: Lexer::Lex, Lexer::Sanitize, parser::ParseSyntax and
+/// hir::TrUnit::Evaluate, each timed on its own.
+///
+/// Prints one CSV row per shape and stage to stdout:
+///   - mb_per_s is source bytes over the best time, so stages of one shape compare directly.
+///   - allocations and allocated_bytes count global operator new calls made during one untimed run of the stage.
+///   - peak_rss_kib is the process high water mark after the stage. It never decreases down the table.
+/// Evaluate runs a whole translation unit from a file: load, lex, parse and compile time evaluation.
+///
+/// Usage: cnd_bench front_end [source size in KiB = 1024] [repetitions = 5] [shape = all] [seed = 42]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "hir/Compeval.hpp"
+#include "BenchAlloc.hpp"
+#include "BenchCorpus.hpp"
+#include <fstream>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+// clang-format on
+
+namespace cnd::bench::front_end {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::bench::CorpusConfig;
+using cnd::bench::eCorpusShape;
+using cnd::bench::eCorpusShapeToCStr;
+using cnd::bench::gAllocs;
+using cnd::bench::MakeCorpus;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+struct StageResult {
+  bool ok{false};
+  Size tokens{0};
+  double best_ms{0};
+  Size allocations{0};
+  Size allocated_bytes{0};
+};
+
+inline Size PeakRssKib() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+  return static_cast<Size>(counters.PeakWorkingSetSize / 1024);
+#else
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+  return static_cast<Size>(usage.ru_maxrss / 1024);  // Bytes on macOS.
+#else
+  return static_cast<Size>(usage.ru_maxrss);  // KiB on Linux and the BSDs.
+#endif
+#endif
+}
+
+// Runs 'fn' once while counting allocations, then 'reps' more times for timing. 'fn' returns false on failure.
+template <class FnT>
+StageResult RunStage(int reps, Size tokens, FnT&& fn) {
+  StageResult res{.tokens = tokens};
+  const Size count_before = gAllocs.count.load(std::memory_order_relaxed);
+  const Size bytes_before = gAllocs.bytes.load(std::memory_order_relaxed);
+  res.ok = fn();
+  res.allocations = gAllocs.count.load(std::memory_order_relaxed) - count_before;
+  res.allocated_bytes = gAllocs.bytes.load(std::memory_order_relaxed) - bytes_before;
+  if (res.ok) res.best_ms = BestOfMs(reps, fn);
+  return res;
+}
+
+inline void PrintRow(eCorpusShape shape, Size src_bytes, const char* stage, const StageResult& res) {
+  const double mbytes = static_cast<double>(src_bytes) / (1024.0 * 1024.0);
+  std::cout << eCorpusShapeToCStr(shape) << ',' << src_bytes << ',' << stage << ',' << (res.ok ? "ok" : "fail") << ','
+            << res.tokens << ',' << res.best_ms << ',' << (res.ok ? mbytes * 1000.0 / res.best_ms : 0.0) << ','
+            << res.allocations << ',' << res.allocated_bytes << ',' << PeakRssKib() << '\n';
+}
+
+// Returns false if any stage failed.
+inline bool BenchShape(const CorpusConfig& cfg, int reps, const Path& work_dir) {
+  const Str src = MakeCorpus(cfg);
+
+  // Lex.
+  Lexer::LexerOutputT lexed{};
+  StageResult lex_res = RunStage(reps, 0, [&] {
+    lexed = Lexer::Lex(src);
+    return lexed.has_value();
+  });
+  if (lexed) lex_res.tokens = lexed->size();
+  PrintRow(cfg.shape, src.size(), "lex", lex_res);
+  if (!lex_res.ok) return false;
+
+  // Sanitize.
+  Vec<Tk> sanitized{};
+  StageResult sanitize_res = RunStage(reps, lexed->size(), [&] {
+    sanitized = Lexer::Sanitize(*lexed);
+    return true;
+  });
+  PrintRow(cfg.shape, src.size(), "sanitize", sanitize_res);
+
+  // Parse.
+  std::span<const Tk> tokens_span{sanitized};
+  StageResult parse_res = RunStage(reps, sanitized.size(), [&] {
+    return ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()}).has_value();
+  });
+  PrintRow(cfg.shape, src.size(), "parse", parse_res);
+
+  // Evaluate, from a file, as the compiler would.
+  const Path src_path = work_dir / (Str{eCorpusShapeToCStr(cfg.shape)} + ".cnd");
+  {
+    std::ofstream out{src_path, std::ios::binary | std::ios::trunc};
+    out << src;
+  }
+  TrInput input{};
+  input.src_files = {src_path};
+  StageResult eval_res = RunStage(reps, sanitized.size(), [&] {
+    TrOutput output{};
+    hir::TrUnit unit{input, output};
+    return unit.Evaluate().has_value();
+  });
+  PrintRow(cfg.shape, src.size(), "evaluate", eval_res);
+
+  return sanitize_res.ok && parse_res.ok && eval_res.ok;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size kib = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 1024;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Str shape_arg = argc > 3 ? argv[3] : "all";
+  const UI32 seed = argc > 4 ? static_cast<UI32>(std::stoul(argv[4])) : 42;
+
+  std::error_code ec;
+  const Path work_dir = stdfs::temp_directory_path(ec) / "cnd_bench";
+  stdfs::create_directories(work_dir, ec);
+  if (ec) {
+    std::cerr << "Failed to create benchmark work directory " << work_dir << ".\n";
+    return 1;
+  }
+
+  std::cout << "shape,source_bytes,stage,status,tokens,best_ms,mb_per_s,allocations,allocated_bytes,peak_rss_kib\n";
+  bool ok = true;
+  bool matched = false;
+  for (int i = 0; i < static_cast<int>(eCorpusShape::COUNT); i++) {
+    const auto shape = static_cast<eCorpusShape>(i);
+    if (shape_arg != "all" && shape_arg != eCorpusShapeToCStr(shape)) continue;
+    matched = true;
+    ok = BenchShape(CorpusConfig{.shape = shape, .bytes = kib * 1024, .seed = seed}, reps, work_dir) && ok;
+  }
+  if (!matched) {
+    std::cerr << "Unknown corpus shape '" << shape_arg << "'.\n";
+    return 1;
+  }
+  return ok ? 0 : 1;
+}
+
+}  // namespace cnd::bench::front_end
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
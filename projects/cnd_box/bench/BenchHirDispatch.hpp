@@ -0,0 +1,124 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Per op cost of the switch and threaded dispatch loops of the compile time virtual machine.
+///
+/// Each workload is a hand written loop chunk. 'moves' is dominated by register moves and measures dispatch itself,
+/// 'arith' mixes in AnyValue arithmetic. When threaded dispatch is not compiled in, both columns use the switch loop.
+///
+/// Usage: cnd_bench hir_dispatch [iterations = 1000000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "hir/HirOp.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::hir_dispatch {
+using namespace cnd;
+using namespace cnd::hir;
+using cnd::bench::BestOfMs;
+
+// Registers: r0 iteration count, r1 counter, r2 accumulator, r3 one, r4 loop condition, r5.. workload scratch.
+// The body is emitted by 'body', followed by the counter increment and the bottom tested branch.
+template <class BodyFnT>
+HirChunk MakeLoopChunk(StrView name, BodyFnT&& body) {
+  HirChunk chunk{.name = name, .param_count = 1, .register_count = 8};
+  chunk.EmitBx(eHirOp::kLoadConst, 1, chunk.AddConstant(AV::Make<I32>(0)));
+  chunk.EmitBx(eHirOp::kLoadConst, 2, chunk.AddConstant(AV::Make<I32>(0)));
+  chunk.EmitBx(eHirOp::kLoadConst, 3, chunk.AddConstant(AV::Make<I32>(1)));
+  chunk.EmitBx(eHirOp::kLoadConst, 5, chunk.AddConstant(AV::Make<I32>(0xFFFF)));
+  const UI32 loop = chunk.Label();
+  body(chunk);
+  chunk.Emit(eHirOp::kAdd, 1, 1, 3);
+  chunk.Emit(eHirOp::kLt, 4, 1, 0);
+  chunk.EmitBx(eHirOp::kJumpIfTrue, 4, loop);
+  chunk.Emit(eHirOp::kReturn, 2);
+  return chunk;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const I32::DataT iterations = argc > 1 ? std::stoi(argv[1]) : 1000000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  const HirChunk workloads[] = {
+      MakeLoopChunk("moves",
+                    [](HirChunk& c) {
+                      for (int i = 0; i < 3; i++) {
+                        c.Emit(eHirOp::kMove, 6, 2);
+                        c.Emit(eHirOp::kMove, 7, 6);
+                        c.Emit(eHirOp::kMove, 6, 7);
+                        c.Emit(eHirOp::kMove, 2, 6);
+                      }
+                    }),
+      MakeLoopChunk("arith",
+                    [](HirChunk& c) {
+                      c.Emit(eHirOp::kAdd, 2, 2, 1);
+                      c.Emit(eHirOp::kXor, 2, 2, 1);
+                      c.Emit(eHirOp::kAnd, 2, 2, 5);
+                    }),
+  };
+
+  const HirProgram program{};
+  const AV args[] = {AV::Make<I32>(iterations)};
+  std::cout << "workload,dispatch_compiled,ops,switch_ms,threaded_ms,switch_ns_per_op,threaded_ns_per_op,speedup,"
+               "identical\n";
+  for (const HirChunk& chunk : workloads) {
+    auto run_with = [&](eHirDispatch dispatch) {
+      Context vm{};
+      vm.dispatch = dispatch;
+      return vm.Run(program, chunk, args);
+    };
+    auto switched = run_with(eHirDispatch::kSwitch);
+    auto threaded = run_with(eHirDispatch::kThreaded);
+    const double switch_ms = BestOfMs(reps, [&] { switched = run_with(eHirDispatch::kSwitch); });
+    const double threaded_ms = BestOfMs(reps, [&] { threaded = run_with(eHirDispatch::kThreaded); });
+    const bool identical = switched && threaded && AV::Is<I32>(*switched) && AV::Is<I32>(*threaded) &&
+                           AV::CppRef<I32>(*switched).data == AV::CppRef<I32>(*threaded).data;
+
+    // The four setup ops and the return are not counted.
+    const double ops = static_cast<double>(chunk.code.size() - 5) * static_cast<double>(iterations);
+    std::cout << chunk.name << ',' << (CND_HIR_THREADED_DISPATCH ? "threaded" : "switch") << ','
+              << static_cast<UI64>(ops) << ',' << switch_ms << ',' << threaded_ms << ',' << switch_ms * 1e6 / ops
+              << ',' << threaded_ms * 1e6 / ops << ',' << switch_ms / threaded_ms << ','
+              << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::hir_dispatch
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
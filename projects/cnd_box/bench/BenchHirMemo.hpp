@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Compile time evaluation of recursive programs with and without memoized pure calls.
+///
+/// 'fib' and 'binomial' recurse into overlapping calls, which memoization collapses to one evaluation per distinct
+/// argument list. 'counted_fib' writes a global on every call, so it is impure and both columns evaluate every call.
+///
+/// Usage: cnd_bench hir_memo [n = 24] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "hir/Compeval.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::hir_memo {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::hir::TrUnit;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+struct MemoRun {
+  bool evaluated{false};
+  int return_value{0};
+  Size memo_count{0};
+  Size memo_bytes{0};
+};
+
+// Evaluates 'tokens' as the only source file of a new translation unit.
+inline MemoRun EvalProgram(const Vec<Tk>& tokens, Size memo_budget) {
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  unit.vm.memo_budget = memo_budget;
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return MemoRun{};
+  unit.trees["bench"] = parsed.Extract().ast;
+  if (!unit.EvalSourceFile("bench")) return MemoRun{};
+  return MemoRun{true, output.return_value, unit.vm.MemoCount(), unit.vm.MemoBytes()};
+}
+
+inline int Run(int argc, char* argv[]) {
+  const int n = argc > 1 ? std::stoi(argv[1]) : 24;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Str arg = std::to_string(n);
+
+  const std::pair<StrView, Str> programs[] = {
+      {"fib",
+       "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+       "return fib(" + arg + ");"},
+      {"binomial",
+       "fn@choose(const int @n, const int @k)>const int:{"
+       "  if (k == 0) { return 1; }; if (k == n) { return 1; };"
+       "  return choose(n - 1, k - 1) + choose(n - 1, k);"
+       "};"
+       "return choose(" + arg + ", " + std::to_string(n / 2) + ");"},
+      {"counted_fib",
+       "def @calls:0;"
+       "fn@fib(const int @n)>const int:{"
+       "  calls = calls + 1;"
+       "  if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2);"
+       "};"
+       "return fib(" + arg + ");"},
+  };
+
+  std::cout << "program,n,plain_ms,memo_ms,speedup,memo_entries,memo_bytes,identical\n";
+  for (const auto& [name, src] : programs) {
+    const Vec<Tk> tokens = Lexer::LexSanitized(src).value_or(Vec<Tk>{});
+    MemoRun plain{};
+    MemoRun memo{};
+    const double plain_ms = BestOfMs(reps, [&] { plain = EvalProgram(tokens, 0); });
+    const double memo_ms = BestOfMs(reps, [&] { memo = EvalProgram(tokens, hir::Context::kDefaultMemoBudget); });
+    const bool identical = plain.evaluated && memo.evaluated && plain.return_value == memo.return_value;
+
+    std::cout << name << ',' << n << ',' << plain_ms << ',' << memo_ms << ',' << plain_ms / memo_ms << ','
+              << memo.memo_count << ',' << memo.memo_bytes << ',' << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::hir_memo
+
+/// @} // end of cnd_benchmark
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
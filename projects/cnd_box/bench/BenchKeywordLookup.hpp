@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Keyword recognition: bucketed GetTkFromKeyword against the previous linear compare chain.
+///
+/// Usage: cnd_bench keyword_lookup [identifier count = 4000000] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/lexer.hpp"
+#include "BenchCorpus.hpp"
+#include <random>
+// clang-format on
+
+namespace cnd::bench::keyword_lookup {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using corevals::grammar::detail::kTkKeywordEntries;
+
+// The previous implementation: compare against every literal in declaration order.
+constexpr eTk GetTkFromKeywordLinear(StrView kw) noexcept {
+  if (kw.empty()) return eTk::kNONE;
+  for (const auto& e : kTkKeywordEntries)
+    if (e.literal == kw) return e.type;
+  return eTk::kNONE;
+}
+
+// Identifier-heavy word list: roughly one keyword per four user identifiers of similar shapes.
+inline Vec<Str> MakeIdentifiers(Size count) {
+  static constexpr const char* kUserIdents[] = {"a",     "b",        "idx",       "count", "defined", "integer",
+                                                "result", "fib_next", "namespace_", "value_", "list_len", "i"};
+  std::mt19937 rng{7};
+  Vec<Str> out;
+  out.reserve(count);
+  for (Size i = 0; i < count; i++) {
+    if (rng() % 5 == 0) {
+      const auto& kw = kTkKeywordEntries[rng() % std::size(kTkKeywordEntries)];
+      if (!kw.literal.empty() && IsSrcCharAlphaUnderscore(kw.literal[0])) {
+        out.emplace_back(kw.literal);
+        continue;
+      }
+    }
+    out.emplace_back(kUserIdents[rng() % std::size(kUserIdents)]);
+  }
+  return out;
+}
+
+// Best time of 'reps' lookups of every word, summing the results into 'checksum'.
+template <class FnT>
+double BestLookupMs(int reps, const Vec<Str>& words, FnT&& lookup, Size& checksum) {
+  return BestOfMs(reps, [&] {
+    Size sum = 0;
+    for (const auto& w : words) sum += static_cast<Size>(lookup(w));
+    checksum = sum;
+  });
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size count = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 4000000;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Vec<Str> words = MakeIdentifiers(count);
+
+  Size linear_sum = 0;
+  Size bucketed_sum = 0;
+  const double linear_ms = BestLookupMs(reps, words, [](StrView w) { return GetTkFromKeywordLinear(w); }, linear_sum);
+  const double bucketed_ms = BestLookupMs(reps, words, [](StrView w) { return GetTkFromKeyword(w); }, bucketed_sum);
+
+  std::cout << "method,lookups,best_ms,ns_per_lookup,checksum\n";
+  std::cout << "linear," << count << ',' << linear_ms << ',' << linear_ms * 1e6 / count << ',' << linear_sum << '\n';
+  std::cout << "bucketed," << count << ',' << bucketed_ms << ',' << bucketed_ms * 1e6 / count << ',' << bucketed_sum
+            << '\n';
+  return linear_sum == bucketed_sum ? 0 : 1;
+}
+
+}  // namespace cnd::bench::keyword_lookup
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
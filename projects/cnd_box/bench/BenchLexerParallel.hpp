@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Chunked parallel lexing throughput at 1, 2, 4 and 8 threads against the serial lexer.
+///
+/// Usage: cnd_bench lexer_parallel [source size in MiB = 64] [repetitions = 3]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/lexer.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::lexer_parallel {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::bench::IsTkStreamIdentical;
+using cnd::bench::MakeFragmentCorpus;
+using cnd::trtools::Lexer;
+
+// Generated-code shaped source: many short statements, with comments and strings spanning lines.
+inline Str MakeParallelCorpus(Size size) {
+  static constexpr const char* kFragments[] = {
+      "def @generated_value_0001:1234567890;\n",
+      "while (alpha < 10){ std::msg(\"hello\nworld\"); a = b + c * 42; }\n",
+      "`generated line comment\n",
+      "/` generated block comment\n   spanning lines `/\n",
+      "def @pi: 3.14159265358979323846;\n",
+  };
+  return MakeFragmentCorpus(kFragments, 11, size);
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size mib = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 64;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 3;
+  const Str src = MakeParallelCorpus(mib * 1024 * 1024);
+  const double mbytes = static_cast<double>(src.size()) / (1024.0 * 1024.0);
+
+  auto serial = Lexer::Lex(src);
+  if (!serial) {
+    std::cerr << "Failed to lex benchmark corpus.\n";
+    return 1;
+  }
+  const double serial_ms = BestOfMs(reps, [&] { serial = Lexer::Lex(src); });
+
+  std::cout << "threads,chunks,bytes,tokens,best_ms,mb_per_s,speedup,identical\n";
+  std::cout << "serial,1," << src.size() << ',' << serial->size() << ',' << serial_ms << ','
+            << mbytes / (serial_ms / 1000.0) << ",1,true\n";
+  for (unsigned threads : {1u, 2u, 4u, 8u}) {
+    Lexer::LexerOutputT parallel{};
+    const double best_ms = BestOfMs(reps, [&] { parallel = Lexer::LexParallel(src, threads); });
+    const bool identical = parallel && IsTkStreamIdentical(*parallel, *serial);
+    std::cout << threads << ',' << Lexer::FindParallelSplits(src, threads).size() - 1 << ',' << src.size() << ','
+              << serial->size() << ',' << best_ms << ',' << mbytes / (best_ms / 1000.0) << ',' << serial_ms / best_ms
+              << ',' << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::lexer_parallel
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Lexer throughput in MB/s for each source run scanning mode.
+///
+/// Usage: cnd_bench lexer_scan [source size in MiB = 16] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/lexer.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::lexer_scan {
+using namespace cnd;
+using namespace cnd::trtools::srcscan;
+using cnd::bench::BestOfMs;
+using cnd::bench::IsTkStreamIdentical;
+using cnd::bench::MakeFragmentCorpus;
+using cnd::trtools::Lexer;
+
+// Deterministic identifier/number/whitespace/comment heavy source of at least 'size' bytes.
+inline Str MakeLexerCorpus(Size size) {
+  static constexpr const char* kFragments[] = {
+      "def @a_reasonably_long_identifier_name:1234567890;\n",
+      "    \t    \t    \t    \t    \t    \t    \t    \t\n",
+      "`a line comment which goes on for a while, as they usually do in real code\n",
+      "/` a block comment\n   spanning a few lines\n   of descriptive text `/\n",
+      "while (alpha < 10){ std::msg(\"hello world\"); a = b + c * 42; }\n",
+      "def @pi: 3.14159265358979323846264338327950288;\n",
+  };
+  return MakeFragmentCorpus(kFragments, 42, size);
+}
+
+inline const char* IsaName(eScanIsa isa) {
+  switch (isa) {
+    case eScanIsa::kAvx2:
+      return "avx2";
+    case eScanIsa::kSse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size mib = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 16;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Str src = MakeLexerCorpus(mib * 1024 * 1024);
+  const double mbytes = static_cast<double>(src.size()) / (1024.0 * 1024.0);
+
+  SetScanIsa(eScanIsa::kScalar);
+  auto baseline = Lexer::Lex(src);
+  if (!baseline) {
+    std::cerr << "Failed to lex benchmark corpus.\n";
+    return 1;
+  }
+
+  std::cout << "isa,bytes,tokens,best_ms,mb_per_s,identical\n";
+  for (eScanIsa isa : {eScanIsa::kScalar, eScanIsa::kSse2, eScanIsa::kAvx2}) {
+    if (SetScanIsa(isa) != isa) continue;  // Not supported by this host.
+    auto tokens = Lexer::Lex(src);
+    const double best_ms = BestOfMs(reps, [&] { tokens = Lexer::Lex(src); });
+    const bool identical = tokens && IsTkStreamIdentical(*tokens, *baseline);
+    std::cout << IsaName(isa) << ',' << src.size() << ',' << baseline->size() << ',' << best_ms << ','
+              << mbytes / (best_ms / 1000.0) << ',' << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  return 0;
+}
+
+}  // namespace cnd::bench::lexer_scan
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
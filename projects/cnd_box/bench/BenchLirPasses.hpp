@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Build and optimization time of the low level IR, and the effect of the passes on the code.
+///
+/// The program is 'copies' renamed copies of a set of functions with loops, branches and calls to small helpers.
+/// Reports the time to build the LIR, the time of every pass, the instruction count before and after the passes, and
+/// the time to interpret a call of each copy's entry function on the unoptimized and the optimized LIR.
+///
+/// Usage: cnd_bench lir_passes [copies = 200] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "lir/LirBuild.hpp"
+#include "lir/LirPasses.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::lir_passes {
+using namespace cnd;
+using namespace cnd::lir;
+using cnd::bench::BestOfMs;
+using cnd::bench::MakeIndexedCopies;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+// Functions of one copy, '$' is replaced by the index of the copy.
+constexpr StrView kCopySrc =
+    "fn@sq$(const int @x)>const int:{ return x * x; };"
+    "fn@clamp$(const int @x, const int @hi)>const int:{ if (x > hi) { return hi; }; return x; };"
+    "fn@entry$(const int @n)>const int:{"
+    "  def int @s:0;"
+    "  def int @scale:2 * 8;"
+    "  for (def int @i:0; i < n; i++) {"
+    "    def int @a:sq$(i) + i * scale;"
+    "    def int @b:i * scale + sq$(i);"
+    "    if (scale > 10) { s = s + clamp$(a - b + i, 1000); } else { s = s - 1; }"
+    "  }"
+    "  return s;"
+    "};";
+
+// Sum of the results of every entry function called with 'arg', or none if a call fails.
+inline Opt<I64> RunEntries(const LirModule& module, int copies, I64 arg) {
+  I64 sum = 0;
+  const I64 args[] = {arg};
+  for (int c = 0; c < copies; c++) {
+    auto result = LirExecute(module, *module.FindFunction(Symbols().Intern("entry" + std::to_string(c))), args);
+    if (!result) return std::nullopt;
+    sum += *result;
+  }
+  return sum;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const int copies = argc > 1 ? std::stoi(argv[1]) : 200;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  const Str src = MakeIndexedCopies(kCopySrc, copies);
+  const Vec<Tk> tokens = Lexer::LexSanitized(src).value_or(Vec<Tk>{});
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return 1;
+  const Ast ast = parsed.Extract().ast;
+
+  LirModule unoptimized{};
+  const double build_ms = BestOfMs(reps, [&] { unoptimized = LirBuilder::Build(ast).value_or(LirModule{}); });
+  if (unoptimized.functions.empty()) return 1;
+
+  LirModule optimized = unoptimized;
+  LirPassManager passes = LirPassManager::MakeDefault();
+  if (!passes.Run(optimized, 8, false)) return 1;
+
+  Opt<I64> unoptimized_sum{};
+  Opt<I64> optimized_sum{};
+  const double unoptimized_ms = BestOfMs(reps, [&] { unoptimized_sum = RunEntries(unoptimized, copies, 100); });
+  const double optimized_ms = BestOfMs(reps, [&] { optimized_sum = RunEntries(optimized, copies, 100); });
+  const bool identical = unoptimized_sum && optimized_sum && *unoptimized_sum == *optimized_sum;
+
+  std::cout << "copies,functions,build_ms,insts_before,insts_after,rounds,exec_before_ms,exec_after_ms,identical\n";
+  std::cout << copies << ',' << unoptimized.functions.size() << ',' << build_ms << ',' << unoptimized.InstCount() << ','
+            << optimized.InstCount() << ',' << passes.Rounds() << ',' << unoptimized_ms << ',' << optimized_ms << ','
+            << (identical ? "true" : "false") << "\n\n";
+  std::cout << "pass,runs,changes,ms\n";
+  for (const LirPassTiming& timing : passes.Timings())
+    std::cout << timing.name << ',' << timing.runs << ',' << timing.changes << ',' << timing.Milliseconds() << '\n';
+  return identical ? 0 : 1;
+}
+
+}  // namespace cnd::bench::lir_passes
+
+/// @} // end of cnd_benchmark
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
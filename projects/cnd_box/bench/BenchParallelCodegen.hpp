@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Time to generate and write many translation units on one thread against a pool of threads.
+///
+/// Every unit is a C file of generated classes, units differ in size so the workers must balance. Each thread count
+/// writes the same files, which are compared against the single threaded output. 'cold_ms' writes every file into an
+/// empty directory, 'warm_ms' generates the same units again, which leaves the unchanged files untouched.
+///
+/// Usage: cnd_bench parallel_codegen [units = 64] [classes per unit = 2000] [repetitions = 3]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "codegen/CLangCodegen.hpp"
+#include "codegen/ParallelCodegen.hpp"
+#include "BenchCorpus.hpp"
+#include <filesystem>
+#include <fstream>
+// clang-format on
+
+namespace cnd::bench::parallel_codegen {
+using namespace cnd;
+using namespace cnd::clang::codegen;
+using cnd::bench::BestOfMs;
+
+// Unit 'u' holds between 'classes' / 2 and 'classes' * 3 / 2 classes.
+inline Vec<Vec<ClassDecl>> MakeUnits(Size units, Size classes) {
+  Vec<Vec<ClassDecl>> out(units);
+  for (Size u = 0; u < units; u++) {
+    const Size count = classes / 2 + classes * (u % 5) / 4;
+    for (Size i = 0; i < count; i++) {
+      const Str id = std::to_string(u) + "_" + std::to_string(i);
+      ClassDecl& cls = out[u].emplace_back(ClassDecl{.name = "Generated" + id});
+      for (int m = 0; m < 4; m++) cls.member_variables.push_back("int member_" + std::to_string(m));
+      cls.methods.push_back(MethodDecl{.name = "Sum",
+                                       .return_type = "int",
+                                       .params = {{"int", "k"}},
+                                       .definition = "return member_0 + member_1 * k;"});
+    }
+  }
+  return out;
+}
+
+inline Str ReadFile(const Path& path) {
+  std::ifstream file{path, std::ios::binary};
+  return Str{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size units = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 64;
+  const Size classes = argc > 2 ? static_cast<Size>(std::stoul(argv[2])) : 2000;
+  const int reps = argc > 3 ? std::stoi(argv[3]) : 3;
+  const Path dir = std::filesystem::temp_directory_path() / "BenchParallelCodegen";
+  std::filesystem::create_directories(dir);
+
+  const Vec<Vec<ClassDecl>> model = MakeUnits(units, classes);
+  Vec<Path> paths{};
+  for (Size u = 0; u < units; u++) paths.push_back(dir / ("unit" + std::to_string(u) + ".c"));
+  auto write_unit = [&model](Size u, CodeWriter& out) {
+    for (const auto& cls : model[u]) cls.Codegen(out);
+  };
+
+  Vec<unsigned> thread_counts{1};
+  for (unsigned t = 2; t < DefaultCodegenThreads(); t *= 2) thread_counts.push_back(t);
+  if (DefaultCodegenThreads() > 1) thread_counts.push_back(DefaultCodegenThreads());
+
+  std::cout << "threads,units,output_bytes,cold_ms,warm_ms,cold_speedup,identical\n";
+  Vec<Str> expected{};
+  double serial_ms = 0;
+  for (unsigned threads : thread_counts) {
+    const CodeFilesConfig config{.threads = threads, .manifest = dir / "aux" / OutputManifest::kFileName};
+    bool written = true;
+    auto generate = [&](Size expected_written) {
+      Vec<Path> output_files{};
+      auto report = WriteCodeFiles(paths, write_unit, output_files, config);
+      written = written && report.has_value() && report->written == expected_written;
+    };
+    double ms = std::numeric_limits<double>::max();
+    for (int r = 0; r < reps; r++) {
+      for (const Path& path : paths) std::filesystem::remove(path);
+      ms = std::min(ms, BestOfMs(1, [&] { generate(units); }));
+    }
+    const double warm_ms = BestOfMs(reps, [&] { generate(0); });
+    Size output_bytes = 0;
+    bool identical = written;
+    for (Size u = 0; u < units; u++) {
+      Str text = ReadFile(paths[u]);
+      output_bytes += text.size();
+      if (threads == 1)
+        expected.push_back(std::move(text));
+      else
+        identical = identical && text == expected[u];
+    }
+    if (threads == 1) serial_ms = ms;
+    std::cout << threads << ',' << units << ',' << output_bytes << ',' << ms << ',' << warm_ms << ',' << serial_ms / ms
+              << ',' << (identical ? "true" : "false") << '\n';
+    if (!identical) return 1;
+  }
+  std::filesystem::remove_all(dir);
+  return 0;
+}
+
+}  // namespace cnd::bench::parallel_codegen
+
+/// @} // end of cnd_benchmark
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
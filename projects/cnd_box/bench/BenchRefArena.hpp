@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Cost of allocating and freeing reference counted values on the heap and in a RefArena.
+///
+/// Each round builds arrays of short strings, the shape of values produced by compile time evaluation. 'heap' and
+/// 'arena' release every value one by one. 'arena_teardown' never releases and frees the whole arena at once, the way
+/// a translation unit drops its values.
+///
+/// Usage: cnd_bench ref_arena [arrays = 10000] [elements = 8] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "hir/AnyValue.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::ref_arena {
+using namespace cnd;
+using namespace cnd::hir;
+using cnd::bench::BestOfMs;
+
+inline Vec<AV> MakeValues(Size arrays, Size elements) {
+  Vec<AV> out{};
+  out.reserve(arrays);
+  for (Size i = 0; i < arrays; i++) {
+    AV array = AV::Make<Array>(Array::DataT{});
+    for (Size j = 0; j < elements; j++) AV::CppRef<Array>(array).data.push_back(AV::Make<String>("element"));
+    out.push_back(array);
+  }
+  return out;
+}
+
+inline void ReleaseValues(Vec<AV>& values) {
+  for (AV& value : values) AV::Release(value);
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size arrays = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 10000;
+  const Size elements = argc > 2 ? static_cast<Size>(std::stoul(argv[2])) : 8;
+  const int reps = argc > 3 ? std::stoi(argv[3]) : 5;
+
+  const double heap_ms = BestOfMs(reps, [&] {
+    Vec<AV> values = MakeValues(arrays, elements);
+    ReleaseValues(values);
+  });
+  const double arena_ms = BestOfMs(reps, [&] {
+    RefArena arena{};
+    RefArenaScope scope{arena};
+    Vec<AV> values = MakeValues(arrays, elements);
+    ReleaseValues(values);
+  });
+  const double teardown_ms = BestOfMs(reps, [&] {
+    RefArena arena{};
+    RefArenaScope scope{arena};
+    Vec<AV> values = MakeValues(arrays, elements);
+  });
+
+  std::cout << "arrays,elements,heap_ms,arena_ms,arena_teardown_ms,arena_speedup,teardown_speedup\n";
+  std::cout << arrays << ',' << elements << ',' << heap_ms << ',' << arena_ms << ',' << teardown_ms << ','
+            << heap_ms / arena_ms << ',' << heap_ms / teardown_ms << '\n';
+  return 0;
+}
+
+}  // namespace cnd::bench::ref_arena
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Source file load time: char by char stream iteration against the SourceManager sized read.
+///
+/// Usage: cnd_bench source_load [file size in MiB = 64] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/SourceManager.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::source_load {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::trtools::SourceManager;
+
+// The previous loader: istreambuf_iterator into a vector, then a terminating '\0'.
+inline Vec<char> LoadByStreamIteration(StrView fp) {
+  std::ifstream source_file_stream(Str{fp});
+  Vec<char> buffer((std::istreambuf_iterator<char>(source_file_stream)), std::istreambuf_iterator<char>());
+  if (buffer.empty() || buffer.back() != '\0') buffer.push_back('\0');
+  return buffer;
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size mib = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 64;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Str path = "_bench_source_load.cnd";
+  {
+    const Str line = "def @generated_value:1234567890; `comment\n";
+    std::ofstream out{path, std::ios::binary};
+    for (Size written = 0; written < mib * 1024 * 1024; written += line.size()) out << line;
+  }
+  const double mbytes = static_cast<double>(stdfs::file_size(path)) / (1024.0 * 1024.0);
+
+  Size stream_size = 0;
+  Size managed_size = 0;
+  const double stream_ms = BestOfMs(reps, [&] { stream_size = LoadByStreamIteration(path).size() - 1; });
+  const double managed_ms = BestOfMs(reps, [&] {
+    SourceManager sources;  // Fresh manager, so every repetition reads the file.
+    managed_size = sources.Text(sources.Load(path).value()).size();
+  });
+  stdfs::remove(path);
+
+  std::cout << "method,bytes,best_ms,mb_per_s\n";
+  std::cout << "stream_iteration," << stream_size << ',' << stream_ms << ',' << mbytes / (stream_ms / 1000.0) << '\n';
+  std::cout << "source_manager," << managed_size << ',' << managed_ms << ',' << mbytes / (managed_ms / 1000.0) << '\n';
+  return stream_size == managed_size ? 0 : 1;
+}
+
+}  // namespace cnd::bench::source_load
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
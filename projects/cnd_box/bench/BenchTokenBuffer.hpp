@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Token storage size and lex + sanitize time: Vec<Tk>, the compact TokenBuffer and the fused single pass.
+///
+/// Usage: cnd_bench token_buffer [source size in MiB = 16] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/lexer.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::token_buffer {
+using namespace cnd;
+using cnd::bench::BestOfMs;
+using cnd::bench::MakeFragmentCorpus;
+using cnd::trtools::Lexer;
+
+inline Str MakeTokenCorpus(Size size) {
+  static constexpr const char* kFragments[] = {
+      "def @a:0; def @b:1;\n",
+      "`a line comment\n",
+      "while (a < 100){ std::msg(\"fib\"); def @c:a+b; a = b; b = c; }\n",
+      "fn @add(a,b):{ return a + b; };\n",
+      "/` block\n comment `/\n",
+  };
+  return MakeFragmentCorpus(kFragments, 3, size);
+}
+
+inline int Run(int argc, char* argv[]) {
+  const Size mib = argc > 1 ? static_cast<Size>(std::stoul(argv[1])) : 16;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+  const Str src = MakeTokenCorpus(mib * 1024 * 1024);
+
+  auto tokens = Lexer::Lex(src);
+  auto compact = Lexer::LexCompact(src);
+  if (!tokens || !compact) {
+    std::cerr << "Failed to lex benchmark corpus.\n";
+    return 1;
+  }
+  const Size vec_bytes = tokens->capacity() * sizeof(Tk);
+  const Size compact_bytes = compact->ResidentBytes();
+  const Size sanitized_count = Lexer::Sanitize(*tokens).size();
+
+  Size vec_sanitized = 0;
+  Size compact_sanitized = 0;
+  Size fused_sanitized = 0;
+  const double vec_ms = BestOfMs(reps, [&] { vec_sanitized = Lexer::Sanitize(Lexer::Lex(src).value()).size(); });
+  const double compact_ms =
+      BestOfMs(reps, [&] { compact_sanitized = Lexer::Sanitize(Lexer::LexCompact(src).value()).size(); });
+  const double fused_ms = BestOfMs(reps, [&] { fused_sanitized = Lexer::LexSanitized(src).value().size(); });
+
+  std::cout << "storage,tokens,resident_bytes,bytes_per_token,lex_sanitize_best_ms,sanitized_tokens\n";
+  std::cout << "vec_tk," << tokens->size() << ',' << vec_bytes << ','
+            << static_cast<double>(vec_bytes) / tokens->size() << ',' << vec_ms << ',' << vec_sanitized << '\n';
+  std::cout << "token_buffer," << compact->Count() << ',' << compact_bytes << ','
+            << static_cast<double>(compact_bytes) / compact->Count() << ',' << compact_ms << ',' << compact_sanitized
+            << '\n';
+  // The fused pass holds no trivia, only the sanitized tokens stay resident.
+  std::cout << "fused," << sanitized_count << ',' << sanitized_count * sizeof(Tk) << ',' << sizeof(Tk) << ','
+            << fused_ms << ',' << fused_sanitized << '\n';
+  return vec_sanitized == sanitized_count && compact_sanitized == sanitized_count && fused_sanitized == sanitized_count
+             ? 0
+             : 1;
+}
+
+}  // namespace cnd::bench::token_buffer
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Latency of the native x86-64 backend, from the syntax tree to the bytes of an ELF object.
+///
+/// The program is 'copies' renamed copies of a set of functions with loops, branches and calls to small helpers, as in
+/// the lir_passes benchmark. Reports the time of every stage: building the LIR, the optimization passes, instruction
+/// selection and register allocation of the unoptimized and the optimized LIR, and writing the object file. The size of
+/// the code and of the object are reported with the time per compiled function.
+///
+/// Usage: cnd_bench x64_compile [copies = 200] [repetitions = 5]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+#include "lir/LirBuild.hpp"
+#include "lir/LirPasses.hpp"
+#include "x64/X64Codegen.hpp"
+#include "BenchCorpus.hpp"
+// clang-format on
+
+namespace cnd::bench::x64_compile {
+using namespace cnd;
+using namespace cnd::lir;
+using cnd::bench::BestOfMs;
+using cnd::bench::MakeIndexedCopies;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+using cnd::x64::CompileX64Object;
+using cnd::x64::ElfObject;
+
+// Functions of one copy, '$' is replaced by the index of the copy.
+constexpr StrView kCopySrc =
+    "fn@sq$(const int @x)>const int:{ return x * x; };"
+    "fn@clamp$(const int @x, const int @hi)>const int:{ if (x > hi) { return hi; }; return x; };"
+    "fn@entry$(const int @n)>const int:{"
+    "  def int @s:0;"
+    "  def int @scale:2 * 8;"
+    "  for (def int @i:0; i < n; i++) {"
+    "    def int @a:sq$(i) + i * scale;"
+    "    def int @b:i * scale + sq$(i);"
+    "    if ((scale > 10) && (a >= b)) { s = s + clamp$(a - b + i, 1000) % 7; } else { s = s - 1; }"
+    "  }"
+    "  return s;"
+    "};";
+
+inline int Run(int argc, char* argv[]) {
+  const int copies = argc > 1 ? std::stoi(argv[1]) : 200;
+  const int reps = argc > 2 ? std::stoi(argv[2]) : 5;
+
+  const Str src = MakeIndexedCopies(kCopySrc, copies);
+  const Vec<Tk> tokens = Lexer::LexSanitized(src).value_or(Vec<Tk>{});
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return 1;
+  const Ast ast = parsed.Extract().ast;
+
+  LirModule unoptimized{};
+  const double build_ms = BestOfMs(reps, [&] { unoptimized = LirBuilder::Build(ast).value_or(LirModule{}); });
+  if (unoptimized.functions.empty()) return 1;
+
+  // The passes change the module they run on, each repetition starts from a copy.
+  LirModule optimized{};
+  const double passes_ms = BestOfMs(reps, [&] {
+    optimized = unoptimized;
+    if (!LirPassManager::MakeDefault().Run(optimized, 8, false)) optimized = LirModule{};
+  });
+  if (optimized.functions.empty()) return 1;
+
+  ElfObject unoptimized_object{};
+  ElfObject optimized_object{};
+  const double codegen_o0_ms =
+      BestOfMs(reps, [&] { unoptimized_object = CompileX64Object(unoptimized).value_or(ElfObject{}); });
+  const double codegen_o1_ms =
+      BestOfMs(reps, [&] { optimized_object = CompileX64Object(optimized).value_or(ElfObject{}); });
+  if (unoptimized_object.symbols.empty() || optimized_object.symbols.empty()) return 1;
+
+  Vec<UI8> bytes{};
+  const double serialize_ms = BestOfMs(reps, [&] { bytes = optimized_object.Serialize(); });
+
+  const auto functions = static_cast<double>(unoptimized.functions.size());
+  std::cout << "copies,functions,build_ms,passes_ms,codegen_o0_ms,codegen_o1_ms,serialize_ms,text_o0_bytes,"
+               "text_o1_bytes,object_bytes,o0_us_per_function,o1_us_per_function\n";
+  std::cout << copies << ',' << unoptimized.functions.size() << ',' << build_ms << ',' << passes_ms << ','
+            << codegen_o0_ms << ',' << codegen_o1_ms << ',' << serialize_ms << ',' << unoptimized_object.text.size()
+            << ',' << optimized_object.text.size() << ',' << bytes.size() << ','
+            << (build_ms + codegen_o0_ms + serialize_ms) * 1000.0 / functions << ','
+            << (build_ms + passes_ms + codegen_o1_ms + serialize_ms) * 1000.0 / functions << '\n';
+  return 0;
+}
+
+}  // namespace cnd::bench::x64_compile
+
+/// @} // end of cnd_benchmark
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
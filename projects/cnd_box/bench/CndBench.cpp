@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_benchmark
+/// @brief Benchmark driver. Runs one benchmark stage, named by the first argument, and passes it the rest.
+///
+/// Each stage prints machine-readable CSV results to stdout and returns non-zero if it failed or its variants did not
+/// agree. The stages are documented in their Bench*.hpp header. Allocation counters are shared by every stage, so the
+/// global allocation functions are replaced here, once.
+///
+/// Usage: cnd_bench [stage = front_end] [stage arguments...]
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_benchmark
+/// @{
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "BenchAlloc.hpp"
+#include "BenchCorpus.hpp"
+#include "BenchFrontEnd.hpp"
+#include "BenchLexerScan.hpp"
+#include "BenchKeywordLookup.hpp"
+#include "BenchTokenBuffer.hpp"
+#include "BenchLexerParallel.hpp"
+#include "BenchSourceLoad.hpp"
+#include "BenchBracketMatch.hpp"
+#include "BenchExprParse.hpp"
+#include "BenchCompeval.hpp"
+#include "BenchHirDispatch.hpp"
+#include "BenchRefArena.hpp"
+#include "BenchCowValues.hpp"
+#include "BenchFlatMap.hpp"
+#include "BenchHirMemo.hpp"
+#include "BenchCodeWriter.hpp"
+#include "BenchParallelCodegen.hpp"
+#include "BenchLirPasses.hpp"
+#include "BenchX64Compile.hpp"
+#include <cstdlib>
+#include <new>
+// clang-format on
+
+namespace {
+using cnd::bench::CountAlloc;
+using cnd::bench::CountFree;
+
+// Allocations carry their size in a header just below the returned pointer, so frees can be subtracted from the live
+// bytes. The header is as large as the alignment, so the returned pointer keeps it.
+constexpr std::size_t kAllocHeader = alignof(std::max_align_t);
+
+void* AllocWithHeader(std::size_t n, std::size_t align) noexcept {
+  const std::size_t total = (n + align + align - 1) / align * align;  // aligned_alloc takes multiples of 'align'.
+#if defined(_WIN32)
+  auto* base = static_cast<unsigned char*>(_aligned_malloc(total, align));
+#else
+  auto* base = static_cast<unsigned char*>(std::aligned_alloc(align, total));
+#endif
+  if (base == nullptr) return nullptr;
+  *reinterpret_cast<std::size_t*>(base + align - sizeof(std::size_t)) = n;
+  CountAlloc(n);
+  return base + align;
+}
+
+void FreeWithHeader(void* p, std::size_t align) noexcept {
+  if (p == nullptr) return;
+  auto* base = static_cast<unsigned char*>(p) - align;
+  CountFree(*reinterpret_cast<std::size_t*>(base + align - sizeof(std::size_t)));
+#if defined(_WIN32)
+  _aligned_free(base);
+#else
+  std::free(base);
+#endif
+}
+}  // namespace
+
+// Counting replacements of the global allocation functions. The array and nothrow forms forward to these.
+void* operator new(std::size_t n) {
+  if (void* p = AllocWithHeader(n, kAllocHeader)) return p;
+  throw std::bad_alloc{};
+}
+void* operator new(std::size_t n, std::align_val_t al) {
+  if (void* p = AllocWithHeader(n, std::max(kAllocHeader, static_cast<std::size_t>(al)))) return p;
+  throw std::bad_alloc{};
+}
+void operator delete(void* p) noexcept { FreeWithHeader(p, kAllocHeader); }
+void operator delete(void* p, std::size_t) noexcept { FreeWithHeader(p, kAllocHeader); }
+void operator delete(void* p, std::align_val_t al) noexcept {
+  FreeWithHeader(p, std::max(kAllocHeader, static_cast<std::size_t>(al)));
+}
+void operator delete(void* p, std::size_t, std::align_val_t al) noexcept {
+  FreeWithHeader(p, std::max(kAllocHeader, static_cast<std::size_t>(al)));
+}
+
+namespace {
+using namespace cnd::bench;
+
+struct BenchStage {
+  const char* name;
+  int (*run)(int argc, char* argv[]);
+};
+
+constexpr BenchStage kBenchStages[] = {
+    {"front_end", front_end::Run},
+    {"lexer_scan", lexer_scan::Run},
+    {"keyword_lookup", keyword_lookup::Run},
+    {"token_buffer", token_buffer::Run},
+    {"lexer_parallel", lexer_parallel::Run},
+    {"source_load", source_load::Run},
+    {"bracket_match", bracket_match::Run},
+    {"expr_parse", expr_parse::Run},
+    {"compeval", compeval::Run},
+    {"hir_dispatch", hir_dispatch::Run},
+    {"ref_arena", ref_arena::Run},
+    {"cow_values", cow_values::Run},
+    {"flat_map", flat_map::Run},
+    {"hir_memo", hir_memo::Run},
+    {"code_writer", code_writer::Run},
+    {"parallel_codegen", parallel_codegen::Run},
+    {"lir_passes", lir_passes::Run},
+    {"x64_compile", x64_compile::Run},
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  // The stage sees its name as argv[0], so its own arguments start at argv[1].
+  const cnd::StrView stage_arg = argc > 1 ? argv[1] : "front_end";
+  for (const BenchStage& stage : kBenchStages) {
+    if (stage_arg != stage.name) continue;
+    if (argc > 1) return stage.run(argc - 1, argv + 1);
+    char* stage_argv[] = {const_cast<char*>(stage.name), nullptr};
+    return stage.run(1, stage_argv);
+  }
+  std::cerr << "Unknown benchmark stage '" << stage_arg << "'. Stages:";
+  for (const BenchStage& stage : kBenchStages) std::cerr << ' ' << stage.name;
+  std::cerr << ".\n";
+  return 1;
+}
+
+/// @} // end of cnd_benchmark
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +93,7 @@ using ccapi::WStr;
 using ccapi::WStrView;
 
 using ccapi::Ex;
+using ccapi::FlatMap;
 using ccapi::List;
 using ccapi::Opt;
 using ccapi::Pair;
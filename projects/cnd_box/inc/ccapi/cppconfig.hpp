@@ -103,6 +103,9 @@ using Arr = std::array<T, N>;
 template <class T, class AllocT = std::allocator<T>>
 using List = std::list<T, AllocT>;
 
+template <class K, class V, class HashT = cxx::FlatHash<K>>
+using FlatMap = cxx::FlatMap<K, V, HashT>;
+
 template <class T, class U>
 using Ex = std::expected<T, U>;
 
@@ -418,6 +418,15 @@ ClRes<void> ConfigTranslationInput(TrInput& trin, const FlagMeta::FlagMapType& f
     trin.src_files.push_back(std::get<StrView>(it->second));
   }
 
+  // C is generated only when an output directory is given. The manifest of the outputs is kept beside them, unless an
+  // auxiliary directory is given.
+  if (auto out_dir = flags.find(eFlag::kOutDir); out_dir != flags.end())
+    trin.out_dir = std::get<StrView>(out_dir->second);
+  if (auto aux_dir = flags.find(eFlag::kAuxDir); aux_dir != flags.end())
+    trin.aux_dir = std::get<StrView>(aux_dir->second);
+  else
+    trin.aux_dir = trin.out_dir;
+
   return ClRes<void>{}; 
 };
 
@@ -7,8 +7,8 @@
 // @website: https://www.acpp.dev
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @file
-/// @ingroup
-/// @brief
+/// @ingroup cnd_compiler
+/// @brief Models C\C++ translation units generated from the top level declarations of the C& syntax tree.
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @addtogroup cnd_compiler
@@ -21,8 +21,11 @@
 #include "frontend/Lexer.hpp"
 #include "frontend/Parser.hpp"
 
-#include "compiler/TrInput.hpp"
-#include "compiler/TrOutput.hpp"
+#include "compiler/TranslationInput.hpp"
+#include "compiler/TranslationOutput.hpp"
+
+#include "codegen/CodeWriter.hpp"
+#include "codegen/ParallelCodegen.hpp"
 // clang-format on
 
 namespace cnd {
@@ -34,14 +37,6 @@ namespace codegen {
 // C\C++ Codegen Constants
 static constexpr CStr kCommaSeparator = ", ";
 
-// C\C++ Codegen Utilities
-static constexpr Str GenerateExprList(const Vec<Str>& exprs, const Str& separator = ", ",
-                                      bool separator_after_last = false, const Str& open_with = "",
-                                      const Str& close_with = "", const Str& prefix = "");
-static constexpr Str GenerateExprList(Vec<Str>::const_iterator exprs_beg, Vec<Str>::const_iterator exprs_end,
-                                      const Str& separator = ", ", bool separator_after_last = false,
-                                      const Str& open_with = "", const Str& close_with = "", const Str& prefix = "");
-
 // @note It makes sense to create a functor object for each syntax element we need to generate. Instead of having huge
 // functions which take a lot of params.
 
@@ -87,24 +82,6 @@ struct TemplateSpecialization;
 
 }  // namespace codegen
 
-namespace codegen {
-static constexpr Str GenerateExprList(const Vec<Str>& exprs, const Str& separator = ", ",
-                                      bool separator_after_last = false, const Str& open_with = "",
-                                      const Str& close_with = "", const Str& prefix = "") {
-  Str ret = open_with;
-  if (exprs.size() > 1) {
-    for (auto arg_iter = exprs.cbegin(); arg_iter != std::prev(exprs.cend()); arg_iter++) {
-      ret += prefix + *arg_iter + separator;
-    }
-  }
-  if (not exprs.empty()) {
-    ret += prefix + exprs.back();
-  }
-  return ret + (separator_after_last ? separator : "") + close_with;
-}
-
-}  // namespace codegen
-
 namespace codegen {
 
 /// Models an C\C++ #include macro.
@@ -114,11 +91,11 @@ struct IncludeDirective {
   Str file{};
   IncludeType type{IncludeType::Quotes};
 
-  constexpr Str Codegen() const {
+  void Codegen(CodeWriter& out) const {
     if (type == IncludeType::Quotes)
-      return "#include \"" + file + "\"\n";
+      out << "#include \"" << file << "\"\n";
     else
-      return "#include <" + file + ">\n";
+      out << "#include <" << file << ">\n";
   }
 };
 
@@ -132,20 +109,100 @@ struct MacroDef {
                 ///        macro definition to output correct C++ code.
   Vec<Str> args{""};
 
-  constexpr Str Codegen() const {
-    if (type == eMacroType::Definition)
-      return "#define " + ident + " " + def + "\n";
-    else  // Functional
-      return GenerateExprList(args, kCommaSeparator, false, "#define " + ident + "(", ") " + def + "\n");
+  void Codegen(CodeWriter& out) const {
+    if (type == eMacroType::Definition) {
+      out << "#define " << ident << " " << def << "\n";
+    } else {  // Functional
+      out << "#define " << ident;
+      WriteExprList(out, args, kCommaSeparator, false, "(", ") ");
+      out << def << "\n";
+    }
   }
 };
 
 /// Models a C\C++ #pragma macro.
 struct PragmaDirective {
   Str params;
-  Str Codegen() const { return "#pragma " + params + "\n"; }
+  void Codegen(CodeWriter& out) const { out << "#pragma " << params << "\n"; }
 };
 
+/// C\C++ spelling of the C& operator 'op', if C has the same operator.
+constexpr Opt<StrView> GetCOperator(eAst op) noexcept {
+  switch (op) {
+    case eAst::kAdd:
+      return "+";
+    case eAst::kSub:
+      return "-";
+    case eAst::kMul:
+      return "*";
+    case eAst::kDiv:
+      return "/";
+    case eAst::kMod:
+      return "%";
+    case eAst::kAnd:
+      return "&";
+    case eAst::kOr:
+      return "|";
+    case eAst::kXor:
+      return "^";
+    case eAst::kLsh:
+      return "<<";
+    case eAst::kRsh:
+      return ">>";
+    case eAst::kBand:
+      return "&&";
+    case eAst::kBor:
+      return "||";
+    case eAst::kEq:
+      return "==";
+    case eAst::kNeq:
+      return "!=";
+    case eAst::kLt:
+      return "<";
+    case eAst::kGt:
+      return ">";
+    case eAst::kLte:
+      return "<=";
+    case eAst::kGte:
+      return ">=";
+    case eAst::kNot:
+      return "!";
+    case eAst::kBnot:
+      return "~";
+    case eAst::kInc:
+      return "++";
+    case eAst::kDec:
+      return "--";
+    default:
+      return std::nullopt;
+  }
+}
+
+/// C\C++ type of a variable with the C& type constraint 'constraint'. Unconstrained variables use C23 'auto'.
+constexpr Opt<StrView> GetCTypeName(eAst constraint) noexcept {
+  switch (constraint) {
+    case eAst::kKwAny:
+    case eAst::kKwAuto:
+      return "auto";
+    case eAst::kKwInt:
+      return "int";
+    case eAst::kKwUint:
+      return "unsigned";
+    case eAst::kKwReal:
+      return "double";
+    case eAst::kKwBool:
+      return "bool";
+    case eAst::kKwChar:
+      return "char";
+    case eAst::kKwByte:
+      return "unsigned char";
+    case eAst::kKwCstr:
+      return "const char*";
+    default:
+      return std::nullopt;
+  }
+}
+
 /// Models a C\C++ primary value or type expression.
 struct Expr {
   enum class eOpType { Literal, Ident, Call, Binary, Postfix, Prefix };
@@ -153,175 +210,177 @@ struct Expr {
   Str lit;
   Vec<Expr> operands;
 
-  static constexpr Expr FromCndAst(const Ast& ast) {
-    if (ast.IsLiteral() || ast.type == eAst::kIdent)
-      return Expr{eOpType::Literal, ast.GetLiteral(), {}};
-    else if (ast.type == eAst::kFunctionCall) {
-      Expr expr{eOpType::Call, ast.GetLiteral(), {}};
-      expr.operands.reserve(ast.children.size() - 1);
-      for (const auto& branch : std::ranges::subrange(ast.children.cbegin() + 1, ast.children.cend())) {
-        expr.operands.push_back(Expr::FromCndAst(branch));
-      }
-      return expr;
-    } else if (GetAstOperation(ast.type) == eOperation::Binary) {
-      Expr expr{eOpType::Binary, {""}, {}};
-      // Based on the C& binary op type provide the matching C\C++ operator, or analogous function call.
-      switch (ast.type) {
-        case eAst::kAdd:
-          expr.lit = "+";
-          break;
-        case eAst::kSub:
-          expr.lit = "-";
-          break;
-        case eAst::kMul:
-          expr.lit = "*";
-          break;
-        case eAst::kDiv:
-          expr.lit = "/";
-          break;
-        case eAst::kMod:
-          expr.lit = "%";
-          break;
-        case eAst::kBand:
-          expr.lit = "&";
-          break;
-        case eAst::kBor:
-          expr.lit = "|";
-          break;
-        case eAst::kXor:
-          expr.lit = "^";
-          break;
-        case eAst::kLsh:
-          expr.lit = "<<";
-          break;
-        case eAst::kRsh:
-          expr.lit = ">>";
-          break;
-        default:
-          throw cxx::UnknownEnumEntry<eAst>();
-      }
-      return Expr{eOpType::Binary, ast.GetLiteral(), {Expr::FromCndAst(ast.At(0)), Expr::FromCndAst(ast.At(1))}};
-    } else if (GetAstOperation(ast.type) == eOperation::Postfix) {
-      Expr expr{eOpType::Postfix, {""}, {}};
-      switch (ast.type) {
-        case eAst::kPostfixInc:
-          expr.lit = "++";
-          break;
-        case eAst::kPostfixDec:
-          expr.lit = "--";
-          break;
-        default:
-          throw cxx::UnknownEnumEntry<eAst>();
-      }
-    } else if (GetAstOperation(ast.type) == eOperation::Prefix) {
-      Expr expr{eOpType::Prefix, {""}, {}};
-      switch (ast.type) {
-        case eAst::kPrefixInc:
-          expr.lit = "++";
-          break;
-        case eAst::kPrefixDec:
-          expr.lit = "--";
-          break;
-        case eAst::kPrefixNot:
-          expr.lit = "!";
-          break;
-        case eAst::kPrefixBitNot:
-          expr.lit = "~";
-          break;
-        default:
-          throw cxx::UnknownEnumEntry<eAst>();
-      }
+  /// Models the C& expression 'ast'. Fails on expressions which have no C\C++ equivalent.
+  static ClRes<Expr> FromCndAst(const Ast& ast) {
+    if (ast.IsLiteral()) return Expr{eOpType::Literal, ast.GetLiteral(), {}};
+    if (ast.TypeIs(eAst::kIdent)) return Expr{eOpType::Ident, ast.GetLiteral(), {}};
+    if (ast.TypeIs(eAst::kSubexpression)) return FromCndAst(ast.At(0));
+    if (ast.TypeIs(eAst::kFunctionCall)) return FromCndCall(ast);
+
+    // Unary '+' and '-' are the binary operators with a single operand.
+    const Opt<StrView> op = GetCOperator(ast.type);
+    const eOperation arity = GetAstOperation(ast.type);
+    if (op && arity == eOperation::Binary && ast.children.size() == 2) {
+      auto lhs = FromCndAst(ast.At(0));
+      if (!lhs) return lhs;
+      auto rhs = FromCndAst(ast.At(1));
+      if (!rhs) return rhs;
+      return Expr{eOpType::Binary, Str{*op}, {std::move(*lhs), std::move(*rhs)}};
+    }
+    if (op && ast.children.size() == 1 &&
+        (arity != eOperation::Binary || ast.TypeIs(eAst::kAdd) || ast.TypeIs(eAst::kSub))) {
+      auto operand = FromCndAst(ast.At(0));
+      if (!operand) return operand;
+      return Expr{arity == eOperation::Postfix ? eOpType::Postfix : eOpType::Prefix, Str{*op}, {std::move(*operand)}};
     }
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Expression '{}' cannot be generated as C.", eAstToCStr(ast.type))));
   }
 
-  constexpr Str Codegen() const {
+  void Codegen(CodeWriter& out) const {
     switch (operation) {
       case eOpType::Literal:
       case eOpType::Ident:
-        return lit;
-      case eOpType::Call: {
-        Vec<Str> fnargs{};
-        fnargs.reserve(operands.size());
-        for (const auto& arg : operands) fnargs.push_back(arg.Codegen());
-        return lit + "(" + GenerateExprList(fnargs) + ")";
-      }
+        out << lit;
+        break;
+      case eOpType::Call:
+        out << lit;
+        WriteExprList(out, operands, kCommaSeparator, false, "(", ")");
+        break;
       case eOpType::Binary:
-        return "(" + operands[0].Codegen() + " " + lit + " " + operands[1].Codegen() + ")";
+        out << "(";
+        operands[0].Codegen(out);
+        out << " " << lit << " ";
+        operands[1].Codegen(out);
+        out << ")";
+        break;
       case eOpType::Postfix:
-        return "(" + operands[0].Codegen() + lit + ")";
+        out << "(";
+        operands[0].Codegen(out);
+        out << lit << ")";
+        break;
       case eOpType::Prefix:
-        return "(" + lit + operands[0].Codegen() + ")";
+        out << "(" << lit;
+        operands[0].Codegen(out);
+        out << ")";
+        break;
       default:
         throw cxx::UnknownEnumEntry<eOpType>();
     }
   }
+
+ private:
+  // Arguments are a single expression, with several arguments folded left by the comma operator.
+  static ClRes<Expr> FromCndCall(const Ast& ast) {
+    if (ast.At(0).TypeIsnt(eAst::kIdent))
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                              "Only named functions can be called in generated C."));
+    Expr call{eOpType::Call, ast.At(0).GetLiteral(), {}};
+    if (ast.At(1).children.empty()) return call;
+    const Ast* folded = &ast.At(1).At(0);
+    while (folded->TypeIs(eAst::kComma)) {
+      auto arg = FromCndAst(folded->At(1));
+      if (!arg) return arg;
+      call.operands.push_back(std::move(*arg));
+      folded = &folded->At(0);
+    }
+    auto first = FromCndAst(*folded);
+    if (!first) return first;
+    call.operands.push_back(std::move(*first));
+    std::reverse(call.operands.begin(), call.operands.end());
+    return call;
+  }
 };
 
-/// Models a C\C++ declaration appearing at the top level translation unit syntax. 
+/// Models a C\C++ declaration appearing at the top level translation unit syntax.
 ///   [syntax] ::= [decl-sequence]* | decl-block
 struct Decl {
   enum class eDeclType { Variable, Function, TypeAlias, Struct, Union, Enum, Class };
   eDeclType type{eDeclType::Variable};
   Str ident{""};  /// @brief Name of the declaration.
+  SymbolId symbol{kNoSymbol};  /// @brief Interned name of the declaration. Keys the code model's maps.
   Str type_name{""};  /// @brief Type of the declaration.
   Vec<codegen::Expr> init_exprs{};  /// @brief Initializer expressions for the declaration.
   Vec<codegen::Expr> args{};         /// @brief Arguments for function declarations.
   Vec<codegen::Expr> modifiers{};    /// @brief Modifiers for function declarations.
 
-  constexpr Str Codegen() const {
+  void Codegen(CodeWriter& out) const {
     switch (type) {
       case eDeclType::Variable:
-        return codegen::VariableDecl{codegen::VariableDecl::eInitType::Assignment, ident, type_name,
-                                     init_exprs.empty() ? "" : init_exprs[0].Codegen()}
-            .Codegen();
+        out << type_name << " " << ident << " = ";
+        if (!init_exprs.empty()) init_exprs[0].Codegen(out);
+        out << ";\n";
+        break;
       case eDeclType::Function:
-        return codegen::FnDecl{ident, type_name, args, modifiers}.Codegen();
+        WriteExprList(out, modifiers, " ", true);
+        out << type_name << " " << ident;
+        WriteExprList(out, args, kCommaSeparator, false, "(", ");\n");
+        break;
       case eDeclType::TypeAlias:
-        return "using " + ident + " = " + type_name + ";\n";
+        out << "using " << ident << " = " << type_name << ";\n";
+        break;
       case eDeclType::Struct:
-        return "struct " + ident + " {\n" + GenerateExprList(init_exprs) + "\n};\n";
+        WriteBlock(out, "struct ");
+        break;
       case eDeclType::Union:
-        return "union " + ident + " {\n" + GenerateExprList(init_exprs) + "\n};\n";
+        WriteBlock(out, "union ");
+        break;
       case eDeclType::Enum:
-        return "enum " + ident + " {\n" + GenerateExprList(init_exprs) + "\n};\n";
+        WriteBlock(out, "enum ");
+        break;
       case eDeclType::Class:
-        return "class " + ident + " {\n" + GenerateExprList(init_exprs) + "\n};\n";
+        WriteBlock(out, "class ");
+        break;
       default:
         throw cxx::UnknownEnumEntry<eDeclType>();
     }
   }
 
-  static constexpr Decl FromCndAst(const Ast& ast) {
-    Decl decl;
-    decl.ident = ast.GetLiteral();
-    decl.type_name = ast.At(0).GetLiteral();
-    if (ast.type == eAst::kVariableDecl) {
-      decl.type = eDeclType::Variable;
-      if (ast.children.size() > 1) {
-        decl.init_exprs.push_back(codegen::Expr::FromCndAst(ast.At(1)));
-      }
-    } else if (ast.type == eAst::kFunctionDecl) {
-      decl.type = eDeclType::Function;
-      for (const auto& arg : std::ranges::subrange(ast.children.cbegin() + 1, ast.children.cend())) {
-        decl.args.push_back(codegen::Expr::FromCndAst(arg));
-      }
-    } else if (ast.type == eAst::kTypeAlias) {
-      decl.type = eDeclType::TypeAlias;
-    } else if (ast.type == eAst::kStructDecl) {
-      decl.type = eDeclType::Struct;
-    } else if (ast.type == eAst::kUnionDecl) {
-      decl.type = eDeclType::Union;
-    } else if (ast.type == eAst::kEnumDecl) {
-      decl.type = eDeclType::Enum;
-    } else if (ast.type == eAst::kClassDecl) {
-      decl.type = eDeclType::Class;
+  // Writes '[keyword] [ident] {\n[init_exprs]\n};'.
+  void WriteBlock(CodeWriter& out, StrView keyword) const {
+    out << keyword << ident << " {\n";
+    WriteExprList(out, init_exprs);
+    out << "\n};\n";
+  }
+
+  /// Models a top level C& declaration. Only variable declarations with a definition can be generated so far.
+  static ClRes<Decl> FromCndAst(const Ast& ast) {
+    if (ast.TypeIsnt(eAst::kVariableDeclaration))
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(),
+          std::format("Declaration '{}' cannot be generated as C.", eAstToCStr(ast.type))));
+
+    // [modifiers] [type constraint] [ident] [definition]?
+    const Ast& ident = ast.At(2);
+    Decl decl{.type = eDeclType::Variable, .ident = ident.GetLiteral(), .symbol = ident.Symbol()};
+    const Opt<StrView> c_type = GetCTypeName(ast.At(1).type);
+    if (!c_type)
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(),
+          std::format("Type of variable '{}' cannot be generated as C.", decl.ident)));
+    for (const Ast& mod : ast.At(0).children) {
+      if (mod.TypeIs(eAst::kKwConst))
+        decl.type_name += "const ";
+      else if (mod.TypeIs(eAst::kKwStatic))
+        decl.type_name += "static ";
+      else
+        return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+            std::source_location::current(),
+            std::format("Modifier '{}' of variable '{}' cannot be generated as C.", mod.GetLiteral(), decl.ident)));
     }
+    decl.type_name += *c_type;
+    if (ast.children.size() < 4)
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(),
+          std::format("Variable '{}' must be defined to be generated as C.", decl.ident)));
+    auto init = Expr::FromCndAst(ast.At(3).At(0));
+    if (!init) return ClFail(init.Error());
+    decl.init_exprs.push_back(std::move(*init));
     return decl;
   }
-
 };
 
-
 // Variable
 struct VarDecl {
   enum class eInitType {
@@ -340,138 +399,127 @@ struct VarDecl {
                                                 ///        This primary expression must not end with a
                                                 ///        semicolon, codegen will insert a ';' if necessary.
 
-  constexpr Str Codegen() const {
+  void Codegen(CodeWriter& out) const {
     switch (init_type) {
       case eInitType::Declaration:
-        return type + " " + ident + ";\n";
+        out << type << " " << ident << ";\n";
+        break;
       case eInitType::BracketInit:
-        return type + " " + ident + "(" + init + ");\n";
+        out << type << " " << ident << "(" << init << ");\n";
+        break;
       case eInitType::BraceInit:
-        return type + " " + ident + "{" + init + "};\n";
+        out << type << " " << ident << "{" << init << "};\n";
+        break;
       case eInitType::Assignment:
-        return type + " " + ident + " = " + init + ";\n";
+        out << type << " " << ident << " = " << init << ";\n";
+        break;
       default:
         throw cxx::UnknownEnumEntry<eInitType>();
     }
   }
 };
 
-// Method
-struct FnDecl{
-  static constexpr Expr FromCndAst(const Ast& ast);
-  constexpr Str Codegen() const;
-};
+struct TrUnit {
+  Vec<Decl> decl_sequence;
+  FlatMap<SymbolId, Size> decls;  // Index in 'decl_sequence' of each declared name.
 
-// Class (and struct)
-struct ClassDecl {
-  static constexpr Expr FromCndAst(const Ast& ast);
-  constexpr Str Codegen() const;
-};
+  /// Declaration of 'name' in this unit, or null.
+  const Decl* Find(SymbolId name) const {
+    auto found = decls.find(name);
+    return found == decls.end() ? nullptr : &decl_sequence[found->second];
+  }
 
-struct TrUnit {
-  CodeModel* model_ptr;
-  std::vector<Decl> decl_sequence;
-  std::map<Str, FnDecl*> fns;
-  std::map<Str, ClassDecl*> types;
-  std::map<Str, VarDecl*> globals;
-
-  Str Codegen() const {
-    Str out{};
+  void Codegen(CodeWriter& out) const {
     for (const auto& decl : decl_sequence) {
-      out += decl.Codegen();
+      decl.Codegen(out);
     }
-    return out;
   }
 };
 
 struct CodeModel {
   std::map<Str, TrUnit> unitmap;
+  FlatMap<SymbolId, Str> decls;  // Key of the unit declaring each name.
 
-  // Maps : Function or TypeIdentity pointed to should be stored in a tr unit's storage. (most of the time)
-  std::map<Str, FnDecl*> fns;
-  std::map<Str, ClassDecl*> types;
-  std::map<Str, VarDecl*> globals;
-
-  static constexpr CodeModel FromCndAst(const Ast& ast,StrView tr) {
+  /// Models the top level declarations of the C& program 'ast' as the translation unit 'key'.
+  static ClRes<CodeModel> FromCndAst(const Ast& ast, StrView key) {
     CodeModel model{};
-    TrUnit& unit = model.unitmap[tr.data()];
-    unit.model_ptr = &model;
-
-    if (!(ast.TypeIs(eAst::kProcessDefinition) || ast.TypeIs(eAst::kLibraryDefinition))) 
-      throw std::exception("Expected process or library definition at the top of the AST.");
-
-    for (const auto& decl_ast : ast.children) {
-      switch (decl_ast.type) {
-        case eAst::kVariableDeclaration:
-          unit.decl_sequence.push_back(VarDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.globals[this_decl.ident] = &this_decl.As<VarDecl>();
-          model.globals[this_decl.ident] = unit.globals[this_decl.ident];
-          break;
-        case eAst::kMethodDeclaration:
-          unit.decl_sequence.push_back(FnDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.fns[this_decl.ident] = &this_decl.As<FnDecl>();
-          model.fns[this_decl.ident] = unit.fns[this_decl.ident];
-          break;
-        case eAst::kClassDeclaration:
-          unit.decl_sequence.push_back(ClassDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.types[this_decl.ident] = &this_decl.As<ClassDecl>();
-          model.types[this_decl.ident] = unit.types[this_decl.ident];
-          break;
-        default:
-          throw cxx::UnknownEnumEntry<eAst>();
-      }
-    }
+    auto append_res = model.AppendAst(ast, key);
+    if (!append_res) return ClFail(append_res.Error());
     return model;
   }
 
-  CompilerProcessResult<int> AppendAst(const Ast& ast) {
-    if (unitmap.find(tr.data()) == unitmap.end()) {
-      unitmap[tr.data()] = TrUnit{this};
-    }
-    TrUnit& unit = unitmap[tr.data()];
-    unit.model_ptr = this;
-    if (!(ast.TypeIs(eAst::kProcessDefinition) || ast.TypeIs(eAst::kLibraryDefinition))) 
-      throw std::exception("Expected process or library definition at the top of the AST.");
+  /// Appends the top level declarations of the C& program 'ast' to the translation unit 'key'. A name may only be
+  /// declared once in the whole model. On failure, the declarations before the failing one stay in the model.
+  ClRes<void> AppendAst(const Ast& ast, StrView key) {
+    if (ast.TypeIsnt(eAst::kProgram))
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                              "Expected a program at the top of the AST."));
+    TrUnit& unit = unitmap[Str{key}];
     for (const auto& decl_ast : ast.children) {
-      switch (decl_ast.type) {
-        case eAst::kVariableDeclaration:
-          unit.decl_sequence.push_back(VarDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.globals[this_decl.ident] = &this_decl.As<VarDecl>();
-          globals[this_decl.ident] = unit.globals[this_decl.ident];
-          break;
-        case eAst::kMethodDeclaration:
-          unit.decl_sequence.push_back(FnDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.fns[this_decl.ident] = &this_decl.As<FnDecl>();
-          fns[this_decl.ident] = unit.fns[this_decl.ident];
-          break;
-        case eAst::kClassDeclaration:
-          unit.decl_sequence.push_back(ClassDecl::FromCndAst(decl_ast));
-          auto& this_decl = unit.decl_sequence.back();
-          unit.types[this_decl.ident] = &this_decl.As<ClassDecl>();
-          types[this_decl.ident] = unit.types[this_decl.ident];
-          break;
-        default:
-          throw cxx::UnknownEnumEntry<eAst>();
-      }
+      auto decl = Decl::FromCndAst(decl_ast);
+      if (!decl) return ClFail(decl.Error());
+      if (!decls.try_emplace(decl->symbol, key).second)
+        return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+            std::source_location::current(), std::format("'{}' is already declared.", decl->ident)));
+      unit.decls[decl->symbol] = unit.decl_sequence.size();
+      unit.decl_sequence.push_back(std::move(*decl));
     }
+    return ClRes<void>{};
+  }
+
+  /// Declaration of 'name' in any translation unit, or null.
+  const Decl* Find(SymbolId name) const {
+    auto found = decls.find(name);
+    return found == decls.end() ? nullptr : unitmap.at(found->second).Find(name);
   }
 
-  /// Generates the code for all translation units in the model. 
+  /// Generates the code for all translation units in the model.
   /// Each produced translation unit will be associated with a string key. (usually indicates the output file path)
   Vec<Pair<Str,Str>> Codegen() const {
     Vec<Pair<Str, Str>> out;
     for (const auto& unit : unitmap) {
-      out.push_back(std::make_pair(unit.first, unit.second.Codegen()));
+      CodeWriter unit_out{};
+      unit.second.Codegen(unit_out);
+      out.push_back(std::make_pair(unit.first, unit_out.ToString()));
     }
     return out;
   }
-};
 
+  /// Generates the code of each translation unit straight into the stream returned by 'open_sink' for its key, so no
+  /// unit is held in memory whole. Returns false if a stream could not be written.
+  template <class OpenSinkT>
+    requires std::is_invocable_r_v<std::ostream&, OpenSinkT, const Str&>
+  bool Codegen(OpenSinkT&& open_sink) const {
+    for (const auto& unit : unitmap) {
+      CodeWriter unit_out{open_sink(unit.first)};
+      unit.second.Codegen(unit_out);
+      if (!unit_out.Flush()) return false;
+    }
+    return true;
+  }
+
+  /// Generates every translation unit into 'input.out_dir / key' on 'input.codegen_threads' threads. Units only read
+  /// the model, so they generate independently. The output files are appended to 'output.output_files' in key order,
+  /// whichever thread finished first. Files whose content did not change are not rewritten. The hashes of the outputs
+  /// are kept in a manifest in 'input.aux_dir', when one is set.
+  ClRes<CodeFilesReport> WriteUnits(const TrInput& input, TrOutput& output) const {
+    Vec<const TrUnit*> units{};
+    Vec<Path> paths{};
+    units.reserve(unitmap.size());
+    paths.reserve(unitmap.size());
+    for (const auto& [key, unit] : unitmap) {
+      units.push_back(&unit);
+      paths.push_back(input.out_dir / key);
+    }
+    const CodeFilesConfig config{
+        .threads = static_cast<unsigned>(std::max(input.codegen_threads, 0)),
+        .is_overwrite_allowed = input.is_overwrite_allowed,
+        .manifest = input.aux_dir.empty() ? Path{} : input.aux_dir / OutputManifest::kFileName,
+    };
+    return WriteCodeFiles(
+        paths, [&units](Size i, CodeWriter& out) { units[i]->Codegen(out); }, output.output_files, config);
+  }
+};
 
 }  // namespace codegen
 
@@ -17,6 +17,7 @@
 #pragma once
 // clang-format off
 #include "ccapi/CommonCppApi.hpp"
+#include "codegen/CodeWriter.hpp"
 // clang-format on
 namespace cnd::clang::codegen {
 
@@ -25,11 +26,6 @@ using std::string;
 using std::vector;
 using cstring = const char*;
 
-template <class T>
-concept iCodeGenerator = requires(std::add_const_t<std::add_lvalue_reference_t<T>> v) {
-  { v.Codegen() } -> std::same_as<std::string>;
-};
-
 template <class T>
 concept iConstReferenceWrapper = requires(std::add_const_t<std::add_lvalue_reference_t<T>> v) {
   { v.Get() } -> std::same_as<std::add_const_t<std::add_lvalue_reference_t<T>>>;
@@ -37,32 +33,6 @@ concept iConstReferenceWrapper = requires(std::add_const_t<std::add_lvalue_refer
 
 static constexpr const char* kCommaSeparator = ", ";
 
-static constexpr Str GenerateExprList(const vector<string>& exprs, const string& separator = kCommaSeparator,
-                                      bool separator_after_last = false, const string& open_with = "",
-                                      const string& close_with = "", const string& prefix = "") {
-  string ret = open_with;
-  if (exprs.size() > 1) {
-    for (auto arg_iter = exprs.cbegin(); arg_iter != std::prev(exprs.cend()); arg_iter++) {
-      ret += prefix + *arg_iter + separator;
-    }
-  }
-  if (not exprs.empty()) {
-    ret += prefix + exprs.back();
-  }
-  return ret + (separator_after_last ? separator : "") + close_with;
-}
-
-static constexpr Str GenerateExprList(vector<string>::const_iterator exprs_beg,
-                                      vector<string>::const_iterator exprs_end,
-                                      const string& separator = kCommaSeparator, bool separator_after_last = false,
-                                      const string& open_with = "", const string& close_with = "",
-                                      const string& prefix = "");
-
-struct Primitive {
-  ePrimitive type{ePrimitive::eValue};
-  Str tk{};
-};
-
 /// Categorizes the type of primary expression primitive. Indicates how to interpret a primitive's
 /// data points upon C code gen.
 enum class ePrimitive {
@@ -75,96 +45,52 @@ enum class ePrimitive {
   eCall,    // [0] ( [?...] )
 };
 
+struct Primitive {
+  ePrimitive type{ePrimitive::eValue};
+  Str tk{};
+};
+
 struct ValueExpression {
   ePrimitive type{ePrimitive::eValue};
   Vec<Primitive> prims{};
 
-  constexpr Str Codegen() const {
-    Str out{};
+  void Codegen(CodeWriter& out) const {
     for (auto it = prims.cbegin(), nxt = prims.cbegin() + 1; it != prims.cend(); it++) {
       if (it->type == ePrimitive::eValue) {
         // If followed by value then this to be a single value expression or else invalid code (operand following
         // operand). Also early return here if next is the end.
         if ((nxt != prims.cend() && nxt->type == ePrimitive::eValue) || nxt == prims.cend()) {
-          out += it->tk;
-          return out;
+          out << it->tk;
+          return;
         } else {
           continue;  // Handled the next iteration.
         }
       } else if (it->type == ePrimitive::ePre) {
         // If pre then this is a prefix operator.
-        out += it->tk + nxt->tk;
+        out << it->tk << nxt->tk;
         it++;  // Skip the next one as it was already processed.
       } else if (it->type == ePrimitive::ePost) {
         // If post then this is a postfix operator.
-        out += nxt->tk + it->tk;
+        out << nxt->tk << it->tk;
         it++;  // Skip the next one as it was already processed.
       } else if (it->type == ePrimitive::eBinary) {
         // If binary then this is a binary operator.
-        out += it->tk + nxt->tk;
+        out << it->tk << nxt->tk;
         it++;  // Skip the next one as it was already processed.
       } else if (it->type == ePrimitive::eCall) {
         // If call then this is a function call.
-        out += it->tk + "(";
+        out << it->tk << "(";
         for (auto arg_iter = nxt; arg_iter != prims.cend(); arg_iter++) {
-          out += arg_iter->tk;
+          out << arg_iter->tk;
           if (arg_iter + 1 != prims.cend()) {
-            out += ", ";
+            out << ", ";
           }
         }
-        out += ")";
-        return out;  // No need to continue, we are done with the call.
+        out << ")";
+        return;  // No need to continue, we are done with the call.
       }
     }
   };
-
-  static constexpr string GenerateExprList(const vector<string>& exprs, const string& separator = kCommaSeparator,
-                                           bool separator_after_last = false, const string& open_with = "",
-                                           const string& close_with = "", const string& prefix = "") {
-    string ret = open_with;
-    if (exprs.size() > 1) {
-      for (auto arg_iter = exprs.cbegin(); arg_iter != std::prev(exprs.cend()); arg_iter++) {
-        ret += prefix + *arg_iter + separator;
-      }
-    }
-    if (not exprs.empty()) {
-      ret += prefix + exprs.back();
-    }
-    return ret + (separator_after_last ? separator : "") + close_with;
-  }
-
-  static constexpr string GenerateExprList(const vector<std::reference_wrapper<const string>>& exprs,
-                                           const string& separator = kCommaSeparator, bool separator_after_last = false,
-                                           const string& open_with = "", const string& close_with = "",
-                                           const string& prefix = "") {
-    string ret = open_with;
-    if (exprs.size() > 1) {
-      for (auto arg_iter = exprs.cbegin(); arg_iter != std::prev(exprs.cend()); arg_iter++) {
-        ret += prefix + arg_iter->get() + separator;
-      }
-    }
-    if (not exprs.empty()) {
-      ret += prefix + exprs.back().get();
-    }
-    return ret + (separator_after_last ? separator : "") + close_with;
-  }
-
-  template <class T>
-    requires iCodeGenerator<T>
-  static constexpr string GenerateExprList(const vector<T>& exprs, const string& separator = kCommaSeparator,
-                                           bool separator_after_last = false, const string& open_with = "",
-                                           const string& close_with = "", const string& prefix = "") {
-    string ret = open_with;
-    if (exprs.size() > 1) {
-      for (auto arg_iter = exprs.cbegin(); arg_iter != std::prev(exprs.cend()); arg_iter++) {
-        ret += prefix + arg_iter->Codegen() + separator;
-      }
-    }
-    if (not exprs.empty()) {
-      ret += prefix + exprs.back().Codegen();
-    }
-    return ret + (separator_after_last ? separator : "") + close_with;
-  }
 };
 
 struct IncludeDirective {
@@ -177,14 +103,12 @@ struct IncludeDirective {
   IncludeType type{IncludeType::Quotes};  ///< The type of include directive
                                           ///< (Quotes or AngleBrackets).
 
-  /// @brief Code generation method.
-  ///
-  /// @return Generated include directive string.
-  CND_CX string Codegen() const {
+  /// @brief Code generation method. Writes the include directive.
+  void Codegen(CodeWriter& out) const {
     if (type == IncludeType::Quotes)
-      return "#include \"" + header + "\"\n";
+      out << "#include \"" << header << "\"\n";
     else
-      return "#include <" + header + ">\n";
+      out << "#include <" << header << ">\n";
   }
 };
 
@@ -198,11 +122,13 @@ struct MacroDefine {
                      ///        macro definition to output correct C++ code.
   vector<string> args{""};
 
-  CND_CX string Codegen() const {
+  void Codegen(CodeWriter& out) const {
     if (macro_type == eMacroType::Definition) {
-      return "#define " + ident + " " + def + "\n";
+      out << "#define " << ident << " " << def << "\n";
     } else {
-      return GenerateExprList(args, kCommaSeparator, false, "#define " + ident + "(", ") " + def + "\n");
+      out << "#define " << ident;
+      WriteExprList(out, args, kCommaSeparator, false, "(", ") ");
+      out << def << "\n";
     }
   }
 };
@@ -214,18 +140,11 @@ struct TemplateTypeParam {
   eTemplateType template_type{eTemplateType::Type};
   string type{""};      ///> The type if this is a value template.
   bool is_pack{false};  ///> True is this is a pack eg. <class...T>
-  CND_CX string Codegen() const {
+  void Codegen(CodeWriter& out) const {
     if (template_type == eTemplateType::Type)
-      if (is_pack)
-        return "class ... " + name;
-      else
-        return "class " + name;
-    else {  // eTemplateType::Value
-      if (is_pack)
-        return type + " ... " + name;
-      else
-        return type + " " + name;
-    }
+      out << (is_pack ? "class ... " : "class ") << name;
+    else  // eTemplateType::Value
+      out << type << (is_pack ? " ... " : " ") << name;
   }
 };
 
@@ -235,14 +154,14 @@ struct TemplateTypeParam {
 /// signature is generated: "template<>\n".
 struct TemplateSignature {
   vector<TemplateTypeParam> params{};
-  CND_CX string Codegen() const { return GenerateExprList(params, kCommaSeparator, false, "template<", ">"); }
+  void Codegen(CodeWriter& out) const { WriteExprList(out, params, kCommaSeparator, false, "template<", ">"); }
 };
 
 /// @brief Generates a template specialization, e.g., NAME<TYPE_LIST>
 struct TemplateSpecialization {
   string name;            /// @brief The name of the template being specialized
   vector<string> params;  /// @brief List of types for specialization
-  CND_CX string Codegen() const { return GenerateExprList(params, kCommaSeparator, false, "template<", ">"); }
+  void Codegen(CodeWriter& out) const { WriteExprList(out, params, kCommaSeparator, false, "template<", ">"); }
 };
 
 /// @brief Generates a variable declaration eg. int foo = 42;
@@ -263,16 +182,20 @@ struct VariableDecl {
                                                 ///        This primary expression must not end with a
                                                 ///        semicolon, codegen will insert a ';' if necessary.
 
-  CND_CX string Codegen() const {
+  void Codegen(CodeWriter& out) const {
     switch (init_type) {
       case eInitType::Declaration:
-        return type + " " + ident + ";\n";
+        out << type << " " << ident << ";\n";
+        break;
       case eInitType::BracketInit:
-        return type + " " + ident + "(" + init + ");\n";
+        out << type << " " << ident << "(" << init << ");\n";
+        break;
       case eInitType::BraceInit:
-        return type + " " + ident + "{" + init + "};\n";
+        out << type << " " << ident << "{" << init << "};\n";
+        break;
       case eInitType::Assignment:
-        return type + " " + ident + " = " + init + ";\n";
+        out << type << " " << ident << " = " << init << ";\n";
+        break;
       default:
         throw cxx::UnknownEnumEntry<eInitType>();
     }
@@ -292,14 +215,17 @@ struct UsingDecl {
                            ///        expression must not end with a semicolon, codegen
                            ///        will insert a ';' if necessary.
 
-  CND_CX string Codegen() const {
+  void Codegen(CodeWriter& out) const {
     switch (init_type) {
       case eTypedefType::Typealias:
-        return "using " + ident + " = " + init + ";\n";
+        out << "using " << ident << " = " << init << ";\n";
+        break;
       case eTypedefType::NamespaceExposition:
-        return "using namespace " + ident + ";\n";
+        out << "using namespace " << ident << ";\n";
+        break;
       case eTypedefType::DeclarationExposition:
-        return "using " + ident + ";\n";
+        out << "using " << ident << ";\n";
+        break;
       default:
         throw cxx::UnknownEnumEntry<eTypedefType>();
     }
@@ -316,17 +242,11 @@ struct EnumEntry {
   /// @param value Optional default value for the enum entry.
   EnumEntry(const string& name, optional<string> value = std::nullopt) : name(name), value(value) {}
 
-  /// @brief Code generation method.
-  ///
-  /// @return Generated enum entry string.
-  string Codegen() const {
+  /// @brief Code generation method. Writes the enum entry.
+  void Codegen(CodeWriter& out) const {
     assert(!name.empty() && "Enum entry name cannot be empty.");
-
-    if (value.has_value()) {
-      return name + " = " + value.value();
-    } else {
-      return name;
-    }
+    out << name;
+    if (value.has_value()) out << " = " << value.value();
   }
 };
 
@@ -336,15 +256,14 @@ struct EnumDecl {
   string type;                    /// @brief Type of the enum. Unspecified if none.
   bool is_scoped = false;         /// @brief If true, generate a scoped enum (enum class).
   vector<EnumEntry> enumerators;  /// @brief List of enumerators.
-  CND_CX string GetEnumDecl() const {
-    return (is_scoped ? "enum class " + name + " : " + type : "enum " + name + " : " + type);
-  }
+  void CodegenEnumDecl(CodeWriter& out) const { out << (is_scoped ? "enum class " : "enum ") << name << " : " << type; }
 
-  CND_CX string Codegen() const {
+  void Codegen(CodeWriter& out) const {
+    CodegenEnumDecl(out);
     if (enumerators.empty())
-      return GetEnumDecl() + ";\n";
+      out << ";\n";
     else
-      return GenerateExprList(enumerators, ",\n  ", false, GetEnumDecl() + " {\n  ", "\n};\n\n");
+      WriteExprList(out, enumerators, ",\n  ", false, " {\n  ", "\n};\n\n");
   }
 };
 
@@ -354,7 +273,10 @@ struct UnionMember {
   string type{};
   string name{};
   optional<string> default_init{std::nullopt};
-  CND_CX string Codegen() const { return type + " " + name + (default_init ? "{" + default_init.value() + "}" : ""); }
+  void Codegen(CodeWriter& out) const {
+    out << type << " " << name;
+    if (default_init) out << "{" << default_init.value() << "}";
+  }
 };
 
 /// @brief Generates a method parameter.
@@ -364,18 +286,11 @@ struct MethodParameter {
   std::optional<string> default_value;  /// @brief Default value initializer.
   bool is_pack = false;                 /// @brief If true, the parameter is a variadic pack.
 
-  CND_CX string Codegen() const {
-    string result = type + " ";
-    if (is_pack) {
-      result += "... ";
-    }
-    result += name;
-
-    if (default_value.has_value()) {
-      result += " = " + default_value.value();
-    }
-
-    return result;
+  void Codegen(CodeWriter& out) const {
+    out << type << " ";
+    if (is_pack) out << "... ";
+    out << name;
+    if (default_value.has_value()) out << " = " << default_value.value();
   }
 };
 
@@ -386,17 +301,12 @@ struct MethodDeclModifiers {
   bool is_noexcept{false};
   bool is_const{false};
 
-  CND_CX string GenPrefixMods() const {
-    string ret = (is_static ? "static " : "");
-    ret += (is_constexpr ? "constexpr " : "");
-    ret += (is_inline ? "inline " : "");
-    return ret;
+  void CodegenPrefixMods(CodeWriter& out) const {
+    out << (is_static ? "static " : "") << (is_constexpr ? "constexpr " : "") << (is_inline ? "inline " : "");
   }
 
-  CND_CX string GenPostfixMods() const {
-    string ret = (is_const ? "const " : "");
-    ret += (is_noexcept ? "noexcept " : "");
-    return ret;
+  void CodegenPostfixMods(CodeWriter& out) const {
+    out << (is_const ? "const " : "") << (is_noexcept ? "noexcept " : "");
   }
 };
 static constexpr MethodDeclModifiers kScxinMods = {true, true, true, false, false};
@@ -405,7 +315,7 @@ static constexpr MethodDeclModifiers kCxinMods = {true, false, true, false, fals
 struct MethodPostInitializer {
   string member{};
   string expr{};
-  string Codegen() const { return member + "(" + expr + ")"; }
+  void Codegen(CodeWriter& out) const { out << member << "(" << expr << ")"; }
 };
 
 /// @brief Represents a method declaration and optionally its definition.
@@ -423,31 +333,31 @@ struct MethodDecl {
 
   optional<string> comment_before;
   optional<string> comment_after;
-  CND_CX string Codegen() const {
-    return GenerateExprList(
-        params, kCommaSeparator, false,
-        [=]() {
-          return comment_before.value_or("") + (template_signature ? template_signature.value().Codegen() + "\n" : "") +
-                 mods.GenPrefixMods() +
-                 (template_specialization
-                      ? (return_type + " " + name +
-                         GenerateExprList(template_specialization.value(), kCommaSeparator, false, "<", ">("))
-                      : (return_type + " " + name + "("));
-        }(),
-        [=] {
-          string ret = ")" + mods.GenPostfixMods();
-          if (equal_to) {
-            ret += " = " + equal_to.value() + ";" + comment_after.value_or("") + "\n\n";
-            return ret;
-          } else {
-            if (not post_initializer.empty()) ret += GenerateExprList(post_initializer, kCommaSeparator, false, " : ");
-            if (definition)
-              ret += "{" + definition.value() + "}" + comment_after.value_or("") + "\n\n";
-            else
-              ret += ";\n";
-            return ret;
-          }
-        }());
+  void Codegen(CodeWriter& out) const {
+    out << comment_before.value_or("");
+    if (template_signature) {
+      template_signature.value().Codegen(out);
+      out << "\n";
+    }
+    mods.CodegenPrefixMods(out);
+    out << return_type << " " << name;
+    if (template_specialization)
+      WriteExprList(out, template_specialization.value(), kCommaSeparator, false, "<", ">(");
+    else
+      out << "(";
+    WriteExprList(out, params);
+
+    out << ")";
+    mods.CodegenPostfixMods(out);
+    if (equal_to) {
+      out << " = " << equal_to.value() << ";" << comment_after.value_or("") << "\n\n";
+      return;
+    }
+    if (not post_initializer.empty()) WriteExprList(out, post_initializer, kCommaSeparator, false, " : ");
+    if (definition)
+      out << "{" << definition.value() << "}" << comment_after.value_or("") << "\n\n";
+    else
+      out << ";\n";
   }
 };
 
@@ -455,8 +365,8 @@ struct MethodDecl {
 struct UnionDecl {
   struct UnionMemberVariant {
     std::variant<std::reference_wrapper<const UnionMember>, std::reference_wrapper<const MethodDecl>> member;
-    string Codegen() const {
-      return std::visit([](const auto& m) { return m.get().Codegen(); }, member);
+    void Codegen(CodeWriter& out) const {
+      std::visit([&out](const auto& m) { m.get().Codegen(out); }, member);
     }
   };
 
@@ -465,20 +375,21 @@ struct UnionDecl {
   vector<UnionMember> members;  /// @brief List of members in the union.
   vector<MethodDecl> methods;   ///@brief List of methods.
 
-  CND_CX string Codegen() const {
-    if (members.empty())
-      return "union " + name + ";\n";
-    else {
-      std::vector<UnionMemberVariant> all_members;
-      all_members.reserve(members.size() + methods.size());
-      for (const auto& m : members) {
-        all_members.push_back(UnionMemberVariant{std::ref(m)});
-      }
-      for (const auto& m : methods) {
-        all_members.push_back(UnionMemberVariant{std::ref(m)});
-      }
-      return GenerateExprList(all_members, ";\n", true, "union " + name + " {\n", "};\n", "  ");
+  void Codegen(CodeWriter& out) const {
+    if (members.empty()) {
+      out << "union " << name << ";\n";
+      return;
+    }
+    std::vector<UnionMemberVariant> all_members;
+    all_members.reserve(members.size() + methods.size());
+    for (const auto& m : members) {
+      all_members.push_back(UnionMemberVariant{std::ref(m)});
     }
+    for (const auto& m : methods) {
+      all_members.push_back(UnionMemberVariant{std::ref(m)});
+    }
+    out << "union " << name << " {\n";
+    WriteExprList(out, all_members, ";\n", true, "", "};\n", "  ");
   }
 };
 
@@ -489,28 +400,17 @@ struct ClassDecl {
   vector<MethodDecl> methods;       /// @brief List of methods in the class.
   vector<string> member_variables;  /// @brief List of member variables in the class.
 
-  CND_CX string Codegen() const {
-    string result = "class " + name;
-
-    if (base_class.has_value()) {
-      result += " : public " + base_class.value();
-    }
-
-    result += " {\npublic:\n";
-
-    // Generate member variables
-    for (const auto& member : member_variables) {
-      result += "    " + member + ";\n";
-    }
-
-    // Generate methods
+  void Codegen(CodeWriter& out) const {
+    out << "class " << name;
+    if (base_class.has_value()) out << " : public " << base_class.value();
+    out << " {\npublic:\n";
+    for (const auto& member : member_variables) out << "    " << member << ";\n";
     for (const auto& method : methods) {
-      result += "    " + method.Codegen() + ";\n";
+      out << "    ";
+      method.Codegen(out);
+      out << ";\n";
     }
-
-    result += "};\n";
-
-    return result;
+    out << "};\n";
   }
 };
 }  // namespace cnd::clang::codegen
@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Append only output sink of the code generators.
+///
+/// Generated code is appended to fixed size chunks, so text already written is never copied again as the output
+/// grows. Without a sink every chunk is kept and the output is read back with ToString. With a sink a single chunk is
+/// kept, and written to the sink whenever it fills, so memory use does not depend on the size of the output.
+///
+/// The writer indents every line which is started while an indentation is set. Empty lines are not indented.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <ostream>
+// clang-format on
+
+namespace cnd::clang::codegen {
+
+class CodeWriter {
+ public:
+  static constexpr Size kChunkSize = Size{64} << 10;
+  static constexpr Size kIndentWidth = 2;
+
+  CodeWriter() = default;
+  explicit CodeWriter(std::ostream& sink) : sink_(&sink) {}
+  CodeWriter(const CodeWriter&) = delete;
+  CodeWriter& operator=(const CodeWriter&) = delete;
+  ~CodeWriter() { Flush(); }
+
+  CodeWriter& Write(StrView text);
+  CodeWriter& operator<<(StrView text) { return Write(text); }
+  CodeWriter& operator<<(char c) { return Write(StrView{&c, 1}); }
+
+  template <std::integral T>
+    requires(!std::same_as<T, char> && !std::same_as<T, bool>)
+  CodeWriter& operator<<(T value) {
+    char digits[24];
+    const auto res = std::to_chars(std::begin(digits), std::end(digits), value);
+    return Write(StrView{digits, static_cast<Size>(res.ptr - digits)});
+  }
+
+  void Indent(Size width = kIndentWidth) noexcept { indent_ += width; }
+  void Dedent(Size width = kIndentWidth) noexcept { indent_ -= std::min(width, indent_); }
+  Size Indentation() const noexcept { return indent_; }
+
+  /// @brief Bytes written since construction, including the ones already passed to the sink.
+  Size WrittenBytes() const noexcept { return written_; }
+  /// @brief Bytes held by the writer which have not been passed to a sink.
+  Size BufferedBytes() const noexcept { return chunks_.empty() ? 0 : (chunks_.size() - 1) * kChunkSize + used_; }
+  Size PeakBufferedBytes() const noexcept { return peak_buffered_; }
+
+  /// @brief Pass buffered text to the sink. Returns false if the sink failed. Does nothing without a sink.
+  bool Flush();
+
+  /// @brief Buffered text as a single string. Without a sink this is the whole output.
+  Str ToString() const;
+
+  /// @brief Call 'fn(text)' for every chunk of buffered text, in order.
+  template <class FnT>
+  void ForEachBuffered(FnT&& fn) const {
+    for (Size i = 0; i < chunks_.size(); i++)
+      fn(StrView{chunks_[i].get(), i + 1 == chunks_.size() ? used_ : kChunkSize});
+  }
+
+ private:
+  Vec<std::unique_ptr<char[]>> chunks_{};
+  Size used_{0};  // Bytes used in the last chunk.
+  std::ostream* sink_{nullptr};
+  Size indent_{0};
+  bool is_line_start_{true};
+  Size written_{0};
+  Size peak_buffered_{0};
+
+  void Append(StrView text);
+};
+
+/// @brief Indents the lines started by a writer for the lifetime of the guard.
+class CodeIndentScope {
+ public:
+  explicit CodeIndentScope(CodeWriter& out, Size width = CodeWriter::kIndentWidth) noexcept
+      : out_(out), width_(width) {
+    out_.Indent(width_);
+  }
+  ~CodeIndentScope() noexcept { out_.Dedent(width_); }
+  CodeIndentScope(const CodeIndentScope&) = delete;
+  CodeIndentScope& operator=(const CodeIndentScope&) = delete;
+
+ private:
+  CodeWriter& out_;
+  Size width_;
+};
+
+/// @brief A model of some code which writes itself to a code writer.
+template <class T>
+concept iCodeGenerator = requires(std::add_const_t<std::add_lvalue_reference_t<T>> v, CodeWriter& out) {
+  { v.Codegen(out) } -> std::same_as<void>;
+};
+
+/// @brief Writes 'exprs' separated by 'separator', each preceded by 'prefix', between 'open_with' and 'close_with'.
+/// Elements are strings, or code generators which write themselves.
+template <class T>
+void WriteExprList(CodeWriter& out, const Vec<T>& exprs, StrView separator = ", ", bool separator_after_last = false,
+                   StrView open_with = "", StrView close_with = "", StrView prefix = "") {
+  out << open_with;
+  for (auto arg_iter = exprs.cbegin(); arg_iter != exprs.cend(); arg_iter++) {
+    if (arg_iter != exprs.cbegin()) out << separator;
+    out << prefix;
+    if constexpr (iCodeGenerator<T>)
+      arg_iter->Codegen(out);
+    else
+      out << StrView{*arg_iter};
+  }
+  if (separator_after_last) out << separator;
+  out << close_with;
+}
+
+inline CodeWriter& CodeWriter::Write(StrView text) {
+  static constexpr StrView kSpaces = "                                                                ";
+  while (!text.empty()) {
+    if (is_line_start_ && text.front() != '\n') {
+      for (Size pad = indent_; pad > 0; pad -= std::min(pad, kSpaces.size()))
+        Append(kSpaces.substr(0, std::min(pad, kSpaces.size())));
+    }
+    const Size eol = text.find('\n');
+    const Size line_size = eol == StrView::npos ? text.size() : eol + 1;
+    Append(text.substr(0, line_size));
+    is_line_start_ = eol != StrView::npos;
+    text.remove_prefix(line_size);
+  }
+  return *this;
+}
+
+// Text which would fill the single chunk of a writer with a sink goes to the sink, without being buffered if it is
+// larger than a chunk.
+inline void CodeWriter::Append(StrView text) {
+  written_ += text.size();
+  while (!text.empty()) {
+    if (chunks_.empty() || used_ == kChunkSize) {
+      if (sink_ != nullptr && !chunks_.empty()) {
+        Flush();
+        if (text.size() >= kChunkSize) {
+          sink_->write(text.data(), static_cast<std::streamsize>(text.size()));
+          return;
+        }
+      } else {
+        chunks_.push_back(std::make_unique_for_overwrite<char[]>(kChunkSize));
+        used_ = 0;
+      }
+    }
+    const Size n = std::min(text.size(), kChunkSize - used_);
+    std::memcpy(chunks_.back().get() + used_, text.data(), n);
+    used_ += n;
+    text.remove_prefix(n);
+    peak_buffered_ = std::max(peak_buffered_, BufferedBytes());
+  }
+}
+
+inline bool CodeWriter::Flush() {
+  if (sink_ == nullptr) return true;
+  if (!chunks_.empty()) sink_->write(chunks_.back().get(), static_cast<std::streamsize>(used_));
+  used_ = 0;
+  return sink_->good();
+}
+
+inline Str CodeWriter::ToString() const {
+  Str out{};
+  out.reserve(BufferedBytes());
+  ForEachBuffered([&out](StrView text) { out.append(text); });
+  return out;
+}
+
+}  // namespace cnd::clang::codegen
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
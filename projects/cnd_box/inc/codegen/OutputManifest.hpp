@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Content hashes of generated output files, kept between builds.
+///
+/// The manifest records the hash, size and modification time of every file the code generators wrote. An output whose
+/// size and modification time still match its entry is the file the compiler left, so its recorded hash stands for
+/// its content and the file is not read. Files without a matching entry are hashed from disk.
+///
+/// The manifest is a text file with one line per output: '[hash in hex] [size] [mtime] [path]'. A missing or
+/// unreadable manifest is empty, which only costs reading the existing outputs once.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include <fstream>
+#include <map>
+#include <sstream>
+// clang-format on
+
+namespace cnd::clang::codegen {
+
+/// @brief 64 bit FNV-1a hash of text, continued from 'hash'.
+constexpr UI64 HashCodeBytes(StrView text, UI64 hash = 0xCBF29CE484222325ull) noexcept {
+  for (char c : text) hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+  return hash;
+}
+
+/// @brief Hash of the file at 'path', or none if it could not be read.
+inline Opt<UI64> HashCodeFile(const Path& path) {
+  std::ifstream file{path, std::ios::binary};
+  if (!file) return std::nullopt;
+  UI64 hash = HashCodeBytes("");
+  char block[Size{64} << 10];
+  while (file) {
+    file.read(block, sizeof(block));
+    hash = HashCodeBytes(StrView{block, static_cast<Size>(file.gcount())}, hash);
+  }
+  if (file.bad()) return std::nullopt;
+  return hash;
+}
+
+struct OutputManifestEntry {
+  UI64 hash{0};
+  UI64 size{0};
+  I64 mtime{0};  ///> Ticks of the file clock at which the file was last written.
+
+  /// @brief Entry for the file at 'path' holding content of 'hash' and 'size'. Empty if the file does not exist.
+  static Opt<OutputManifestEntry> Stat(const Path& path, UI64 hash, UI64 size) {
+    std::error_code ec;
+    const auto mtime = stdfs::last_write_time(path, ec);
+    if (ec) return std::nullopt;
+    return OutputManifestEntry{hash, size, static_cast<I64>(mtime.time_since_epoch().count())};
+  }
+
+  /// @brief True if the file at 'path' has the size and modification time of this entry.
+  bool Matches(const Path& path) const {
+    std::error_code ec;
+    const auto file_size = stdfs::file_size(path, ec);
+    if (ec || file_size != size) return false;
+    const auto file_mtime = stdfs::last_write_time(path, ec);
+    return !ec && static_cast<I64>(file_mtime.time_since_epoch().count()) == mtime;
+  }
+};
+
+class OutputManifest {
+ public:
+  static constexpr StrView kFileName = "cnd_output_manifest.txt";
+
+  /// @brief Manifest saved at 'file'. Lines which do not parse are dropped.
+  static OutputManifest Load(const Path& file) {
+    OutputManifest manifest{};
+    std::ifstream in{file};
+    for (Str line; std::getline(in, line);) {
+      std::istringstream fields{line};
+      OutputManifestEntry entry{};
+      Str path{};
+      fields >> std::hex >> entry.hash >> std::dec >> entry.size >> entry.mtime;
+      fields.get();  // Space before the path, which may itself contain spaces.
+      std::getline(fields, path);
+      if (fields.fail() || path.empty()) continue;
+      manifest.entries_[path] = entry;
+    }
+    return manifest;
+  }
+
+  /// @brief Save to 'file', creating its directory. Returns false if it could not be written.
+  bool Save(const Path& file) const {
+    std::error_code ec;
+    if (file.has_parent_path()) stdfs::create_directories(file.parent_path(), ec);
+    std::ofstream out{file, std::ios::trunc};
+    for (const auto& [path, entry] : entries_)
+      out << std::hex << entry.hash << std::dec << ' ' << entry.size << ' ' << entry.mtime << ' ' << path << '\n';
+    return out.good();
+  }
+
+  const OutputManifestEntry* Find(const Path& output) const {
+    auto found = entries_.find(Key(output));
+    return found == entries_.end() ? nullptr : &found->second;
+  }
+
+  void Record(const Path& output, const OutputManifestEntry& entry) { entries_[Key(output)] = entry; }
+  Size Count() const noexcept { return entries_.size(); }
+
+ private:
+  std::map<Str, OutputManifestEntry> entries_{};  // Ordered, so saved manifests are stable.
+
+  static Str Key(const Path& output) {
+    std::error_code ec;
+    const Path absolute = stdfs::absolute(output, ec);
+    return (ec ? output : absolute).lexically_normal().generic_string();
+  }
+};
+
+}  // namespace cnd::clang::codegen
+
+/// @} // end of cnd_compiler
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Generates independent translation units into their output files on a pool of threads.
+///
+/// Each worker takes the next unit not yet taken and generates it into its own CodeWriter, so units of uneven size
+/// balance across the workers. The calling thread is one of the workers. Results are kept per unit and reported in
+/// the order the units were given, so the listed output files and the first error do not depend on scheduling.
+///
+/// Outputs are incremental. A unit is hashed once generated, and its file is only written when the existing file
+/// holds different content, so unchanged files keep their modification time and are not rebuilt downstream. Existing
+/// files are identified through an OutputManifest of the previous outputs, or by hashing them when it has no entry.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "codegen/CodeWriter.hpp"
+#include "codegen/OutputManifest.hpp"
+#include <atomic>
+#include <fstream>
+#include <thread>
+// clang-format on
+
+namespace cnd::clang::codegen {
+
+/// @brief Threads used when a thread count of 0 is requested.
+inline unsigned DefaultCodegenThreads() noexcept { return std::max(std::thread::hardware_concurrency(), 1u); }
+
+struct CodeFilesConfig {
+  unsigned threads{0};               ///> Threads generating units. 0 uses every core.
+  bool is_overwrite_allowed{false};  ///> Replace existing files which were not written by a previous build.
+  Path manifest{};                   ///> Manifest of previous outputs, updated after writing. Empty for none.
+};
+
+struct CodeFilesReport {
+  Size written{0};    ///> Files created or replaced.
+  Size unchanged{0};  ///> Files which already held the generated content and were left untouched.
+};
+
+/// @brief Calls 'write_unit(i, out)' for every 'paths[i]' on up to 'config.threads' threads, and writes the file at
+/// 'paths[i]' if its content changed. 'write_unit' is called concurrently and must only read shared state. On success
+/// every path, written or unchanged, is appended to 'output_files' in the order given. On failure the error of the
+/// first failed unit is returned and nothing is appended.
+template <class WriteUnitFnT>
+ClRes<CodeFilesReport> WriteCodeFiles(const Vec<Path>& paths, WriteUnitFnT&& write_unit, Vec<Path>& output_files,
+                                      const CodeFilesConfig& config = {}) {
+  const unsigned threads = config.threads == 0 ? DefaultCodegenThreads() : config.threads;
+  OutputManifest manifest = config.manifest.empty() ? OutputManifest{} : OutputManifest::Load(config.manifest);
+  Vec<ClRes<void>> results(paths.size());
+  Vec<Opt<OutputManifestEntry>> entries(paths.size());
+  Vec<char> is_written(paths.size(), 0);
+  std::atomic<Size> next_unit{0};
+
+  // Workers only read the manifest, their entries are recorded once all of them are done.
+  LAMBDA xWorker = [&]() {
+    for (Size i = next_unit++; i < paths.size(); i = next_unit++) {
+      const Path& path = paths[i];
+      CodeWriter out{};
+      write_unit(i, out);
+      UI64 hash = HashCodeBytes("");
+      out.ForEachBuffered([&hash](StrView text) { hash = HashCodeBytes(text, hash); });
+      const UI64 size = out.WrittenBytes();
+
+      std::error_code ec;
+      if (stdfs::exists(path, ec)) {
+        const OutputManifestEntry* previous = manifest.Find(path);
+        const bool is_previous_output = previous != nullptr && previous->Matches(path);
+        const bool is_unchanged = is_previous_output ? previous->hash == hash && previous->size == size
+                                                     : stdfs::file_size(path, ec) == size && HashCodeFile(path) == hash;
+        if (is_unchanged) {
+          entries[i] = OutputManifestEntry::Stat(path, hash, size);
+          continue;
+        }
+        if (!is_previous_output && !config.is_overwrite_allowed) {
+          results[i] = ClFail(MakeClMsg<eClErr::kDriverDeniedOverwrite>("generated code", path.string()));
+          continue;
+        }
+      }
+
+      std::ofstream file{path, std::ios::binary | std::ios::trunc};
+      out.ForEachBuffered(
+          [&file](StrView text) { file.write(text.data(), static_cast<std::streamsize>(text.size())); });
+      file.close();
+      if (file.fail()) {
+        results[i] = ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+            std::source_location::current(), "Cannot write output file: " + path.string()));
+        continue;
+      }
+      entries[i] = OutputManifestEntry::Stat(path, hash, size);
+      is_written[i] = 1;
+    }
+  };
+
+  Vec<std::thread> workers;
+  const Size worker_count = std::min<Size>(threads, paths.size());
+  if (worker_count > 1) workers.reserve(worker_count - 1);
+  for (Size w = 1; w < worker_count; w++) workers.emplace_back(xWorker);
+  xWorker();
+  for (auto& w : workers) w.join();
+
+  // Entries of units which succeeded are kept even if another failed, so their files are not rewritten next build.
+  CodeFilesReport report{};
+  for (Size i = 0; i < paths.size(); i++) {
+    if (entries[i]) manifest.Record(paths[i], *entries[i]);
+    if (results[i]) (is_written[i] ? report.written : report.unchanged)++;
+  }
+  if (!config.manifest.empty() && !manifest.Save(config.manifest))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), "Cannot write output manifest: " + config.manifest.string()));
+  for (auto& res : results)
+    if (!res) return ClFail(res.Error());
+  output_files.insert(output_files.end(), paths.cbegin(), paths.cend());
+  return report;
+}
+
+}  // namespace cnd::clang::codegen
+
+/// @} // end of cnd_compiler
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@
 #include "compiler/TranslationInput.hpp"
 #include "compiler/TranslationOutput.hpp"
 #include "hir/Compeval.hpp"
+#include "codegen/CLangCodeModel.hpp"
 // clang-format on
 
 namespace cnd {
@@ -33,6 +34,8 @@ class Compiler {
   ClRes<TrOutput> Translate() noexcept;
 
  private:
+  ClRes<void> GenerateCode() noexcept;
+
   const TrInput& input_;
   TrOutput output_;
   hir::TrUnit unit_{input_,output_};
@@ -42,9 +45,34 @@ class Compiler {
 ClRes<TrOutput> Compiler::Translate() noexcept {
   auto eval_res = unit_.Evaluate();
   if (!eval_res) return ClFail(eval_res.error());
+  if (!input_.out_dir.empty()) {
+    auto gen_res = GenerateCode();
+    if (!gen_res) return ClFail(gen_res.error());
+  }
   return output_;
 }
 
+// Generates a C translation unit, named after its source file, from the folded tree of each evaluated source file.
+// The units are written into the output directory in parallel.
+ClRes<void> Compiler::GenerateCode() noexcept {
+  clang::codegen::CodeModel model{};
+  for (const auto& src_file : input_.src_files) {
+    auto tree = unit_.trees.find(src_file.lexically_normal().string());
+    if (tree == unit_.trees.end()) continue;  // Not reached, the evaluation was terminated by an earlier file.
+    auto append_res = model.AppendAst(tree->second, src_file.stem().string() + ".c");
+    if (!append_res) return ClFail(append_res.Error());
+  }
+
+  std::error_code ec;
+  stdfs::create_directories(input_.out_dir, ec);
+  if (ec)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), "Cannot create output directory: " + input_.out_dir.string()));
+  auto write_res = model.WriteUnits(input_, output_);
+  if (!write_res) return ClFail(write_res.Error());
+  return ClRes<void>{};
+}
+
 }  // namespace trtools
 }  // namespace cnd
 
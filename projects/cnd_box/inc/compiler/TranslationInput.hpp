@@ -44,6 +44,8 @@ struct TrInput {
   Int opt_level{0};   ///> Optimization level.
   Int warn_level{0};  ///> Warning level.
 
+  Int codegen_threads{0};  ///> Threads generating output translation units. 0 uses every core.
+
   std::set<eClWarning> additional_enabled_warnings{};
   std::set<eClWarning> additional_ignored_warnings{};
 
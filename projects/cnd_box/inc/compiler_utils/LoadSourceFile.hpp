@@ -16,29 +16,21 @@
 #pragma once
 // clang-format off
 #include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/SourceManager.hpp"
+// clang-format on
 
 namespace cnd {
 namespace trtools {
 
 template <class SourceCharT>
 CompilerProcessResult<Vec<SourceCharT>> LoadSourceFile(std::string_view fp) {
-  using cldev::clmsg::MakeClMsg;
+  // One sized read, with room for the terminating \0 reserved up front.
+  Vec<SourceCharT> temp_file_buffer;
+  auto read_res = ReadSourceFileInto(fp, temp_file_buffer, 1);
+  if (!read_res) return CompilerProcessFailure(read_res.error());
 
-  if (!stdfs::exists(fp)) return CompilerProcessFailure(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Does not exist"));
-
-  if (!stdfs::is_regular_file(fp))
-    return CompilerProcessFailure(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Not a regular file."));
-
-  std::ifstream source_file_stream(fp.data());
-  if (!source_file_stream.is_open())
-    return CompilerProcessFailure(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Could not open file."));
-
-  Vec<SourceCharT> temp_file_buffer = Vec<SourceCharT>((std::istreambuf_iterator<SourceCharT>(source_file_stream)),
-                                                       std::istreambuf_iterator<SourceCharT>());
-  source_file_stream.close();
-
-  // Add \0 if not already at end.
-  if (temp_file_buffer.back() != '\0') temp_file_buffer.push_back('\0');
+  // Keep a single \0 if the file already ends with one.
+  if (*read_res > 0 && temp_file_buffer[*read_res - 1] == '\0') temp_file_buffer.pop_back();
 
   return temp_file_buffer;
 }
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Source Manager
+/// @ingroup cnd_compiler
+/// @brief Owns the bytes of every loaded source file and hands out stable views and file ids.
+///
+/// Each file is read with a single sized read into a buffer followed by kSourcePadding zero bytes. The padding
+/// terminates the source for the lexer, and lets vectorized scanners read a full block past the last char. Buffers
+/// are never moved or freed while the manager lives, so views and the ids stamped into Tk::file_ stay valid.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+// clang-format on
+
+namespace cnd {
+namespace trtools {
+
+/// Zero bytes placed after the text of every loaded source.
+inline constexpr Size kSourcePadding = 64;
+
+/// @brief Read the file at 'fp' with one sized read into 'out', followed by 'padding' zero chars.
+/// @return Size of the file in chars. 'out' holds at least that many chars plus the padding.
+template <class SourceCharT>
+ClRes<Size> ReadSourceFileInto(StrView fp, Vec<SourceCharT>& out, Size padding = 1) {
+  using cldev::clmsg::MakeClMsg;
+  std::error_code ec;
+  if (!stdfs::exists(fp, ec)) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Does not exist"));
+  if (!stdfs::is_regular_file(fp, ec)) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Not a regular file."));
+  const auto file_size = stdfs::file_size(fp, ec);
+  if (ec) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Could not query file size."));
+
+  std::ifstream source_file_stream(Str{fp}, std::ios::binary);
+  if (!source_file_stream.is_open()) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Could not open file."));
+
+  const Size char_count = static_cast<Size>(file_size) / sizeof(SourceCharT);
+  out.assign(char_count + padding, SourceCharT{0});
+  source_file_stream.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(file_size));
+  if (static_cast<Size>(source_file_stream.gcount()) != static_cast<Size>(file_size))
+    return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Could not read the whole file."));
+  return char_count;
+}
+
+/// @brief Loads and owns source files for a compilation.
+///
+/// File ids start at 1. Id 0 (kNoFile) is the default Tk::file_ and marks tokens without a source file, such as
+/// tokens lexed from generated or literal code.
+class SourceManager {
+ public:
+  using FileId = Size;
+  static constexpr FileId kNoFile = 0;
+
+  SourceManager() = default;
+  SourceManager(const SourceManager&) = delete;
+  SourceManager& operator=(const SourceManager&) = delete;
+  SourceManager(SourceManager&&) noexcept = default;
+  SourceManager& operator=(SourceManager&&) noexcept = default;
+
+  /// @brief Load the file at 'fp'. A path which was already loaded returns its existing id without reading again.
+  ClRes<FileId> Load(StrView fp) {
+    Str key = Path{fp}.lexically_normal().string();
+    if (auto found = ids_.find(key); found != ids_.end()) return found->second;
+
+    Vec<char> buffer;
+    auto read_res = ReadSourceFileInto(fp, buffer, kSourcePadding);
+    if (!read_res) return ClFail(read_res.error());
+
+    files_.push_back(UPtr<SourceFile>{new SourceFile{std::move(key), std::move(buffer), read_res.value()}});
+    const FileId id = files_.size();
+    ids_.emplace(files_.back()->path, id);
+    return id;
+  }
+
+  /// @brief Id of an already loaded path, or kNoFile.
+  FileId Find(StrView fp) const {
+    auto found = ids_.find(Path{fp}.lexically_normal().string());
+    return found == ids_.end() ? kNoFile : found->second;
+  }
+
+  /// @brief Source text, without the padding. The char one past the end is always '\0'.
+  StrView Text(FileId id) const {
+    const SourceFile& f = *files_[id - 1];
+    return StrView{f.buffer.data(), f.size};
+  }
+
+  /// @brief Normalized path the file was loaded from. The view is stable.
+  StrView PathOf(FileId id) const { return files_[id - 1]->path; }
+
+  Bool Contains(FileId id) const noexcept { return id != kNoFile && id <= files_.size(); }
+  Size Count() const noexcept { return files_.size(); }
+
+ private:
+  struct SourceFile {
+    Str path;
+    Vec<char> buffer;  ///> Text followed by kSourcePadding zero chars. Never resized after loading.
+    Size size;
+  };
+
+  Vec<UPtr<SourceFile>> files_{};  ///> Indexed by id - 1. Boxed so paths and buffers never move.
+  std::unordered_map<StrView, FileId> ids_{};
+};
+
+}  // namespace trtools
+}  // namespace cnd
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Symbol Table
+/// @ingroup cnd_compiler
+/// @brief Interns identifier literals and hands out 32 bit symbol ids.
+///
+/// The lexer interns every identifier it produces into the process wide table returned by Symbols(), and stamps the
+/// id into Tk::symbol_. Later stages key their name maps by SymbolId, so a name is hashed once, when it is lexed, and
+/// compared as an integer from then on. Names are copied into the table, ids and views stay valid while it lives.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include <mutex>
+#include <shared_mutex>
+// clang-format on
+
+namespace cnd {
+
+using SymbolId = UI32;
+
+/// Id 0 is the default Tk::symbol_ and marks tokens which are not identifiers, or which were lexed at compile time.
+inline constexpr SymbolId kNoSymbol = 0;
+
+/// @brief Thread safe identifier interner. Lexer threads intern concurrently, lookups of known names share a lock.
+class SymbolTable {
+ public:
+  SymbolTable() { names_.emplace_back(); }  // Reserve kNoSymbol.
+  SymbolTable(const SymbolTable&) = delete;
+  SymbolTable& operator=(const SymbolTable&) = delete;
+
+  /// @brief Id of 'name', which is added if it was not interned before.
+  SymbolId Intern(StrView name) {
+    {
+      std::shared_lock lock{mutex_};
+      if (auto found = ids_.find(name); found != ids_.end()) return found->second;
+    }
+    std::unique_lock lock{mutex_};
+    if (auto found = ids_.find(name); found != ids_.end()) return found->second;
+    const auto id = static_cast<SymbolId>(names_.size());
+    ids_.emplace(names_.emplace_back(name), id);
+    return id;
+  }
+
+  /// @brief Id of an already interned name, or kNoSymbol.
+  SymbolId Find(StrView name) const {
+    std::shared_lock lock{mutex_};
+    auto found = ids_.find(name);
+    return found == ids_.end() ? kNoSymbol : found->second;
+  }
+
+  /// @brief Interned name of a symbol. The view is stable.
+  StrView Name(SymbolId id) const {
+    std::shared_lock lock{mutex_};
+    return names_[id];
+  }
+
+  Size Count() const {
+    std::shared_lock lock{mutex_};
+    return names_.size() - 1;
+  }
+
+ private:
+  mutable std::shared_mutex mutex_{};
+  std::deque<Str> names_{};  ///> Indexed by id. A deque so interned names never move.
+  std::unordered_map<StrView, SymbolId> ids_{};
+};
+
+/// @brief Symbols of the compiler process.
+inline SymbolTable& Symbols() {
+  static SymbolTable table{};
+  return table;
+}
+
+}  // namespace cnd
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
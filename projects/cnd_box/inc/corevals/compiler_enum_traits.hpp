@@ -142,6 +142,7 @@ using corevals::grammar::IsTkPragmatic;
 using corevals::grammar::IsTkPrimary;
 using corevals::grammar::IsTkRScope;
 using corevals::grammar::IsTkRScopeOf;
+using corevals::grammar::IsTkTrivia;
 
 // eAst
 using corevals::grammar::eAstToCStr;
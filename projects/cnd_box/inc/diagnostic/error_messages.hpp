@@ -140,8 +140,8 @@ CND_MM_CLMSG_FORMAT_FNSIG(eClErr, kDriverDeniedOverwrite) {
       std::get<Str>(data[1]), std::get<Str>(data[0]));
 };
 
-CND_MM_CLMSG_MAKE_FNSIG(eClErr, kDriverDeniedOverwrite, StrView file, StrView flag) {
-  return {ClMsgNode{GetClMsgIdOf(THIS_MESSAGE_ENUM), {Str{file}, Str{flag}}}};
+CND_MM_CLMSG_MAKE_FNSIG(eClErr, kDriverDeniedOverwrite, StrView flag, StrView file) {
+  return {ClMsgNode{GetClMsgIdOf(THIS_MESSAGE_ENUM), {Str{flag}, Str{file}}}};
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,50 @@
 
 namespace cnd {
 
+/// @brief True if the node type is a literal terminal.
+constexpr bool IsAstLiteral(eAst type) noexcept {
+  switch (type) {
+    using enum eAst;
+    case kLitCstr:
+    case kLitInt:
+    case kLitUint:
+    case kLitBool:
+    case kLitReal:
+    case kLitChar:
+    case kLitByte:
+    case kKwNone:
+    case kKwTrue:
+    case kKwFalse:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// @brief True if the source literal of a node of this type carries meaning, and must be compared.
+constexpr bool IsAstLiteralSignificant(eAst type) noexcept {
+  switch (type) {
+    using enum eAst;
+    // Literal terminals
+    case kLitCstr:
+    case kLitInt:
+    case kLitUint:
+    case kLitBool:
+    case kLitReal:
+    case kLitChar:
+    case kLitByte:
+    case kKwNone:
+    case kKwTrue:
+    case kKwFalse:
+    case kIdent:
+    // Intermediates which store a literal value
+    case kEnumEntry:
+      return true;
+    default:
+      return false;
+  }
+}
+
 /// @brief C& source token structure.
 struct Ast {
   eAst type{};
@@ -66,7 +110,7 @@ struct Ast {
     return true;
   }
   static Str Format(const Ast& ast, std::size_t depth = 0) {
-    Str ret = std::format("{}[{},{}]\n", Str{"    ", depth}, eAstToCStr(ast.type), ast.GetLiteral());
+    Str ret = std::format("{}[{},{}]\n", Str(depth * 4, ' '), eAstToCStr(ast.type), ast.GetLiteral());
     depth++;
     for (const auto& node : ast.children) {
       ret += Format(node, depth);
@@ -114,46 +158,8 @@ struct Ast {
   Ast(eAst type, ChildTs... children) : type(type) {
     (PushBack(children), ...);
   }
-  constexpr bool IsLiteral() const noexcept {
-    switch (type) {
-      using enum eAst;
-      case kLitCstr:
-      case kLitInt:
-      case kLitUint:
-      case kLitBool:
-      case kLitReal:
-      case kLitChar:
-      case kLitByte:
-      case kKwNone:
-      case kKwTrue:
-      case kKwFalse:
-        return true;
-      default:
-        return false;
-    }
-  }
-  constexpr bool IsLiteralSignificant() const noexcept {
-    switch (type) {
-      using enum eAst;
-      // Literal terminals
-      case kLitCstr:
-      case kLitInt:
-      case kLitUint:
-      case kLitBool:
-      case kLitReal:
-      case kLitChar:
-      case kLitByte:
-      case kKwNone:
-      case kKwTrue:
-      case kKwFalse:
-      case kIdent:
-      // Intermediates which store a literal value
-      case kEnumEntry:
-        return true;
-      default:
-        return false;
-    }
-  }
+  constexpr bool IsLiteral() const noexcept { return IsAstLiteral(type); }
+  constexpr bool IsLiteralSignificant() const noexcept { return IsAstLiteralSignificant(type); }
   constexpr Str GetLiteral() const noexcept {
     if (src_begin != src_end) {
       Str ret;
@@ -169,6 +175,11 @@ struct Ast {
     return src_begin->literal_;
   }
 
+  /// Interned name of the node's first token. Tokens lexed at C++ compile time are interned on first use.
+  SymbolId Symbol() const {
+    return src_begin->symbol_ != kNoSymbol ? src_begin->symbol_ : Symbols().Intern(src_begin->literal_);
+  }
+
   constexpr void PushBack(Ast&& ast) { children.push_back(ast); }
   constexpr void PushBack(const Ast& ast) { children.push_back(ast); }
   constexpr void PushFront(Ast&& ast) { children.insert(children.begin(), ast); }
@@ -0,0 +1,295 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Ast Arena
+/// @ingroup cnd_compiler_data
+/// @brief Flat syntax tree storage. Nodes live in one contiguous array and link to each other by 32 bit index.
+///
+/// An Ast owns its children by value in a Vec<Ast>, so every node is a separate allocation and every push moves a
+/// whole subtree. Parent pointers into such a tree dangle once a sibling vector reallocates. An AstArena node is
+/// 32 bytes: the type, the parent, first child, last child and next sibling indices, the child count and a token
+/// range stored as offsets into the source token span. Adding a node is an append, and an index stays valid for the
+/// lifetime of the arena.
+///
+/// AstView is a non owning handle to one node which exposes the read side of the Ast interface.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler_data
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "use_corevals.hpp"
+#include "frontend/tk.hpp"
+#include "frontend/ast.hpp"
+// clang-format on
+
+namespace cnd {
+class AstView;
+
+class AstArena {
+ public:
+  using IndexT = UI32;
+  using TkConstIterT = std::span<const Tk>::const_iterator;
+  static constexpr IndexT kNone = std::numeric_limits<IndexT>::max();
+
+  struct Node {
+    eAst type{};
+    IndexT parent{kNone};
+    IndexT first_child{kNone};
+    IndexT last_child{kNone};
+    IndexT next_sibling{kNone};
+    IndexT child_count{0};
+    IndexT src_begin{0};  ///> Offset of the first source token.
+    IndexT src_end{0};    ///> Offset one past the last source token.
+  };
+
+  constexpr AstArena() noexcept = default;
+  constexpr explicit AstArena(std::span<const Tk> tokens) noexcept : tokens_{tokens} {}
+
+  /// @brief Flatten an existing tree. Every node of 'root' must reference 'tokens' or have an empty source range.
+  static constexpr AstArena FromAst(std::span<const Tk> tokens, const Ast& root) {
+    AstArena arena{tokens};
+    arena.Reserve(CountNodes(root));
+    arena.SetRoot(arena.Import(root));
+    return arena;
+  }
+
+  /// @brief Number of nodes in the tree rooted at 'ast'.
+  static constexpr Size CountNodes(const Ast& ast) noexcept {
+    Size count = 1;
+    for (const Ast& child : ast.children) count += CountNodes(child);
+    return count;
+  }
+
+  constexpr void Reserve(Size n) { nodes_.reserve(n); }
+
+  constexpr void Clear() noexcept {
+    nodes_.clear();
+    root_ = kNone;
+  }
+
+  /// @brief Append a node without a parent covering the tokens [src_begin, src_end).
+  constexpr IndexT Add(eAst type, IndexT src_begin, IndexT src_end) {
+    nodes_.push_back(Node{.type = type, .src_begin = src_begin, .src_end = src_end});
+    return static_cast<IndexT>(nodes_.size() - 1);
+  }
+
+  /// @brief Append a node without a parent. The iterators must point into the token span of this arena.
+  constexpr IndexT Add(eAst type, TkConstIterT src_begin, TkConstIterT src_end) {
+    if (src_begin == src_end) return Add(type, IndexT{0}, IndexT{0});
+    return Add(type, OffsetOf(src_begin), OffsetOf(src_end));
+  }
+
+  /// @brief Link 'child' as the last child of 'parent'. 'child' must not have a parent yet.
+  constexpr void AppendChild(IndexT parent, IndexT child) noexcept {
+    Node& p = nodes_[parent];
+    nodes_[child].parent = parent;
+    if (p.last_child == kNone)
+      p.first_child = child;
+    else
+      nodes_[p.last_child].next_sibling = child;
+    p.last_child = child;
+    p.child_count++;
+  }
+
+  /// @brief Copy the tree rooted at 'ast' into the arena, as the last child of 'parent' if one is given.
+  /// @return Index of the copied root.
+  constexpr IndexT Import(const Ast& ast, IndexT parent = kNone) {
+    const IndexT id = Add(ast.type, ast.src_begin, ast.src_end);
+    if (parent != kNone) AppendChild(parent, id);
+    for (const Ast& child : ast.children) Import(child, id);
+    return id;
+  }
+
+  /// @brief Rebuild a pointer tree from the subtree rooted at 'id'.
+  constexpr Ast Export(IndexT id) const {
+    const Node& n = nodes_[id];
+    Ast ast{n.type, SrcBegin(id), SrcEnd(id)};
+    ast.children.reserve(n.child_count);
+    for (IndexT c = n.first_child; c != kNone; c = nodes_[c].next_sibling) ast.PushBack(Export(c));
+    return ast;
+  }
+
+  constexpr void SetRoot(IndexT id) noexcept { root_ = id; }
+  constexpr IndexT RootId() const noexcept { return root_; }
+  constexpr AstView Root() const noexcept;
+  constexpr AstView View(IndexT id) const noexcept;
+
+  /* Properties */
+  constexpr Size Count() const noexcept { return nodes_.size(); }
+  constexpr Bool Empty() const noexcept { return nodes_.empty(); }
+  constexpr std::span<const Tk> Tokens() const noexcept { return tokens_; }
+  constexpr const Node& operator[](IndexT id) const noexcept { return nodes_[id]; }
+
+  /// @brief Bytes held by the node array, excluding the tokens.
+  constexpr Size ResidentBytes() const noexcept { return nodes_.capacity() * sizeof(Node); }
+
+  constexpr TkConstIterT SrcBegin(IndexT id) const noexcept { return tokens_.cbegin() + nodes_[id].src_begin; }
+  constexpr TkConstIterT SrcEnd(IndexT id) const noexcept { return tokens_.cbegin() + nodes_[id].src_end; }
+
+ private:
+  constexpr IndexT OffsetOf(TkConstIterT it) const noexcept {
+    return static_cast<IndexT>(std::to_address(it) - tokens_.data());
+  }
+
+  std::span<const Tk> tokens_{};  ///> Source tokens referenced by every node. Not owned.
+  Vec<Node> nodes_{};
+  IndexT root_{kNone};
+};
+
+/// @brief Read only handle to a node in an AstArena. Valid while the arena is alive and not cleared.
+class AstView {
+ public:
+  using IndexT = AstArena::IndexT;
+  using TkConstIterT = AstArena::TkConstIterT;
+
+  class ChildIterator {
+   public:
+    using value_type = AstView;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr ChildIterator() noexcept = default;
+    constexpr ChildIterator(const AstArena* arena, IndexT id) noexcept : arena_{arena}, id_{id} {}
+    constexpr AstView operator*() const noexcept { return AstView{*arena_, id_}; }
+    constexpr ChildIterator& operator++() noexcept {
+      id_ = (*arena_)[id_].next_sibling;
+      return *this;
+    }
+    constexpr ChildIterator operator++(int) noexcept {
+      ChildIterator prev = *this;
+      ++*this;
+      return prev;
+    }
+    constexpr bool operator==(const ChildIterator& o) const noexcept { return id_ == o.id_; }
+
+   private:
+    const AstArena* arena_{nullptr};
+    IndexT id_{AstArena::kNone};
+  };
+
+  class ChildRange {
+   public:
+    constexpr ChildRange(const AstArena* arena, IndexT first) noexcept : arena_{arena}, first_{first} {}
+    constexpr ChildIterator begin() const noexcept { return ChildIterator{arena_, first_}; }
+    constexpr ChildIterator end() const noexcept { return ChildIterator{arena_, AstArena::kNone}; }
+
+   private:
+    const AstArena* arena_;
+    IndexT first_;
+  };
+
+  constexpr AstView() noexcept = default;
+  constexpr AstView(const AstArena& arena, IndexT id) noexcept : arena_{&arena}, id_{id} {}
+
+  constexpr Bool Valid() const noexcept { return arena_ != nullptr && id_ != AstArena::kNone; }
+  constexpr IndexT Id() const noexcept { return id_; }
+  constexpr const AstArena& Arena() const noexcept { return *arena_; }
+
+  constexpr eAst Type() const noexcept { return Node().type; }
+  constexpr bool TypeIs(eAst ast_type) const noexcept { return Type() == ast_type; }
+  constexpr bool TypeIsnt(eAst ast_type) const noexcept { return Type() != ast_type; }
+  constexpr bool IsLiteral() const noexcept { return IsAstLiteral(Type()); }
+  constexpr bool IsLiteralSignificant() const noexcept { return IsAstLiteralSignificant(Type()); }
+
+  /// @brief The parent node, or an invalid view at the root.
+  constexpr AstView Parent() const noexcept { return AstView{*arena_, Node().parent}; }
+  constexpr Size ChildCount() const noexcept { return Node().child_count; }
+  constexpr ChildRange Children() const noexcept { return ChildRange{arena_, Node().first_child}; }
+
+  /// @brief The i-th child. Walks the sibling list, so prefer Children() when visiting every child.
+  constexpr AstView At(Size i) const noexcept {
+    IndexT c = Node().first_child;
+    while (i-- > 0) c = (*arena_)[c].next_sibling;
+    return AstView{*arena_, c};
+  }
+
+  constexpr TkConstIterT SrcBegin() const noexcept { return arena_->SrcBegin(id_); }
+  constexpr TkConstIterT SrcEnd() const noexcept { return arena_->SrcEnd(id_); }
+
+  constexpr Str GetLiteral() const noexcept {
+    Str ret;
+    for (const Tk& tk : std::ranges::subrange{SrcBegin(), SrcEnd()}) ret += tk.literal_;
+    return ret;
+  }
+
+  constexpr StrView RawLiteral() const noexcept { return SrcBegin()->literal_; }
+
+  /// @brief Copy the subtree into a pointer tree.
+  constexpr Ast ToAst() const { return arena_->Export(id_); }
+
+  /// @brief Same output as Ast::Format for the equivalent tree.
+  static Str Format(AstView ast, std::size_t depth = 0) {
+    Str ret = std::format("{}[{},{}]\n", Str(depth * 4, ' '), eAstToCStr(ast.Type()), ast.GetLiteral());
+    depth++;
+    for (AstView node : ast.Children()) ret += Format(node, depth);
+    return ret;
+  }
+  Str Format() const { return AstView::Format(*this); }
+
+  /// @brief Compares types, source literals and children, as Ast::CompareAst does.
+  constexpr static bool CompareAst(AstView node1, AstView node2) {
+    if (node1.Type() != node2.Type()) return false;
+    if (!std::equal(node1.SrcBegin(), node1.SrcEnd(), node2.SrcBegin(), node2.SrcEnd(),
+                    [](const Tk& a, const Tk& b) { return a.literal_ == b.literal_; }))
+      return false;
+    if (node1.ChildCount() != node2.ChildCount()) return false;
+    for (auto c1 = node1.Children().begin(), c2 = node2.Children().begin(); c1 != node1.Children().end(); ++c1, ++c2)
+      if (!CompareAst(*c1, *c2)) return false;
+    return true;
+  }
+
+  constexpr static bool CompareAst(AstView node1, const Ast& node2) {
+    if (node1.Type() != node2.type) return false;
+    if (!std::equal(node1.SrcBegin(), node1.SrcEnd(), node2.src_begin, node2.src_end,
+                    [](const Tk& a, const Tk& b) { return a.literal_ == b.literal_; }))
+      return false;
+    if (node1.ChildCount() != node2.children.size()) return false;
+    Size i = 0;
+    for (AstView child : node1.Children())
+      if (!CompareAst(child, node2.children[i++])) return false;
+    return true;
+  }
+
+  constexpr bool operator==(AstView other) const noexcept { return CompareAst(*this, other); }
+  constexpr bool operator==(const Ast& other) const noexcept { return CompareAst(*this, other); }
+
+ private:
+  constexpr const AstArena::Node& Node() const noexcept { return (*arena_)[id_]; }
+
+  const AstArena* arena_{nullptr};
+  IndexT id_{AstArena::kNone};
+};
+
+constexpr AstView AstArena::Root() const noexcept { return AstView{*this, root_}; }
+constexpr AstView AstArena::View(IndexT id) const noexcept { return AstView{*this, id}; }
+
+}  // namespace cnd
+
+/// @} // end of cnd_compiler_data
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
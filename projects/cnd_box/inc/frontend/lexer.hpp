@@ -19,6 +19,9 @@
 #include "compiler_utils/CompilerProcessResult.hpp"
 #include "grammar/eTk.hpp"
 #include "frontend/tk.hpp"
+#include "frontend/src_scan.hpp"
+#include "frontend/token_buffer.hpp"
+#include <thread>
 // clang-format on
 
 /// Set true to enable inline static unit tests during compiler development.
@@ -32,6 +35,8 @@ using cxx::IsInRange;     ///> For bounds-checking iterator as the lexer reads f
 using cxx::StrLiteral;    ///> To allow constexpr lexing and token string literals.
 using SrcView = StrView;  // Currently a string view but may allow to std::span to be more versatile.
 using SrcViewConstIter = StrView::const_iterator;  ///> Underlying data iterator type.
+using srcscan::eScanRun;  ///> Character class runs consumed with srcscan::ScanRun.
+using srcscan::ScanRun;   ///> Vectorized run scanning, scalar during constant evaluation.
 
 class Lexer;         ///> Functor-like class which encapsulates the lexing process.
 struct LexerCursor;  ///> Result of a successful intermediate lex step. Holds the processed token and read offset.
@@ -55,6 +60,7 @@ class Lexer {
  public:
   using LexerCursorT = LexerCursor;
   using LexerOutputT = Ex<Vec<Tk>, ClMsgBuffer>;       ///> Final output of lexed source chars.
+  using LexerCompactOutputT = Ex<TokenBuffer, ClMsgBuffer>;  ///> Final output in compact structure-of-arrays form.
   using LexerFailT = Unex<ClMsgBuffer>;                ///> Lexing failure value.
   using LexerResultT = Ex<LexerCursorT, ClMsgBuffer>;  ///> Intermediate lex step result union.
   using CppSrcLocT = std::source_location;             ///> C++ source location.
@@ -63,6 +69,17 @@ class Lexer {
   constexpr LexerOutputT Process(StrView src_str) noexcept;
   static constexpr LexerOutputT Lex(StrView s) noexcept;
   static constexpr Vec<Tk> Sanitize(const Vec<Tk>& output_tokens) noexcept;
+  constexpr LexerCompactOutputT ProcessCompact(StrView src_str, Size file = 0) noexcept;
+  static constexpr LexerCompactOutputT LexCompact(StrView s, Size file = 0) noexcept;
+  static constexpr Vec<Tk> Sanitize(const TokenBuffer& output_tokens) noexcept;
+  constexpr LexerOutputT ProcessSanitized(StrView src_str, Size file = 0) noexcept;
+  static constexpr LexerOutputT LexSanitized(StrView s, Size file = 0) noexcept;
+  LexerOutputT ProcessParallel(StrView src_str, unsigned threads) noexcept;
+  static LexerOutputT LexParallel(StrView s, unsigned threads = std::thread::hardware_concurrency()) noexcept;
+  static Vec<Size> FindParallelSplits(StrView s, Size max_chunks) noexcept;
+
+  /// Chunks smaller than this are not worth a thread. FindParallelSplits never proposes a smaller chunk.
+  static constexpr Size kParallelMinChunkSize = Size{1} << 16;
  public:  // Intermediate lexing methods. Only access for testing or exceptional cases.
   constexpr LexerResultT LexNumber(StrView src_str) noexcept;
   constexpr LexerResultT LexIdentifier(StrView src_str) noexcept;
@@ -78,6 +95,10 @@ class Lexer {
   constexpr Size& AdvanceLine(const StrView::const_iterator& from, const StrView::const_iterator& to) noexcept;
   constexpr Size& AdvanceCol(const StrView::const_iterator& from, const StrView::const_iterator& to) noexcept;
 
+  /// Lex 's' and pass each token to 'emit' in order. Shared by all output forms of Process.
+  template <class EmitT>
+  constexpr Ex<void, ClMsgBuffer> ProcessWith(StrView s, EmitT&& emit) noexcept;
+
  private:
   Size curr_line_{0};      ///> Used to maintain line count across intermediate lexing methods.
   Size curr_col_{0};       ///> Used to maintain column count across intermediate lexing methods.
@@ -132,6 +153,18 @@ constexpr Lexer::LexerOutputT Lexer::Lex(StrView s) noexcept {
   return lx.Process(s);
 }
 
+constexpr Lexer::LexerCompactOutputT Lexer::LexCompact(StrView s, Size file) noexcept {
+  Lexer lx;
+  return lx.ProcessCompact(s, file);
+}
+
+/// @brief Lex and sanitize in a single pass. Trivia tokens are scanned but never stored, so no intermediate
+/// token vector is built. Equivalent to Sanitize(Lex(s)).
+constexpr Lexer::LexerOutputT Lexer::LexSanitized(StrView s, Size file) noexcept {
+  Lexer lx;
+  return lx.ProcessSanitized(s, file);
+}
+
 constexpr LexerCursor::LexerCursor(StrView read_head, eTk tk, StrView literal) noexcept
     : read_head(read_head), processed_tk(tk, literal) {}
 
@@ -145,7 +178,7 @@ constexpr LexerCursor::LexerCursor(eTk tk, const StrView& s, StrView::const_iter
                                    StrView::const_iterator lit_end)
     : processed_tk(tk, StrView{s.data() + std::distance(s.begin(), lit_begin),
                                static_cast<Size>(std::distance(s.begin(), lit_end))}),
-      read_head(StrView{s.data() + std::distance(s.begin(), lit_end)}) {}
+      read_head(s.substr(static_cast<Size>(std::distance(s.begin(), lit_end)))) {}
 
 constexpr LexerCursor::LexerCursor(eTk tk, const StrView& s, StrView::const_iterator lit_begin,
                                    StrView::const_iterator lit_end, Size beg_line, Size beg_col, Size end_line,
@@ -154,7 +187,7 @@ constexpr LexerCursor::LexerCursor(eTk tk, const StrView& s, StrView::const_iter
           tk,
           StrView{s.data() + std::distance(s.begin(), lit_begin), static_cast<Size>(std::distance(s.begin(), lit_end))},
           beg_line, beg_col, end_line, end_col),
-      read_head(StrView{s.data() + std::distance(s.begin(), lit_end)}) {}
+      read_head(s.substr(static_cast<Size>(std::distance(s.begin(), lit_end)))) {}
 
 constexpr LexerCursor::LexerCursor() noexcept = default;
 
@@ -182,7 +215,7 @@ constexpr Lexer::LexerResultT Lexer::LexNumber(StrView s) noexcept {
     if (IsInRange(next(c), s) && *next(c) == 'b')
       return LexerCursor(eTk::kLitBool, s, c, next(c, 2), curr_line_, curr_col_, curr_line_, AdvanceCol(c, next(c, 2)));
 
-  while (IsInRange(c, s) && IsSrcCharNumeric(*c)) c++;  // Consume the decimal digits.
+  c = ScanRun<eScanRun::kNumeric>(s, c);  // Consume the decimal digits.
 
   if (!IsInRange(c, s))  // Unlikely. If at eof and return int.
     return LexerCursor(eTk::kLitInt, s, beg, c, curr_line_, curr_col_, curr_line_, AdvanceCol(beg, c));
@@ -203,7 +236,7 @@ constexpr Lexer::LexerResultT Lexer::LexNumber(StrView s) noexcept {
 
   if ((IsInRange(c, s) && *c == '.')) {                   // Read in decimal digits if a period is found.
     c++;                                                  // Skip '.'
-    while (IsInRange(c, s) && IsSrcCharNumeric(*c)) c++;  // Consume the fractional digits.
+    c = ScanRun<eScanRun::kNumeric>(s, c);  // Consume the fractional digits.
 
     if (IsInRange(c, s) && *c == 'f') {
       return LexerCursor(eTk::kLitReal, s, beg, ++c, curr_line_, curr_col_, AdvanceCol(beg, c),
@@ -225,11 +258,10 @@ constexpr Lexer::LexerResultT Lexer::LexNumber(StrView s) noexcept {
 
 constexpr Lexer::LexerResultT Lexer::LexIdentifier(StrView s) noexcept {
   using std::distance;
-  auto c = s.begin();
-  while (IsInRange(c, s) && IsSrcCharAlnumus(*c)) c++;
+  auto c = ScanRun<eScanRun::kAlnumus>(s, s.begin());
 
-  // Todo: optimization, if id_size is not any of keyword sizes, can skip
-  // keyword check.
+  // Identifiers longer than any keyword, or without a keyword of the same length and first char, are rejected
+  // by GetTkFromKeyword without a string compare.
   eTk etk = GetTkFromKeyword(s.substr(0, static_cast<Size>(distance(s.begin(), c))));
 
   if (etk != eTk::kNONE) return LexerCursor(etk, s, s.begin(), c);
@@ -253,7 +285,10 @@ constexpr Lexer::LexerResultT Lexer::LexIdentifier(StrView s) noexcept {
   //  return OffsetLexRes{tk, crsr};
   //}
 
-  return LexerCursor(eTk::kIdent, s, s.begin(), c);
+  LexerCursor ident(eTk::kIdent, s, s.begin(), c);
+  // Tokens lexed at C++ compile time have no symbol, the table only exists at runtime.
+  if (!std::is_constant_evaluated()) ident.processed_tk.SetSymbol(Symbols().Intern(ident.processed_tk.Literal()));
+  return ident;
 }
 
 constexpr Lexer::LexerResultT Lexer::LexPunctuator(StrView s) noexcept {
@@ -399,7 +434,7 @@ constexpr Lexer::LexerResultT Lexer::LexWhitespace(StrView s) noexcept {
     return LexerFailT{MakeClMsg<eClErr::kCompilerDevDebugError>(CppSrcLocT{}, " Opening char is not whitespace.")};
 #endif
 
-  while (IsInRange(c, s) && IsSrcCharWhitespace(*c)) c++;
+  c = ScanRun<eScanRun::kWhitespace>(s, c);
   return LexerCursor(eTk::kWhitespace, s, s.begin(), c);
 }
 
@@ -415,7 +450,7 @@ constexpr Lexer::LexerResultT Lexer::LexNewline(StrView s) noexcept {
     return LexerFailT{MakeClMsg<eClErr::kCompilerDevDebugError>(CppSrcLocT{}, " Opening char is not a newline.")};
 #endif
 
-  while (IsInRange(c, s) && IsSrcCharNewline(*c)) c++;
+  c = ScanRun<eScanRun::kNewline>(s, c);
   curr_line_ += std::distance(s.begin(), c);  // increment line count
   return LexerCursor(eTk::kNewline, s, s.begin(), c);
 }
@@ -460,9 +495,7 @@ constexpr Lexer::LexerResultT Lexer::LexLineComment(StrView s) noexcept {
         MakeClMsg<eClErr::kCompilerDevDebugError>(CppSrcLocT::current(), " Opening char is not a backtick.")};
 #endif
   c++;
-  while (IsInRange(c, s) && !IsSrcCharNewline(*c)) {
-    c++;
-  }
+  c = ScanRun<eScanRun::kNotNewline>(s, c);
 
   return LexerCursor(eTk::kLineComment, s, s.begin(), c);
 }
@@ -485,8 +518,8 @@ constexpr Lexer::LexerResultT Lexer::LexBlockComment(StrView s) noexcept {
         MakeClMsg<eClErr::kCompilerDevDebugError>(CppSrcLocT::current(), " Opening char is not a backtick.")};
 #endif
   std::advance(c,2); // pass "/`"
-  while (IsInRange(c, s)) {
-    // Check for end of block.
+  while (IsInRange(c = ScanRun<eScanRun::kNotBacktick>(s, c), s)) {
+    // Check for end of block. The scan stops only on a backtick.
     if (*c == '`') {
       if (!IsInRange(next(c), s))
         return LexerFailT{
@@ -534,61 +567,211 @@ constexpr Lexer::LexerResultT Lexer::LexRecursiveTokenLiteral(StrView s) noexcep
 }
 
 constexpr Lexer::LexerOutputT Lexer::Process(StrView s) noexcept {
+  Vec<Tk> tokens;
+  auto res = ProcessWith(s, [&tokens](const Tk& tk) constexpr { tokens.push_back(tk); });
+  if (!res) return LexerFailT{res.error()};
+  return tokens;
+}
+
+constexpr Lexer::LexerCompactOutputT Lexer::ProcessCompact(StrView s, Size file) noexcept {
+  TokenBuffer tokens{s, file};
+  auto res = ProcessWith(s, [&tokens](const Tk& tk) constexpr { tokens.PushBack(tk); });
+  if (!res) return LexerFailT{res.error()};
+  return tokens;
+}
+
+constexpr Lexer::LexerOutputT Lexer::ProcessSanitized(StrView s, Size file) noexcept {
+  Vec<Tk> tokens;
+  auto res = ProcessWith(s, [&tokens, file](const Tk& tk) constexpr {
+    if (IsTkTrivia(tk.Type())) return;
+    tokens.push_back(tk);
+    tokens.back().SetFile(file);
+  });
+  if (!res) return LexerFailT{res.error()};
+  return tokens;
+}
+
+inline Lexer::LexerOutputT Lexer::LexParallel(StrView s, unsigned threads) noexcept {
+  Lexer lx;
+  return lx.ProcessParallel(s, threads);
+}
+
+/// @brief Split points for lexing 's' in at most 'max_chunks' independent chunks.
+/// @return Offsets of the chunk starts followed by s.size(). Always holds at least {0, s.size()}.
+///
+/// A split is only placed directly after a newline, before a non-whitespace char and outside of any line comment,
+/// block comment or string literal. Every such offset is the start of a token in the serial lex, so each chunk lexes
+/// to exactly the tokens the serial lex produces for that range. The pre-scan mirrors the opening and closing rules of
+/// LexLineComment, LexBlockComment and LexEscapedCharSequence.
+inline Vec<Size> Lexer::FindParallelSplits(StrView s, Size max_chunks) noexcept {
+  Vec<Size> splits{0};
+  const Size chunks = std::min(max_chunks, s.size() / kParallelMinChunkSize);
+  if (chunks > 1) {
+    const char* const beg = s.data();
+    const char* const end = s.data() + s.size();
+    const char* it = beg;
+    Size next_target = s.size() / chunks;
+    while (it != end && splits.size() < chunks) {
+      if (*it == '`') {  // Line comment, ends before the next newline.
+        it = ScanRun<eScanRun::kNotNewline>(it + 1, end);
+      } else if (*it == '/' && it + 1 != end && it[1] == '`') {  // Block comment, ends after "`/".
+        it += 2;
+        while ((it = ScanRun<eScanRun::kNotBacktick>(it, end)) != end && !(it + 1 != end && it[1] == '/')) it++;
+        it = it == end ? end : it + 2;
+      } else if (*it == '"') {  // String literal, ends on an unescaped quote or a quote after an escaped backslash.
+        const char* open = it++;
+        while (it != end && !(*it == '"' && (it[-1] != '\\' || (it - 2 >= open && it[-2] == '\\')))) it++;
+        if (it != end) it++;
+      } else {
+        if (*it == '\n' && it + 1 != end && static_cast<Size>(it + 1 - beg) >= next_target &&
+            !IsSrcCharWhitespace(it[1])) {
+          splits.push_back(static_cast<Size>(it + 1 - beg));
+          next_target = splits.back() + s.size() / chunks;
+        }
+        it++;
+      }
+    }
+  }
+  splits.push_back(s.size());
+  return splits;
+}
+
+/// @brief Lex 's' on up to 'threads' threads. The output is identical to Process(s).
+///
+/// The source is split with FindParallelSplits and every chunk is lexed by its own Lexer. The line and column counters
+/// are only advanced by newline and number tokens, so the counters at the start of each chunk are the prefix sums of
+/// the preceding chunks. Number tokens, the only ones stamped from the counters, are then lexed again from the
+/// corrected counters. The remaining tokens are copied as is.
+inline Lexer::LexerOutputT Lexer::ProcessParallel(StrView s, unsigned threads) noexcept {
+  const StrView src = s.substr(0, s.find('\0'));  // Serial lexing ends at the first '\0' too.
+  const Vec<Size> splits = FindParallelSplits(src, std::max(threads, 1u));
+  if (splits.size() <= 2) return Process(s);
+  const Size chunk_count = splits.size() - 1;
+
+  struct ChunkResult {
+    Vec<Tk> tokens{};
+    Size line_delta{0};
+    Size col_delta{0};
+    Size line_start{0};
+    Size col_start{0};
+    Size out_offset{0};
+    Ex<void, ClMsgBuffer> status{};
+  };
+  Vec<ChunkResult> chunks(chunk_count);
+
+  // Run fn(k) for every chunk, chunk 0 on the calling thread.
+  LAMBDA xForEachChunk = [chunk_count](auto&& fn) {
+    Vec<std::thread> workers;
+    workers.reserve(chunk_count - 1);
+    for (Size k = 1; k < chunk_count; k++) workers.emplace_back(fn, k);
+    fn(Size{0});
+    for (auto& w : workers) w.join();
+  };
+
+  // Lex every chunk from zeroed counters.
+  xForEachChunk([&](Size k) {
+    Lexer lx;
+    ChunkResult& chunk = chunks[k];
+    chunk.tokens.reserve((splits[k + 1] - splits[k]) / 4);  // Rough tokens per byte of typical source.
+    chunk.status = lx.ProcessWith(src.substr(splits[k], splits[k + 1] - splits[k]),
+                                  [&chunk](const Tk& tk) { chunk.tokens.push_back(tk); });
+    chunk.line_delta = lx.curr_line_;
+    chunk.col_delta = lx.curr_col_;
+  });
+
+  Size token_count = 0;
+  for (Size k = 0; k < chunk_count; k++) {
+    if (!chunks[k].status) return LexerFailT{chunks[k].status.error()};  // First error in source order.
+    if (k > 0) {
+      chunks[k].line_start = chunks[k - 1].line_start + chunks[k - 1].line_delta;
+      chunks[k].col_start = chunks[k - 1].col_start + chunks[k - 1].col_delta;
+    }
+    chunks[k].out_offset = token_count;
+    token_count += chunks[k].tokens.size();
+  }
+
+  // The first chunk already starts from zeroed counters and becomes the front of the output. The others restamp their
+  // number tokens from the corrected counters and move into place behind it.
+  Vec<Tk> tokens = std::move(chunks[0].tokens);
+  tokens.resize(token_count);
+  xForEachChunk([&](Size k) {
+    if (k == 0) return;
+    ChunkResult& chunk = chunks[k];
+    Lexer lx;
+    lx.curr_line_ = chunk.line_start;
+    lx.curr_col_ = chunk.col_start;
+    const bool is_restamped = chunk.line_start != 0 || chunk.col_start != 0;
+    for (Size i = 0; i < chunk.tokens.size(); i++) {
+      Tk& tk = chunk.tokens[i];
+      if (is_restamped && tk.TypeIs(eTk::kNewline)) {
+        lx.curr_line_ += tk.Literal().size();
+      } else if (is_restamped && !tk.Literal().empty() && IsSrcCharNumeric(tk.Literal()[0])) {
+        const StrView rest{tk.Literal().data(), static_cast<Size>(src.data() + src.size() - tk.Literal().data())};
+        if (auto relexed = lx.LexNumber(rest)) tk = relexed->processed_tk;
+      }
+      tokens[chunk.out_offset + i] = std::move(tk);
+    }
+  });
+  return tokens;
+}
+
+template <class EmitT>
+constexpr Ex<void, ClMsgBuffer> Lexer::ProcessWith(StrView s, EmitT&& emit) noexcept {
   if (s.empty()) return LexerFailT{MakeClMsg<eClErr::kCompilerDevDebugError>(CppSrcLocT{}, "Cannot lex empty source.")};
-  read_head_ = s;
+  // Sources are loaded with a terminating '\0', lexing ends at the first one.
+  read_head_ = s.substr(0, s.find('\0'));
   curr_line_ = 0;
   curr_col_ = 0;
-  Vec<Tk> tokens;
   auto it = read_head_.begin();
   while (read_head_ != "") {
     // Newline initial
     if (IsSrcCharNewline(read_head_[0])) {
       auto res_buff = LexNewline(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // Whitespace initial
     } else if (IsSrcCharSpace(read_head_[0])) {
       auto res_buff = LexWhitespace(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // AlphaUnderscore initial
     } else if (IsSrcCharAlphaUnderscore(read_head_[0])) {
       auto res_buff = LexIdentifier(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // Numeric initial
     } else if (IsSrcCharNumeric(read_head_[0])) {
       auto res_buff = LexNumber(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // Punctuator initial
     } else if (read_head_[0] == '"') {
       auto res_buff = LexEscapedCharSequence(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // Unknown beggining of token...
     } 
     else if (read_head_[0] == '`') { // Line Comment
       auto res_buff = LexLineComment(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
     } 
     else if (read_head_[0] == '/' && read_head_.size() > 1 && read_head_[1] == '`') {
       auto res_buff = LexBlockComment(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
     }
     else if (IsSrcCharPunctuator(read_head_[0])) {
       auto res_buff = LexPunctuator(read_head_);
       if (!res_buff) return LexerFailT{res_buff.error()};
-      tokens.push_back({res_buff.value().processed_tk});
+      emit(res_buff.value().processed_tk);
       read_head_ = res_buff.value().read_head;
       // Quotations initial
     } 
@@ -597,28 +780,21 @@ constexpr Lexer::LexerOutputT Lexer::Process(StrView s) noexcept {
           CppSrcLocT{}, Str{"Unexpected codepoint encountered in source:"} + read_head_[0])};
     }
   }
-  return tokens;
+  return {};
 }
 
 constexpr Vec<Tk> Lexer::Sanitize(const Vec<Tk>& output_tokens) noexcept {
-  // Remove redundant tokens after lexing
-  // Note: "i" is used instead of "it" to avoid ambiguity with the iterator
-  // above.
-  return [&]() constexpr {
-    Vec<Tk> new_output;
-    for (auto i = output_tokens.cbegin(); i != output_tokens.cend(); ++i) {
-      const std::initializer_list<eTk> REDUNDANT_TOKEN_KINDS{eTk::kLineComment, eTk::kBlockComment,eTk::kLineComment,eTk::kWhitespace,eTk::kNewline};
-
-      if (std::any_of(REDUNDANT_TOKEN_KINDS.begin(), REDUNDANT_TOKEN_KINDS.end(),
-                      [i](eTk match) { return match == i->Type(); })) {
-        //new_output.push_back(eTk::kWhitespace);
-        continue;
-      } else {  // Push back non-redundant tokens
-        new_output.push_back(*i);
-      }
-    }
-    return new_output;
-  }();  // Note: The lambda is immediately called.
+  // Remove redundant tokens after lexing.
+  Vec<Tk> new_output;
+  new_output.reserve(output_tokens.size());
+  for (const Tk& tk : output_tokens)
+    if (!IsTkTrivia(tk.Type())) new_output.push_back(tk);
+  return new_output;
+}
+
+constexpr Vec<Tk> Lexer::Sanitize(const TokenBuffer& output_tokens) noexcept {
+  // Only non-trivia tokens are materialized, the compact buffer is never copied as a whole.
+  return output_tokens.ExpandIf([](eTk type) constexpr { return !IsTkTrivia(type); });
 }
 
 namespace literals {
@@ -640,8 +816,8 @@ constexpr auto operator"" _cndTkSanitized() noexcept {
   using std::array;
   using std::copy;
   constexpr auto input = StrView(SRC_STR.data, SRC_STR.size());
-  constexpr auto buf_size = Lexer::Sanitize(Lexer::Lex(input).value_or(Vec<Tk>{})).size();
-  auto buf = Lexer::Sanitize(Lexer::Lex(input).value_or(Vec<Tk>{}));
+  constexpr auto buf_size = Lexer::LexSanitized(input).value_or(Vec<Tk>{}).size();
+  auto buf = Lexer::LexSanitized(input).value_or(Vec<Tk>{});
   array<Tk, buf_size> out;
   copy(buf.data(), buf.data() + buf_size, out.begin());
   return out;
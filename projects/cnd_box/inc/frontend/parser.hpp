@@ -23,6 +23,7 @@
 #include "frontend/synth_ast.hpp"
 #include "frontend/TkCursor.hpp"
 #include "frontend/token_scope.hpp"
+#include "frontend/tk_match_index.hpp"
 
 #include "frontend/Lexer.hpp"
 #include "compiler_utils/LoadSourceFile.hpp"
@@ -102,6 +103,80 @@ CND_CX Ast&& ExtractAndAdvance(TkCursorT cursor, LLPrsResT& parse_res) CND_NX {
 CND_CX LLPrsResT ParseOptionalModifiers(TkCursorT& c);
 CND_CX LLPrsResT ParseGenericBinaryLeftAssociative(TkCursorT c, bool (*next_cond)(const TkCursorT&),
                                                    LLPrsResT (*operand_parser)(TkCursorT)) CND_NX(CND_CLDEV_DEBUG_MODE);
+CND_CX LLPrsResT ParsePrattBinary(TkCursorT c, int min_power) CND_NX;
+CND_CX LLPrsResT ParseSelectedListFold(TkCursorT c) CND_NX;
+
+/// @brief Match index consulted by the scope search methods on the current thread. Null if none is active.
+inline const TkMatchIndex*& ActiveTkMatchIndex() noexcept {
+  thread_local const TkMatchIndex* active = nullptr;
+  return active;
+}
+
+/// @brief Makes a match index active on the current thread for the lifetime of the guard. The previously active
+/// index is restored on destruction. Does nothing during constant evaluation.
+class TkMatchIndexScope {
+ public:
+  constexpr explicit TkMatchIndexScope(const TkMatchIndex& index) noexcept {
+    if (!std::is_constant_evaluated()) {
+      prev_ = ActiveTkMatchIndex();
+      ActiveTkMatchIndex() = &index;
+    }
+  }
+  constexpr ~TkMatchIndexScope() noexcept {
+    if (!std::is_constant_evaluated()) ActiveTkMatchIndex() = prev_;
+  }
+  TkMatchIndexScope(const TkMatchIndexScope&) = delete;
+  TkMatchIndexScope& operator=(const TkMatchIndexScope&) = delete;
+
+ private:
+  const TkMatchIndex* prev_{nullptr};
+};
+
+/// @brief Expression parser used for primary expressions and their nested subexpressions.
+enum class eExprParser {
+  kRecursiveDescent,  ///> ParseListFold and one method per precedence level.
+  kPratt,             ///> ParsePrattListFold, a single precedence climbing loop.
+};
+
+/// @brief Expression parser selected on the current thread.
+inline eExprParser& ActiveExprParser() noexcept {
+  thread_local eExprParser active = eExprParser::kPratt;
+  return active;
+}
+
+/// @brief Selects an expression parser on the current thread for the lifetime of the guard. The previous selection is
+/// restored on destruction. Does nothing during constant evaluation.
+class ExprParserScope {
+ public:
+  constexpr explicit ExprParserScope(eExprParser parser) noexcept {
+    if (!std::is_constant_evaluated()) {
+      prev_ = ActiveExprParser();
+      ActiveExprParser() = parser;
+    }
+  }
+  constexpr ~ExprParserScope() noexcept {
+    if (!std::is_constant_evaluated()) ActiveExprParser() = prev_;
+  }
+  ExprParserScope(const ExprParserScope&) = delete;
+  ExprParserScope& operator=(const ExprParserScope&) = delete;
+
+ private:
+  eExprParser prev_{eExprParser::kPratt};
+};
+
+/// @brief Look up the bracket matching the opener at 'open' in the active match index.
+/// @return Iterator to the matching closer, or nullopt if no index covers 'open', the scope is not well formed, or
+/// the closer is not before 'end'. Callers should then scan.
+CND_CX Opt<TkConstIterT> FindMatchingScope(TkConstIterT open, TkConstIterT end) CND_NX {
+  if (std::is_constant_evaluated() || open >= end) return std::nullopt;
+  const TkMatchIndex* index = ActiveTkMatchIndex();
+  if (!index || !index->Covers(std::to_address(open))) return std::nullopt;
+  const Size open_pos = index->IndexOf(std::to_address(open));
+  const TkMatchIndex::IndexT match = index->MatchOf(open_pos);
+  if (match == TkMatchIndex::kNoMatch || match <= open_pos) return std::nullopt;
+  if (static_cast<std::ptrdiff_t>(match - open_pos) >= std::distance(open, end)) return std::nullopt;
+  return open + static_cast<std::ptrdiff_t>(match - open_pos);
+}
 }  // namespace detail
 
 /// @defgroup cand_compiler_parser_parse Internal parsing methods
@@ -152,11 +227,13 @@ CND_CX LLPrsResT ParseEnumDecl(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseEnumDef(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseEnumBlock(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseSyntax(TkCursorT c) CND_NX;
+CND_CX LLPrsResT ParseProgram(TkCursorT c) CND_NX;
 CND_CX LRPrsResT ParseExpr(TkCursorT c) CND_NX;
 
 CND_CX LLPrsResT ParsePrimaryExpr(TkCursorT c) CND_NX;
 // CND_CX LLPrsResT ParseSubExpr(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseListFold(TkCursorT c) CND_NX;
+CND_CX LLPrsResT ParsePrattListFold(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseAssignment(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseLogicalOr(TkCursorT c) CND_NX;
 CND_CX LLPrsResT ParseLogicalAnd(TkCursorT c) CND_NX;
@@ -226,10 +303,9 @@ CND_CX SepScopePrsResT FindSeperatedBracket(const TkScopeT& ls, eTk separator) C
 /// @param src_data Source file data. EOF character should be the last element.
 static CompilerProcessResult<Ast> ParseSource(const Vec<char>& src_data) {
   StrView src_view = {src_data.begin(), src_data.end()};
-  auto lex_res = Lexer::Lex(src_view);
-  if (!lex_res) return CompilerProcessFailure(lex_res.error());
-  auto sanitized_src = Lexer::Sanitize(*lex_res);
-  std::span<const Tk> src_span = std::span{sanitized_src.data(), sanitized_src.size()};
+  auto sanitized_src = Lexer::LexSanitized(src_view);
+  if (!sanitized_src) return CompilerProcessFailure(sanitized_src.error());
+  std::span<const Tk> src_span = std::span{sanitized_src->data(), sanitized_src->size()};
   auto parse_res = parser::ParseSyntax({src_span.cbegin(), src_span.cend()});
   if (!parse_res) return CompilerProcessFailure(parse_res.error());
   return parse_res->ast;
@@ -418,6 +494,7 @@ CND_CX LLPrsResT ParseFunctionalStmt(TkCursorT c) CND_NX {
   if (c.IsDeclarativeKeyword()) {
     switch (c.Type()) {
       case kKwIf:
+      case kKwCxif:
         return ParseIfDecl(c);
       case kKwWhile:
         return ParseWhileDecl(c);
@@ -488,11 +565,17 @@ CND_CX LLPrsResT ParseConditionalStmt(TkCursorT c) CND_NX {
     return DEBUG_FAIL("Expected <conditional-decl-keyword>.");
 }
 
+// Parses an if/elif/else chain, or a cxif/cxelif/cxelse chain. Clauses of the two forms cannot be mixed.
 CND_CX LLPrsResT ParseIfDecl(TkCursorT c) CND_NX {
   using enum eTk;
 
-  LAMBDA xParseIfElifElse = [&c](eAst ast_type) -> LLPrsResT {
-    if (c.TypeIs(kKwIf) || c.TypeIs(kKwElif)) {
+  if (c.TypeIsnt(kKwIf) && c.TypeIsnt(kKwCxif)) return DEBUG_FAIL("Expected if or cxif.");
+  const bool is_cx = c.TypeIs(kKwCxif);
+  const eTk elif_tk = is_cx ? kKwCxelif : kKwElif;
+  const eTk else_tk = is_cx ? kKwCxelse : kKwElse;
+
+  LAMBDA xParseIfElifElse = [&c, else_tk](eAst ast_type) -> LLPrsResT {
+    if (c.TypeIs(kKwIf) || c.TypeIs(kKwElif) || c.TypeIs(kKwCxif) || c.TypeIs(kKwCxelif)) {
       auto block_begin = c.Iter();
       c.Advance();
       LLPrsResT cond_res = ParseConditionalSubExpression(c);
@@ -508,7 +591,7 @@ CND_CX LLPrsResT ParseIfDecl(TkCursorT c) CND_NX {
       ret.children.push_back(move(body_res.value().ast));
       return LLParserResult(c, move(ret));
 
-    } else if (c.TypeIs(kKwElse)) {
+    } else if (c.TypeIs(else_tk)) {
       auto block_begin = c.Iter();
       c.Advance();
       LLPrsResT body_res = ParseMethodDef(c);
@@ -521,27 +604,28 @@ CND_CX LLPrsResT ParseIfDecl(TkCursorT c) CND_NX {
       return DEBUG_FAIL("Expected if or elif or else.");
   };
 
-  if (c.TypeIsnt(kKwIf)) return DEBUG_FAIL("Expected if.");
-
   Ast ifelifelse_stmt = eAst::kIfStatement;
-  auto if_stmt = xParseIfElifElse(eAst::kKwIf);
+  auto if_stmt = xParseIfElifElse(is_cx ? eAst::kKwCxif : eAst::kKwIf);
   if (!if_stmt) return if_stmt;
   ifelifelse_stmt.children.push_back(move(if_stmt.value().ast));
 
   if (c.TypeIs(kSemicolon)) return LLParserResult(c.Advance(), move(ifelifelse_stmt));
 
-  while (c.TypeIs(kKwElif)) {
-    auto elif_stmt = xParseIfElifElse(eAst::kKwElif);
+  while (c.TypeIs(elif_tk)) {
+    auto elif_stmt = xParseIfElifElse(is_cx ? eAst::kKwCxelif : eAst::kKwElif);
     if (!elif_stmt) return elif_stmt;
     ifelifelse_stmt.children.push_back(move(elif_stmt.value().ast));
   }
 
-  if (c.TypeIs(kKwElse)) {
-    auto else_stmt = xParseIfElifElse(eAst::kKwElse);
+  if (c.TypeIs(else_tk)) {
+    auto else_stmt = xParseIfElifElse(is_cx ? eAst::kKwCxelse : eAst::kKwElse);
     if (!else_stmt) return else_stmt;
     ifelifelse_stmt.children.push_back(move(else_stmt.value().ast));
   }
 
+  if (c.TypeIs(kKwElif) || c.TypeIs(kKwElse) || c.TypeIs(kKwCxelif) || c.TypeIs(kKwCxelse))
+    return DEBUG_FAIL("Cannot mix if/elif/else and cxif/cxelif/cxelse clauses.");
+
   return LLParserResult(c, move(ifelifelse_stmt));
 }
 
@@ -578,7 +662,7 @@ CND_CX LLPrsResT ParseForDecl(TkCursorT c) CND_NX {
   if (c.TypeIsnt(eTk::kLParen)) return DEBUG_FAIL("Expected opening parenthesis '(' after 'for' keyword.");
   c.Advance();
 
-  Ast node{};
+  Ast node{eAst::kKwFor};
   node.src_begin = stmt_begin;
 
   // Optional loop local variable definition.
@@ -1608,7 +1692,15 @@ CND_CX LLPrsResT ParseDirectiveDesc(TkCursorT c) CND_NX {
 }
 
 // <syntax> ::= <directive_desc>
+// Brackets are matched once up front, so that the scope searches made while parsing are lookups instead of rescans.
 CND_CX LLPrsResT ParseSyntax(TkCursorT c) CND_NX {
+  const TkMatchIndex match_index{TkContainerT{c.Iter(), c.End()}};
+  const detail::TkMatchIndexScope match_scope{match_index};
+  return ParseProgram(c);
+}
+
+// Same as ParseSyntax, using whichever match index is already active.
+CND_CX LLPrsResT ParseProgram(TkCursorT c) CND_NX {
   using namespace detail;
   Ast program_node{eAst::kProgram};
   while (!c.AtEnd()) {
@@ -1819,7 +1911,7 @@ CND_CX ScopePrsResT FindScopeImpl(TkCursorT& crsr) CND_NX {
         else
           return DEBUG_FAIL("Unclosed scope.");
 
-      if (!crsr.IsClosingScopeOf(scope_history.back())) return DEBUG_FAIL("Mismatched scopes.");
+      if (!c.IsClosingScopeOf(scope_history.back())) return DEBUG_FAIL("Mismatched scopes.");
 
       scope_history.pop_back();
       scope_depth--;
@@ -1836,6 +1928,8 @@ CND_CX ScopePrsResT FindParen(TkCursorT c) CND_NX {
   c.Advance();
   if (c.AtEnd()) return DEBUG_FAIL("kParserOpeningScopeAtEof.");  // End right after open, cannot be closed.
   if (c.TypeIs(eTk::kRParen)) return TkScopeT{true, scope_begin.Iter(), c.Advance().Iter()};  // Empty paren scope '()'
+  if (auto close = detail::FindMatchingScope(scope_begin.Iter(), c.End()))
+    return TkScopeT{true, scope_begin.Iter(), *close + 1};
   return FindScopeImpl(scope_begin);
 }  // end find_paren
 
@@ -1846,24 +1940,27 @@ CND_CX ScopePrsResT FindBrace(TkCursorT c) CND_NX {
   // c.Advance();
   if (c.AtEnd()) return DEBUG_FAIL("kParserOpeningScopeAtEof.");  // End right after open, cannot be closed.
   if (c.TypeIs(eTk::kRBrace)) return TkScopeT{true, scope_begin, c.Advance().Iter()};  // Empty paren scope '()'
+  if (auto close = detail::FindMatchingScope(scope_begin, c.End())) return TkScopeT{true, scope_begin, *close + 1};
   return FindScopeImpl(c);
 }  // end find_paren
 
 CND_CX ScopePrsResT FindBracket(TkCursorT c) CND_NX {
   if (c.AtEnd()) return DEBUG_FAIL("OutOfBounds");  // Out of bounds begin passed to method...
   if (c.TypeIsnt(eTk::kLBracket)) return DEBUG_FAIL("Expected opening scope.");  // No open token to start with.
-  auto scope_begin = c.Iter();
+  auto scope_begin = c;
   c.Advance();
   if (c.AtEnd()) return DEBUG_FAIL("kParserOpeningScopeAtEof.");  // End right after open, cannot be closed.
-  if (c.TypeIs(eTk::kRBracket)) return TkScopeT{true, scope_begin, c.Advance().Iter()};  // Empty paren scope '()'
-  return FindScopeImpl(c);
+  if (c.TypeIs(eTk::kRBracket)) return TkScopeT{true, scope_begin.Iter(), c.Advance().Iter()};  // Empty scope '[]'
+  if (auto close = detail::FindMatchingScope(scope_begin.Iter(), c.End()))
+    return TkScopeT{true, scope_begin.Iter(), *close + 1};
+  return FindScopeImpl(scope_begin);
 }  // end find_paren
 
 CND_CX LRPrsResT ParseExpr(TkCursorT c) CND_NX { return DEBUG_FAIL("NOT IMPLEMENTED"); }
 
 CND_CX LLPrsResT ParsePrimaryExpr(TkCursorT c) CND_NX {
   if (c.IsAnOperand() || c.IsSingularPrefixOperator() || c.IsOpeningScope())
-    return ParseListFold(c);
+    return detail::ParseSelectedListFold(c);
   else
     DEBUG_FAIL("Unexpected token at start of primary expression.");
 }
@@ -2124,6 +2221,92 @@ CND_CX LLPrsResT ParseProduction(TkCursorT c) CND_NX(CND_CLDEV_DEBUG_MODE) {
   return LLParserResult{c.Advance(reduced_binop.back().src_end), reduced_binop.back()};
 };
 
+// Pratt parser for everything from <list_fold> down to <production>. Operands are parsed by ParsePrefix, as in the
+// recursive chain, and the resulting Ast is identical. One loop replaces a method call per precedence level.
+CND_CX LLPrsResT ParsePrattListFold(TkCursorT c) CND_NX { return detail::ParsePrattBinary(c, 1); }
+
+namespace detail {
+/// @brief Binding power of a binary operator in <list_fold>, or 0 if the token is not one. Higher binds tighter.
+///
+/// Mirrors the ParseListFold to ParseProduction chain. The eTk priority traits group every logical and bitwise operator
+/// with the comparisons, and rank <=> below them, so they cannot order this grammar.
+CND_CX int GetBinaryBindingPower(eTk t) CND_NX {
+  switch (t) {
+    using enum eTk;
+    case kComma:
+      return 1;
+    case kAssign:
+      return 2;
+    case kOr:
+      return 3;
+    case kAnd:
+      return 4;
+    case kBor:
+      return 5;
+    case kXor:
+      return 6;
+    case kBand:
+      return 7;
+    case kEq:
+    case kNeq:
+      return 8;
+    case kGt:
+    case kGte:
+    case kLt:
+    case kLte:
+      return 9;
+    case kSpaceship:
+      return 10;
+    case kRsh:
+    case kLsh:
+      return 11;
+    case kAdd:
+    case kSub:
+      return 12;
+    case kMul:
+    case kDiv:
+    case kMod:
+      return 13;
+    default:
+      return 0;
+  }
+}
+
+CND_CX LLPrsResT ParsePrattBinary(TkCursorT c, int min_power) CND_NX {
+  using std::move;
+
+  if (!IsTkPrimarySpecifier(c.Type())) return DEBUG_FAIL("Unexpected token at start of binary access.");
+
+  auto first_op = ParsePrefix(c);
+  if (!first_op) return first_op;
+  c.Advance(first_op->head);
+
+  Ast lhs{move(first_op->ast)};
+  for (int power = GetBinaryBindingPower(c.Type()); power != 0 && power >= min_power;
+       power = GetBinaryBindingPower(c.Type())) {
+    Ast binop{c};
+    // A right associative operator accepts an operator of equal power on its right, a left associative one does not.
+    const int rhs_min_power = c.Assoc() == eAssoc::Right ? power : power + 1;
+    c.Advance();
+    auto rhs = ParsePrattBinary(c, rhs_min_power);
+    if (!rhs) return rhs;
+    c.Advance(rhs->head);
+    binop.src_begin = lhs.src_begin;
+    binop.src_end = rhs->ast.src_end;
+    binop.PushBack(move(lhs));
+    binop.PushBack(move(rhs->ast));
+    lhs = move(binop);
+  }
+
+  return LLParserResult{c.Advance(lhs.src_end), move(lhs)};
+}
+
+CND_CX LLPrsResT ParseSelectedListFold(TkCursorT c) CND_NX {
+  if (!std::is_constant_evaluated() && ActiveExprParser() == eExprParser::kRecursiveDescent) return ParseListFold(c);
+  return ParsePrattListFold(c);
+}
+}  // namespace detail
+
 // [R->L] <prefix> ::= <INCREMENT_SIGN> * <access>
 //            | <DECREMENT_SIGN> * <access>
 //            | <EXCLAMATION_MARK> * <access>
@@ -2463,7 +2646,7 @@ CND_CX LLPrsResT ParseParenSubexpr(TkCursorT c) CND_NX(CND_CLDEV_DEBUG_MODE) {
   if (c.TypeIsnt(eTk::kLParen)) return DEBUG_FAIL("Expected a left parentheses.");
   auto subexpr_beg = c.Iter();
   c.Advance();
-  auto subexpr = ParseListFold(c);
+  auto subexpr = detail::ParseSelectedListFold(c);
   if (!subexpr) return subexpr;
   c.Advance(subexpr->head);
   if (c.TypeIsnt(eTk::kRParen)) return DEBUG_FAIL("Expected a right parentheses.");
@@ -2474,7 +2657,7 @@ CND_CX LLPrsResT ParseSquareSubexpr(TkCursorT c) CND_NX(CND_CLDEV_DEBUG_MODE) {
   if (c.TypeIsnt(eTk::kLBracket)) return DEBUG_FAIL("Expected a left square bracket.");
   auto subexpr_beg = c.Iter();
   c.Advance();
-  auto subexpr = ParseListFold(c);
+  auto subexpr = detail::ParseSelectedListFold(c);
   if (!subexpr) return subexpr;
   c.Advance(subexpr->head);
   if (c.TypeIsnt(eTk::kRBracket)) return DEBUG_FAIL("Expected a right square bracket.");
@@ -2485,7 +2668,7 @@ CND_CX LLPrsResT ParseCurlySubexpr(TkCursorT c) CND_NX(CND_CLDEV_DEBUG_MODE) {
   if (c.TypeIsnt(eTk::kLBrace)) return DEBUG_FAIL("Expected a left curly bracket.");
   auto subexpr_beg = c.Iter();
   c.Advance();
-  auto subexpr = ParseListFold(c);
+  auto subexpr = detail::ParseSelectedListFold(c);
   if (!subexpr) return subexpr;
   c.Advance(subexpr->head);
   if (c.TypeIsnt(eTk::kRBrace)) return DEBUG_FAIL("Expected a right curly bracket.");
@@ -2521,6 +2704,13 @@ CND_CX SepScopePrsResT FindSeperatedScopeImpl(TkConstIterT begin, TkConstIterT e
       scopes.push_back(TkScopeT{true, last_closed, i + 1});
       last_closed = i;
     } else if (i->IsLScope()) {
+      // A well formed nested scope holds no separators at this level, skip to its closer.
+      if (scope_type_history.empty()) {
+        if (auto close = detail::FindMatchingScope(i, end)) {
+          i = *close + 1;
+          continue;
+        }
+      }
       scope_type_history.push_back(i->Type());
     } else if (i->IsRScope() && !scope_type_history.empty()) {
       if (i->IsRScopeOf(scope_type_history.back())) {
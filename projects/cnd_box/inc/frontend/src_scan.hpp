@@ -0,0 +1,246 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Source Character Run Scanner
+/// @ingroup cnd_compiler_data
+/// @brief Vectorized character-class run scanning used by the lexer hot loops.
+///
+/// The lexer spends most of its time consuming runs of a single character class: identifier chars, digits,
+/// whitespace, newlines and comment bodies. ScanRun finds the end of such a run 16 (SSE2) or 32 (AVX2) bytes at a
+/// time. The instruction set is detected once at runtime. Constant evaluation and non-x86 targets always use the
+/// scalar loop, so the results are identical to the IsSrcChar* traits in every mode.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler_data
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "use_corevals.hpp"
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define CND_SRCSCAN_X86 1
+  #include <immintrin.h>
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define CND_SRCSCAN_TARGET_AVX2
+  #else
+    #define CND_SRCSCAN_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+#else
+  #define CND_SRCSCAN_X86 0
+#endif
+// clang-format on
+
+namespace cnd::trtools::srcscan {
+
+/// Instruction set used by ScanRun outside of constant evaluation.
+enum class eScanIsa : UI8 { kScalar, kSse2, kAvx2 };
+
+/// Character class of a run. Each entry mirrors the loop condition of one Lexer::Lex* method.
+enum class eScanRun : UI8 {
+  kAlnumus,      ///> IsSrcCharAlnumus    : identifier and keyword bodies.
+  kNumeric,      ///> IsSrcCharNumeric    : integral and fractional digits.
+  kWhitespace,   ///> IsSrcCharWhitespace : whitespace runs, including newlines.
+  kNewline,      ///> IsSrcCharNewline    : newline runs.
+  kNotNewline,   ///> !IsSrcCharNewline   : line comment bodies.
+  kNotBacktick,  ///> c != '`'            : block comment bodies, up to the next possible terminator.
+};
+
+namespace detail {
+template <eScanRun RUN>
+constexpr bool IsInRun(char c) noexcept {
+  using enum eScanRun;
+  if constexpr (RUN == kAlnumus)
+    return IsSrcCharAlnumus(c);
+  else if constexpr (RUN == kNumeric)
+    return IsSrcCharNumeric(c);
+  else if constexpr (RUN == kWhitespace)
+    return IsSrcCharWhitespace(c);
+  else if constexpr (RUN == kNewline)
+    return IsSrcCharNewline(c);
+  else if constexpr (RUN == kNotNewline)
+    return !IsSrcCharNewline(c);
+  else
+    return c != '`';
+}
+
+template <eScanRun RUN>
+constexpr const char* ScanRunScalar(const char* it, const char* end) noexcept {
+  while (it != end && IsInRun<RUN>(*it)) it++;
+  return it;
+}
+
+#if CND_SRCSCAN_X86
+// Signed-compare range check: true in each lane where LO <= x <= HI. SSE2/AVX2 only have signed byte compares, so the
+// value is biased into [-128, 127] before comparing against the biased width of the range.
+template <char LO, char HI>
+inline __m128i InRange128(__m128i x) noexcept {
+  return _mm_cmplt_epi8(_mm_add_epi8(x, _mm_set1_epi8(static_cast<char>(0x80 - LO))),
+                        _mm_set1_epi8(static_cast<char>(0x80 + (HI - LO + 1))));
+}
+
+template <eScanRun RUN>
+inline __m128i ClassMask128(__m128i x) noexcept {
+  using enum eScanRun;
+  if constexpr (RUN == kAlnumus)  // Folding case with 0x20 maps no other char into ['a','z'].
+    return _mm_or_si128(_mm_or_si128(InRange128<'a', 'z'>(_mm_or_si128(x, _mm_set1_epi8(0x20))),
+                                     InRange128<'0', '9'>(x)),
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+  else if constexpr (RUN == kNumeric)
+    return InRange128<'0', '9'>(x);
+  else if constexpr (RUN == kWhitespace)  // '\t' '\n' '\v' '\f' '\r' are contiguous.
+    return _mm_or_si128(InRange128<'\t', '\r'>(x), _mm_cmpeq_epi8(x, _mm_set1_epi8(' ')));
+  else if constexpr (RUN == kNewline || RUN == kNotNewline)  // '\n' '\v' '\f' '\r' are contiguous.
+    return InRange128<'\n', '\r'>(x);
+  else
+    return _mm_cmpeq_epi8(x, _mm_set1_epi8('`'));
+}
+
+template <eScanRun RUN>
+inline const char* ScanRunSse2(const char* it, const char* end) noexcept {
+  constexpr bool kInverted = RUN == eScanRun::kNotNewline || RUN == eScanRun::kNotBacktick;
+  while (end - it >= 16) {
+    unsigned in_class =
+        static_cast<unsigned>(_mm_movemask_epi8(ClassMask128<RUN>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it)))));
+    unsigned stops = kInverted ? in_class : (~in_class & 0xFFFFu);
+    if (stops) return it + std::countr_zero(stops);
+    it += 16;
+  }
+  return ScanRunScalar<RUN>(it, end);
+}
+
+template <char LO, char HI>
+CND_SRCSCAN_TARGET_AVX2 inline __m256i InRange256(__m256i x) noexcept {
+  return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + (HI - LO + 1))),
+                           _mm256_add_epi8(x, _mm256_set1_epi8(static_cast<char>(0x80 - LO))));
+}
+
+template <eScanRun RUN>
+CND_SRCSCAN_TARGET_AVX2 inline __m256i ClassMask256(__m256i x) noexcept {
+  using enum eScanRun;
+  if constexpr (RUN == kAlnumus)
+    return _mm256_or_si256(_mm256_or_si256(InRange256<'a', 'z'>(_mm256_or_si256(x, _mm256_set1_epi8(0x20))),
+                                           InRange256<'0', '9'>(x)),
+                           _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+  else if constexpr (RUN == kNumeric)
+    return InRange256<'0', '9'>(x);
+  else if constexpr (RUN == kWhitespace)
+    return _mm256_or_si256(InRange256<'\t', '\r'>(x), _mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')));
+  else if constexpr (RUN == kNewline || RUN == kNotNewline)
+    return InRange256<'\n', '\r'>(x);
+  else
+    return _mm256_cmpeq_epi8(x, _mm256_set1_epi8('`'));
+}
+
+template <eScanRun RUN>
+CND_SRCSCAN_TARGET_AVX2 inline const char* ScanRunAvx2(const char* it, const char* end) noexcept {
+  constexpr bool kInverted = RUN == eScanRun::kNotNewline || RUN == eScanRun::kNotBacktick;
+  while (end - it >= 32) {
+    auto in_class = static_cast<UI32>(
+        _mm256_movemask_epi8(ClassMask256<RUN>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(it)))));
+    UI32 stops = kInverted ? in_class : ~in_class;
+    if (stops) return it + std::countr_zero(stops);
+    it += 32;
+  }
+  return ScanRunSse2<RUN>(it, end);  // Tail of less than 32 bytes.
+}
+#endif  // CND_SRCSCAN_X86
+}  // namespace detail
+
+/// @brief Best instruction set supported by the host cpu and os.
+inline eScanIsa DetectScanIsa() noexcept {
+#if CND_SRCSCAN_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4]{};
+  __cpuid(info, 0);
+  if (info[0] < 7) return eScanIsa::kSse2;
+  __cpuid(info, 1);
+  const bool has_osxsave = info[2] & (1 << 27);
+  const bool has_avx = info[2] & (1 << 28);
+  __cpuidex(info, 7, 0);
+  const bool has_avx2 = info[1] & (1 << 5);
+  if (has_osxsave && has_avx && has_avx2 && (_xgetbv(0) & 0x6) == 0x6) return eScanIsa::kAvx2;
+  return eScanIsa::kSse2;
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? eScanIsa::kAvx2 : eScanIsa::kSse2;
+#endif
+#else
+  return eScanIsa::kScalar;
+#endif
+}
+
+/// @brief Instruction set currently used by ScanRun. Detected on first use.
+inline eScanIsa& ActiveScanIsa() noexcept {
+  static eScanIsa active_isa = DetectScanIsa();
+  return active_isa;
+}
+
+/// @brief Select the instruction set used by ScanRun. Clamped to what the host supports.
+/// @return The instruction set which was actually selected.
+///
+/// Only intended for testing and benchmarking the scanning modes against each other.
+inline eScanIsa SetScanIsa(eScanIsa isa) noexcept {
+  const eScanIsa supported = DetectScanIsa();
+  ActiveScanIsa() = static_cast<UI8>(isa) > static_cast<UI8>(supported) ? supported : isa;
+  return ActiveScanIsa();
+}
+
+/// @brief Find the end of a run of chars of class RUN in [it, end).
+/// @return Pointer to the first char not in the run, or end.
+template <eScanRun RUN>
+constexpr const char* ScanRun(const char* it, const char* end) noexcept {
+  if (std::is_constant_evaluated()) return detail::ScanRunScalar<RUN>(it, end);
+#if CND_SRCSCAN_X86
+  switch (ActiveScanIsa()) {
+    case eScanIsa::kAvx2:
+      return detail::ScanRunAvx2<RUN>(it, end);
+    case eScanIsa::kSse2:
+      return detail::ScanRunSse2<RUN>(it, end);
+    default:
+      break;
+  }
+#endif
+  return detail::ScanRunScalar<RUN>(it, end);
+}
+
+/// @brief Find the end of a run of chars of class RUN in a source view, starting at 'from'.
+/// @return Iterator to the first char not in the run, or s.end().
+template <eScanRun RUN>
+constexpr StrView::const_iterator ScanRun(StrView s, StrView::const_iterator from) noexcept {
+  const char* beg = s.data() + std::distance(s.begin(), from);
+  const char* run_end = ScanRun<RUN>(beg, s.data() + s.size());
+  return std::next(from, run_end - beg);
+}
+
+}  // namespace cnd::trtools::srcscan
+
+/// @} // end of cnd_compiler_data
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 // clang-format off
 #include "ccapi/CommonCppApi.hpp"
 #include "use_corevals.hpp"
+#include "compiler_utils/SymbolTable.hpp"
 // clang-format on
 
 namespace cnd {
@@ -30,6 +31,7 @@ struct Tk {
   constexpr void SetEndLine(Size line);
   constexpr void SetBegCol(Size col);
   constexpr void SetEndCol(Size col);
+  constexpr void SetSymbol(SymbolId symbol) noexcept;
 
   // Data Properties
   constexpr eTk Type() const noexcept;
@@ -40,6 +42,7 @@ struct Tk {
   constexpr Size EndLine() const noexcept;
   constexpr Size EndCol() const noexcept;
   constexpr const StrView& Literal() const noexcept;
+  constexpr SymbolId Symbol() const noexcept;
   constexpr StrView& LiteralMutable();
 
   // Parsing Utilities
@@ -86,6 +89,7 @@ struct Tk {
 
   // public:
   eTk type_{eTk::kNONE};
+  SymbolId symbol_{kNoSymbol};  // Interned identifier, see Symbols(). Fits in the padding after type_.
   Size file_{0};
   Size beg_line_{0};
   Size end_line_{0};
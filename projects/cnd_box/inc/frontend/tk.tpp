@@ -34,6 +34,8 @@ constexpr void Tk::SetBegCol(Size col) { beg_col_ = col; }
 
 constexpr void Tk::SetEndCol(Size col) { beg_col_ = col; }
 
+constexpr void Tk::SetSymbol(SymbolId symbol) noexcept { symbol_ = symbol; }
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /* Data Properties */
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +56,8 @@ constexpr Size Tk::EndCol() const noexcept { return end_line_; }
 
 constexpr const StrView& Tk::Literal() const noexcept { return literal_; }
 
+constexpr SymbolId Tk::Symbol() const noexcept { return symbol_; }
+
 constexpr StrView& Tk::LiteralMutable() { return literal_; }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +115,7 @@ constexpr Tk::Tk(eTk type, StrView literal) : type_(type), literal_{literal} {}
 
 constexpr Tk::Tk(const Tk& other) noexcept
     : type_(other.type_),
+      symbol_(other.symbol_),
       file_(other.file_),
       beg_line_(other.beg_line_),
       end_line_(other.end_line_),
@@ -120,6 +125,7 @@ constexpr Tk::Tk(const Tk& other) noexcept
 
 constexpr Tk::Tk(Tk&& other) noexcept
     : type_(other.type_),
+      symbol_(other.symbol_),
       file_(other.file_),
       beg_line_(other.beg_line_),
       end_line_(other.end_line_),
@@ -129,6 +135,7 @@ constexpr Tk::Tk(Tk&& other) noexcept
 
 constexpr Tk& Tk::operator=(const Tk& other) noexcept {
   type_ = other.type_;
+  symbol_ = other.symbol_;
   file_ = other.file_;
   beg_line_ = other.beg_line_;
   end_line_ = other.end_line_;
@@ -140,6 +147,7 @@ constexpr Tk& Tk::operator=(const Tk& other) noexcept {
 
 constexpr Tk& Tk::operator=(Tk&& other) noexcept {
   type_ = other.type_;
+  symbol_ = other.symbol_;
   file_ = other.file_;
   beg_line_ = other.beg_line_;
   end_line_ = other.end_line_;
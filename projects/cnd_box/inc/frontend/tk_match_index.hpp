@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Token Match Index
+/// @ingroup cnd_compiler_data
+/// @brief Matching bracket table for a sanitized token sequence, built in a single linear pass.
+///
+/// The parser repeatedly asks "where does the scope opened here end?". Answering by scanning forward costs the size
+/// of the scope on every query, so a source nested N levels deep is scanned O(N^2) times. A TkMatchIndex answers the
+/// same question with one array lookup.
+///
+/// Only well formed pairs are recorded. An opener whose scope is unclosed, or which contains a mismatched closer
+/// before its own closer, has no match, so callers can fall back to a scan which reports the error.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler_data
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "use_corevals.hpp"
+#include "frontend/tk.hpp"
+// clang-format on
+
+namespace cnd {
+
+class TkMatchIndex {
+ public:
+  using IndexT = UI32;
+  static constexpr IndexT kNoMatch = std::numeric_limits<IndexT>::max();
+
+  constexpr TkMatchIndex() noexcept = default;
+  constexpr explicit TkMatchIndex(std::span<const Tk> tokens) { Build(tokens); }
+
+  /// @brief Match every bracket in 'tokens'. Replaces any previous contents.
+  constexpr void Build(std::span<const Tk> tokens) {
+    tokens_ = tokens;
+    match_.assign(tokens.size(), kNoMatch);
+    Vec<IndexT> open;
+    for (Size i = 0; i < tokens.size(); i++) {
+      const eTk type = tokens[i].Type();
+      if (IsTkLScope(type)) {
+        open.push_back(static_cast<IndexT>(i));
+      } else if (IsTkRScope(type) && !open.empty()) {
+        if (IsTkRScopeOf(tokens[open.back()].Type(), type)) {
+          match_[open.back()] = static_cast<IndexT>(i);
+          match_[i] = open.back();
+          open.pop_back();
+        } else {
+          // Every scope still open reaches this closer before its own, so none of them is well formed.
+          open.clear();
+        }
+      }
+    }
+  }
+
+  /* Properties */
+  constexpr Size Count() const noexcept { return match_.size(); }
+  constexpr Bool Empty() const noexcept { return match_.empty(); }
+  constexpr std::span<const Tk> Tokens() const noexcept { return tokens_; }
+
+  /// @brief Index of the bracket matching token 'i', or kNoMatch.
+  constexpr IndexT MatchOf(Size i) const noexcept { return i < match_.size() ? match_[i] : kNoMatch; }
+
+  /// @brief True if 'tk' points into the indexed token sequence.
+  constexpr Bool Covers(const Tk* tk) const noexcept {
+    return !tokens_.empty() && std::less_equal<>{}(tokens_.data(), tk) &&
+           std::less<>{}(tk, tokens_.data() + tokens_.size());
+  }
+
+  /// @brief Position of 'tk' in the indexed sequence. 'tk' must be covered.
+  constexpr Size IndexOf(const Tk* tk) const noexcept { return static_cast<Size>(tk - tokens_.data()); }
+
+ private:
+  std::span<const Tk> tokens_{};  ///> Indexed tokens. Not owned.
+  Vec<IndexT> match_{};           ///> Index of the matching bracket of each token, or kNoMatch.
+};
+
+}  // namespace cnd
+
+/// @} // end of cnd_compiler_data
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
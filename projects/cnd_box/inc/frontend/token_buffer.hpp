@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file C& Token Buffer
+/// @ingroup cnd_compiler_data
+/// @brief Compact structure-of-arrays storage for the tokens of a single source file.
+///
+/// A Tk is about 64 bytes: the type, a file index, four line/col fields and a literal view. A TokenBuffer stores
+/// 9 bytes per token: a 1 byte type, a 32 bit offset into the source and a 32 bit length. Line and column are
+/// derived on demand from a per-file line start table, which is built on the first location query.
+///
+/// Tk values are materialized on demand with At/Expand. TokenBufferSpan adapts the buffer to TkCursor. The parser
+/// keeps std::span<const Tk> iterators inside Ast, so it runs on an expanded, sanitized Vec<Tk>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler_data
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "use_corevals.hpp"
+#include "frontend/tk.hpp"
+// clang-format on
+
+namespace cnd {
+static_assert(static_cast<Size>(eTk::COUNT) <= 256, "TokenBuffer stores token types in a single byte.");
+
+class TokenBuffer {
+ public:
+  using TypeT = UI8;
+  using OffsetT = UI32;
+  using LengthT = UI32;
+
+  constexpr TokenBuffer() noexcept = default;
+  constexpr explicit TokenBuffer(StrView src, Size file = 0) noexcept : src_{src}, file_{file} {}
+
+  /// @brief Compact an existing token vector. Every literal must be a view into 'src'.
+  static constexpr TokenBuffer FromTokens(StrView src, const Vec<Tk>& tokens, Size file = 0) {
+    TokenBuffer buf{src, file};
+    buf.Reserve(tokens.size());
+    for (const Tk& tk : tokens) buf.PushBack(tk);
+    return buf;
+  }
+
+  constexpr void Reserve(Size n) {
+    types_.reserve(n);
+    offsets_.reserve(n);
+    lengths_.reserve(n);
+  }
+
+  /// @brief Append a token. The literal must be a view into the source of this buffer.
+  constexpr void PushBack(eTk type, StrView literal) {
+    types_.push_back(static_cast<TypeT>(type));
+    offsets_.push_back(static_cast<OffsetT>(literal.data() - src_.data()));
+    lengths_.push_back(static_cast<LengthT>(literal.size()));
+  }
+
+  constexpr void PushBack(const Tk& tk) { PushBack(tk.Type(), tk.Literal()); }
+
+  constexpr void Clear() noexcept {
+    types_.clear();
+    offsets_.clear();
+    lengths_.clear();
+  }
+
+  /* Properties */
+  constexpr Size Count() const noexcept { return types_.size(); }
+  constexpr Bool Empty() const noexcept { return types_.empty(); }
+  constexpr StrView Source() const noexcept { return src_; }
+  constexpr Size File() const noexcept { return file_; }
+
+  /// @brief Bytes held by the token arrays and the line table, excluding the source itself.
+  constexpr Size ResidentBytes() const noexcept {
+    return types_.capacity() * sizeof(TypeT) + offsets_.capacity() * sizeof(OffsetT) +
+           lengths_.capacity() * sizeof(LengthT) + line_starts_.capacity() * sizeof(OffsetT);
+  }
+
+  /* Token properties */
+  constexpr eTk Type(Size i) const noexcept { return static_cast<eTk>(types_[i]); }
+  constexpr OffsetT Offset(Size i) const noexcept { return offsets_[i]; }
+  constexpr LengthT Length(Size i) const noexcept { return lengths_[i]; }
+  constexpr StrView Literal(Size i) const noexcept { return src_.substr(offsets_[i], lengths_[i]); }
+  constexpr Bool TypeIs(Size i, eTk type) const noexcept { return Type(i) == type; }
+
+  /// @brief Zero-based line of a source offset. As in the lexer, every newline char ends a line, so "\r\n" is two.
+  constexpr Size LineOf(OffsetT offset) const {
+    const auto& starts = LineStarts();
+    return static_cast<Size>(std::distance(starts.begin(), std::upper_bound(starts.begin(), starts.end(), offset))) -
+           1;
+  }
+
+  /// @brief Zero-based column of a source offset.
+  constexpr Size ColOf(OffsetT offset) const { return offset - LineStarts()[LineOf(offset)]; }
+
+  constexpr Size BegLine(Size i) const { return LineOf(offsets_[i]); }
+  constexpr Size BegCol(Size i) const { return ColOf(offsets_[i]); }
+  constexpr Size EndLine(Size i) const { return LineOf(offsets_[i] + lengths_[i]); }
+  constexpr Size EndCol(Size i) const { return ColOf(offsets_[i] + lengths_[i]); }
+
+  /// @brief Materialize a single token, including its file and derived locations.
+  constexpr Tk At(Size i) const {
+    Tk tk{Type(i), Literal(i), BegLine(i), BegCol(i), EndLine(i), EndCol(i)};
+    tk.SetFile(file_);
+    return tk;
+  }
+
+  /// @brief Materialize every token for which 'keep(type)' is true, in order.
+  ///
+  /// Tokens are visited in source order, so line numbers are found with a forward walk over the line table instead
+  /// of a search per token.
+  template <class PredT>
+  constexpr Vec<Tk> ExpandIf(PredT&& keep) const {
+    const auto& starts = LineStarts();
+    Vec<Tk> out;
+    out.reserve(Count());
+    Size line = 0;
+    LAMBDA xAdvanceLineTo = [&starts](Size from_line, OffsetT offset) constexpr {
+      while (from_line + 1 < starts.size() && starts[from_line + 1] <= offset) from_line++;
+      return from_line;
+    };
+    for (Size i = 0; i < Count(); i++) {
+      if (!keep(Type(i))) continue;
+      line = xAdvanceLineTo(line, offsets_[i]);
+      const OffsetT end_offset = offsets_[i] + lengths_[i];
+      const Size end_line = xAdvanceLineTo(line, end_offset);
+      Tk tk{Type(i), Literal(i), line, offsets_[i] - starts[line], end_line, end_offset - starts[end_line]};
+      tk.SetFile(file_);
+      out.push_back(tk);
+    }
+    return out;
+  }
+
+  /// @brief Materialize every token, in order.
+  constexpr Vec<Tk> Expand() const {
+    return ExpandIf([](eTk) constexpr { return true; });
+  }
+
+ private:
+  constexpr const Vec<OffsetT>& LineStarts() const {
+    if (line_starts_.empty()) {
+      line_starts_.push_back(0);
+      for (Size i = 0; i < src_.size(); i++)
+        if (IsSrcCharNewline(src_[i])) line_starts_.push_back(static_cast<OffsetT>(i + 1));
+    }
+    return line_starts_;
+  }
+
+ private:
+  StrView src_{""};                     ///> Source the tokens' offsets refer to. Not owned.
+  Size file_{0};                        ///> File index stamped on materialized tokens.
+  Vec<TypeT> types_{};                  ///> eTk of each token.
+  Vec<OffsetT> offsets_{};              ///> Offset of each token's literal in the source.
+  Vec<LengthT> lengths_{};              ///> Length of each token's literal.
+  mutable Vec<OffsetT> line_starts_{};  ///> Offset of each line's first char. Built lazily.
+};
+
+/// @brief Read-only view over a TokenBuffer shaped like std::span<const Tk>, so it can be used as
+/// TkCursor<TokenBufferSpan>.
+///
+/// Dereferencing an iterator materializes the token into a small direct-mapped cache. The cache is shared by the span,
+/// its copies and every iterator made from them, so iterators stay valid when the span they came from is copied or
+/// destroyed. A reference obtained through an iterator, such as from TkCursor::Get or TkCursor::Peek, stays valid
+/// until kCacheSize further tokens have been materialized through the same cache. The TokenBuffer must outlive the
+/// span and its iterators.
+template <class T>
+class TokenBufferSpan {
+  static_assert(std::is_same_v<std::remove_const_t<T>, Tk>, "TokenBufferSpan only views tokens.");
+
+ public:
+  static constexpr Size kCacheSize = 64;
+
+ private:
+  struct Cache {
+    const TokenBuffer* buf{nullptr};
+    std::array<Tk, kCacheSize> tokens{};
+    std::array<Size, kCacheSize> indices = [] {
+      std::array<Size, kCacheSize> none{};
+      none.fill(std::numeric_limits<Size>::max());
+      return none;
+    }();
+
+    const Tk& Materialize(Size i) {
+      const Size slot = i % kCacheSize;
+      if (indices[slot] != i) {
+        tokens[slot] = buf->At(i);
+        indices[slot] = i;
+      }
+      return tokens[slot];
+    }
+  };
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Tk;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Tk*;
+    using reference = const Tk&;
+
+    const_iterator() noexcept = default;
+    const_iterator(SPtr<Cache> cache, Size i) noexcept : cache_{std::move(cache)}, i_{i} {}
+
+    const Tk& operator*() const { return cache_->Materialize(i_); }
+    const Tk* operator->() const { return &cache_->Materialize(i_); }
+    const Tk& operator[](difference_type n) const { return cache_->Materialize(i_ + n); }
+
+    const_iterator& operator++() noexcept { return ++i_, *this; }
+    const_iterator& operator--() noexcept { return --i_, *this; }
+    const_iterator operator++(int) noexcept { return {cache_, i_++}; }
+    const_iterator operator--(int) noexcept { return {cache_, i_--}; }
+    const_iterator& operator+=(difference_type n) noexcept { return i_ += n, *this; }
+    const_iterator& operator-=(difference_type n) noexcept { return i_ -= n, *this; }
+    const_iterator operator+(difference_type n) const noexcept { return {cache_, i_ + n}; }
+    const_iterator operator-(difference_type n) const noexcept { return {cache_, i_ - n}; }
+    friend const_iterator operator+(difference_type n, const const_iterator& it) noexcept { return it + n; }
+    difference_type operator-(const const_iterator& rhs) const noexcept {
+      return static_cast<difference_type>(i_) - static_cast<difference_type>(rhs.i_);
+    }
+    bool operator==(const const_iterator& rhs) const noexcept { return i_ == rhs.i_; }
+    auto operator<=>(const const_iterator& rhs) const noexcept { return i_ <=> rhs.i_; }
+
+    /// Index of the token in the underlying TokenBuffer.
+    Size Index() const noexcept { return i_; }
+
+   private:
+    SPtr<Cache> cache_{nullptr};
+    Size i_{0};
+  };
+  using iterator = const_iterator;
+
+  TokenBufferSpan() noexcept = default;
+  explicit TokenBufferSpan(const TokenBuffer& buf) : cache_{std::make_shared<Cache>(Cache{.buf = &buf})} {}
+
+  const_iterator begin() const noexcept { return {cache_, 0}; }
+  const_iterator end() const noexcept { return {cache_, size()}; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+  Size size() const noexcept { return cache_ ? cache_->buf->Count() : 0; }
+  bool empty() const noexcept { return size() == 0; }
+
+ private:
+  SPtr<Cache> cache_{nullptr};
+};
+
+}  // namespace cnd
+
+/// @} // end of cnd_compiler_data
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@ constexpr bool IsTkAnOperand(eTk t) noexcept;
 constexpr bool IsTkAPrefixOperator(eTk t) noexcept;
 constexpr bool IsTkPrimary(eTk t) noexcept;
 constexpr bool IsTkPragmatic(eTk t) noexcept;
+constexpr bool IsTkTrivia(eTk t) noexcept;
 constexpr eTk GetTkFromKeyword(StrView kw) noexcept;
 }  // namespace cnd::corevals::grammar
 
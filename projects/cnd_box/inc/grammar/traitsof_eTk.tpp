@@ -624,146 +624,209 @@ constexpr bool IsTkAPrefixOperator(eTk t) noexcept {
 
 constexpr bool IsTkPragmatic(eTk t) noexcept { return IsTkModifier(t) || IsTkDeclarative(t); }
 
+// Tokens which carry no meaning for the parser: whitespace, newlines and comments.
+constexpr bool IsTkTrivia(eTk t) noexcept {
+  switch (t) {
+    case eTk::kWhitespace:
+    case eTk::kNewline:
+    case eTk::kLineComment:
+    case eTk::kBlockComment:
+      return true;
+    default:
+      return false;
+  }
+}
+
 constexpr bool IsTkPrimary(eTk t) noexcept { return IsTkAnOperand(t) || IsTkAPrefixOperator(t) || t == eTk::kLParen; }
 constexpr bool IsTkPrimarySpecifier(eTk t) noexcept { return IsTkAnOperand(t) || IsTkAPrefixOperator(t) || t == eTk::kLParen || IsTkLScope(t)|| t == eTk::kDoubleColon; }
 
-constexpr eTk GetTkFromKeyword(StrView kw) noexcept {
-#define CND_MM_LOCAL_CASE(n, lt) else if (cxx::StrEq(kw, lt)) return eTk::k##n
+namespace detail {
+/// A literal recognized by GetTkFromKeyword and the token it maps to.
+struct TkKeywordEntry {
+  StrView literal;
+  eTk type;
+};
 
-  if (kw.empty()) return eTk::kNONE;
+// Every literal recognized by GetTkFromKeyword. When a literal appears twice, the first entry wins.
+#define CND_MM_LOCAL_ENTRY(n, lt) TkKeywordEntry{lt, eTk::k##n},
+inline constexpr TkKeywordEntry kTkKeywordEntries[] = {
   // Declarative
-  CND_MM_LOCAL_CASE(KwDef, "def");
-  CND_MM_LOCAL_CASE(KwFn, "fn");
-  CND_MM_LOCAL_CASE(KwClass, "class");
-  CND_MM_LOCAL_CASE(KwMain, "main");
-  CND_MM_LOCAL_CASE(KwImport, "import");
-  CND_MM_LOCAL_CASE(KwNamespace, "namespace");
-  CND_MM_LOCAL_CASE(KwUse, "using");
-  CND_MM_LOCAL_CASE(KwLib, "lib");
-  CND_MM_LOCAL_CASE(KwDll, "dll");
-  CND_MM_LOCAL_CASE(KwEnum, "enum");
-  CND_MM_LOCAL_CASE(KwProc, "proc");
-
+  CND_MM_LOCAL_ENTRY(KwDef, "def")
+  CND_MM_LOCAL_ENTRY(KwFn, "fn")
+  CND_MM_LOCAL_ENTRY(KwClass, "class")
+  CND_MM_LOCAL_ENTRY(KwMain, "main")
+  CND_MM_LOCAL_ENTRY(KwImport, "import")
+  CND_MM_LOCAL_ENTRY(KwNamespace, "namespace")
+  CND_MM_LOCAL_ENTRY(KwUse, "using")
+  CND_MM_LOCAL_ENTRY(KwLib, "lib")
+  CND_MM_LOCAL_ENTRY(KwDll, "dll")
+  CND_MM_LOCAL_ENTRY(KwEnum, "enum")
+  CND_MM_LOCAL_ENTRY(KwProc, "proc")
   // Control
-  CND_MM_LOCAL_CASE(KwIf, "if");
-  CND_MM_LOCAL_CASE(KwElif, "elif");
-  CND_MM_LOCAL_CASE(KwElse, "else");
-  CND_MM_LOCAL_CASE(KwCxif, "cxif");
-  CND_MM_LOCAL_CASE(KwCxelif, "cxelif");
-  CND_MM_LOCAL_CASE(KwCxelse, "cxelse");
-  CND_MM_LOCAL_CASE(KwSwitch, "switch");
-  CND_MM_LOCAL_CASE(KwCase, "case");
-  CND_MM_LOCAL_CASE(KwDefault, "default");
-  CND_MM_LOCAL_CASE(KwWhile, "while");
-  CND_MM_LOCAL_CASE(KwFor, "for");
-  CND_MM_LOCAL_CASE(KwReturn, "return");
-  CND_MM_LOCAL_CASE(KwBreak, "break");
-  CND_MM_LOCAL_CASE(KwContinue, "continue");
+  CND_MM_LOCAL_ENTRY(KwIf, "if")
+  CND_MM_LOCAL_ENTRY(KwElif, "elif")
+  CND_MM_LOCAL_ENTRY(KwElse, "else")
+  CND_MM_LOCAL_ENTRY(KwCxif, "cxif")
+  CND_MM_LOCAL_ENTRY(KwCxelif, "cxelif")
+  CND_MM_LOCAL_ENTRY(KwCxelse, "cxelse")
+  CND_MM_LOCAL_ENTRY(KwSwitch, "switch")
+  CND_MM_LOCAL_ENTRY(KwCase, "case")
+  CND_MM_LOCAL_ENTRY(KwDefault, "default")
+  CND_MM_LOCAL_ENTRY(KwWhile, "while")
+  CND_MM_LOCAL_ENTRY(KwFor, "for")
+  CND_MM_LOCAL_ENTRY(KwReturn, "return")
+  CND_MM_LOCAL_ENTRY(KwBreak, "break")
+  CND_MM_LOCAL_ENTRY(KwContinue, "continue")
   // Types
-  CND_MM_LOCAL_CASE(KwInt, "int");
-  CND_MM_LOCAL_CASE(KwUint, "uint");
-  CND_MM_LOCAL_CASE(KwReal, "real");
-  CND_MM_LOCAL_CASE(KwBool, "bool");
-  CND_MM_LOCAL_CASE(KwChar, "char");
-  CND_MM_LOCAL_CASE(KwByte, "byte");
-  CND_MM_LOCAL_CASE(KwCstr, "cstr");
-  CND_MM_LOCAL_CASE(KwStr, "str");
-  CND_MM_LOCAL_CASE(KwPtr, "ptr");
-  CND_MM_LOCAL_CASE(KwList, "list");
-  CND_MM_LOCAL_CASE(KwArray, "array");
+  CND_MM_LOCAL_ENTRY(KwInt, "int")
+  CND_MM_LOCAL_ENTRY(KwUint, "uint")
+  CND_MM_LOCAL_ENTRY(KwReal, "real")
+  CND_MM_LOCAL_ENTRY(KwBool, "bool")
+  CND_MM_LOCAL_ENTRY(KwChar, "char")
+  CND_MM_LOCAL_ENTRY(KwByte, "byte")
+  CND_MM_LOCAL_ENTRY(KwCstr, "cstr")
+  CND_MM_LOCAL_ENTRY(KwStr, "str")
+  CND_MM_LOCAL_ENTRY(KwPtr, "ptr")
+  CND_MM_LOCAL_ENTRY(KwList, "list")
+  CND_MM_LOCAL_ENTRY(KwArray, "array")
   // Constants
-  CND_MM_LOCAL_CASE(KwTrue, "true");
-  CND_MM_LOCAL_CASE(KwFalse, "false");
-  CND_MM_LOCAL_CASE(KwNone, "none");
-  CND_MM_LOCAL_CASE(KwVoid, "void");
+  CND_MM_LOCAL_ENTRY(KwTrue, "true")
+  CND_MM_LOCAL_ENTRY(KwFalse, "false")
+  CND_MM_LOCAL_ENTRY(KwNone, "none")
+  CND_MM_LOCAL_ENTRY(KwVoid, "void")
   // Functional
-  CND_MM_LOCAL_CASE(KwIn, "in");
-  CND_MM_LOCAL_CASE(KwAs, "as");
-  CND_MM_LOCAL_CASE(KwCin, "cin");
-  CND_MM_LOCAL_CASE(KwCout, "cout");
-  CND_MM_LOCAL_CASE(KwNative, "native");
+  CND_MM_LOCAL_ENTRY(KwIn, "in")
+  CND_MM_LOCAL_ENTRY(KwAs, "as")
+  CND_MM_LOCAL_ENTRY(KwCin, "cin")
+  CND_MM_LOCAL_ENTRY(KwCout, "cout")
+  CND_MM_LOCAL_ENTRY(KwNative, "native")
   // Modifiers
-  CND_MM_LOCAL_CASE(KwConst, "const");
-  CND_MM_LOCAL_CASE(KwRef, "ref");
-  CND_MM_LOCAL_CASE(KwPrivate, "private");
-  CND_MM_LOCAL_CASE(KwPublic, "public");
-  CND_MM_LOCAL_CASE(KwStatic, "static");
+  CND_MM_LOCAL_ENTRY(KwConst, "const")
+  CND_MM_LOCAL_ENTRY(KwRef, "ref")
+  CND_MM_LOCAL_ENTRY(KwPrivate, "private")
+  CND_MM_LOCAL_ENTRY(KwPublic, "public")
+  CND_MM_LOCAL_ENTRY(KwStatic, "static")
   // Meta Types
-  CND_MM_LOCAL_CASE(KwAny, "any");
-  CND_MM_LOCAL_CASE(KwAuto, "auto");
-  CND_MM_LOCAL_CASE(KwType, "type");
-  CND_MM_LOCAL_CASE(KwValue, "value");
-  CND_MM_LOCAL_CASE(KwTemplate, "template");
-  CND_MM_LOCAL_CASE(DirectiveInclude, "#include");
-  CND_MM_LOCAL_CASE(DirectiveDefMacro, "#defmacro");
-  CND_MM_LOCAL_CASE(DirectiveEndmacro, "#endmacro");
-  CND_MM_LOCAL_CASE(DirectiveIf, "#if");
-  CND_MM_LOCAL_CASE(DirectiveElse, "#else");
-  CND_MM_LOCAL_CASE(DirectiveElif, "#elif");
-  CND_MM_LOCAL_CASE(DirectiveEndif, "#endif");
-  CND_MM_LOCAL_CASE(DirectiveIfdef, "#ifdef");
-  CND_MM_LOCAL_CASE(DirectiveIfndef, "#ifndef");
-  CND_MM_LOCAL_CASE(DirectiveUndef, "#undef");
+  CND_MM_LOCAL_ENTRY(KwAny, "any")
+  CND_MM_LOCAL_ENTRY(KwAuto, "auto")
+  CND_MM_LOCAL_ENTRY(KwType, "type")
+  CND_MM_LOCAL_ENTRY(KwValue, "value")
+  CND_MM_LOCAL_ENTRY(KwTemplate, "template")
+  CND_MM_LOCAL_ENTRY(DirectiveInclude, "#include")
+  CND_MM_LOCAL_ENTRY(DirectiveDefMacro, "#defmacro")
+  CND_MM_LOCAL_ENTRY(DirectiveEndmacro, "#endmacro")
+  CND_MM_LOCAL_ENTRY(DirectiveIf, "#if")
+  CND_MM_LOCAL_ENTRY(DirectiveElse, "#else")
+  CND_MM_LOCAL_ENTRY(DirectiveElif, "#elif")
+  CND_MM_LOCAL_ENTRY(DirectiveEndif, "#endif")
+  CND_MM_LOCAL_ENTRY(DirectiveIfdef, "#ifdef")
+  CND_MM_LOCAL_ENTRY(DirectiveIfndef, "#ifndef")
+  CND_MM_LOCAL_ENTRY(DirectiveUndef, "#undef")
   // Operators
-  CND_MM_LOCAL_CASE(Hash, "#");
-  CND_MM_LOCAL_CASE(Add, "+");
-  CND_MM_LOCAL_CASE(Sub, "-");
-  CND_MM_LOCAL_CASE(Mul, "*");
-  CND_MM_LOCAL_CASE(Div, "/");
-  CND_MM_LOCAL_CASE(Mod, "%");
-  CND_MM_LOCAL_CASE(And, "&");
-  CND_MM_LOCAL_CASE(Or, "|");
-  CND_MM_LOCAL_CASE(Xor, "^");
-  CND_MM_LOCAL_CASE(Not, "!");
-  CND_MM_LOCAL_CASE(Lsh, "<<");
-  CND_MM_LOCAL_CASE(Rsh, ">>");
-  CND_MM_LOCAL_CASE(Eq, "==");
-  CND_MM_LOCAL_CASE(Neq, "!=");
-  CND_MM_LOCAL_CASE(Lt, "<");
-  CND_MM_LOCAL_CASE(Gt, ">");
-  CND_MM_LOCAL_CASE(Lte, "<=");
-  CND_MM_LOCAL_CASE(Gte, ">=");
-  CND_MM_LOCAL_CASE(Assign, "=");
-  CND_MM_LOCAL_CASE(NewAssign, " : =");
-  CND_MM_LOCAL_CASE(AddAssign, "+=");
-  CND_MM_LOCAL_CASE(SubAssign, "-=");
-  CND_MM_LOCAL_CASE(MulAssign, "*=");
-  CND_MM_LOCAL_CASE(DivAssign, "/=");
-  CND_MM_LOCAL_CASE(ModAssign, "%=");
-  CND_MM_LOCAL_CASE(AndAssign, "&=");
-  CND_MM_LOCAL_CASE(OrAssign, "|=");
-  CND_MM_LOCAL_CASE(XorAssign, "^=");
-  CND_MM_LOCAL_CASE(LshAssign, "<<=");
-  CND_MM_LOCAL_CASE(RshAssign, ">>=");
-  CND_MM_LOCAL_CASE(Inc, "++");
-  CND_MM_LOCAL_CASE(Dec, "--");
-  CND_MM_LOCAL_CASE(Dot, ".");
-  CND_MM_LOCAL_CASE(Bnot, "~");
-  CND_MM_LOCAL_CASE(Band, "&&");
-  CND_MM_LOCAL_CASE(Bor, "||");
-  CND_MM_LOCAL_CASE(Spaceship, "<=>");
+  CND_MM_LOCAL_ENTRY(Hash, "#")
+  CND_MM_LOCAL_ENTRY(Add, "+")
+  CND_MM_LOCAL_ENTRY(Sub, "-")
+  CND_MM_LOCAL_ENTRY(Mul, "*")
+  CND_MM_LOCAL_ENTRY(Div, "/")
+  CND_MM_LOCAL_ENTRY(Mod, "%")
+  CND_MM_LOCAL_ENTRY(And, "&")
+  CND_MM_LOCAL_ENTRY(Or, "|")
+  CND_MM_LOCAL_ENTRY(Xor, "^")
+  CND_MM_LOCAL_ENTRY(Not, "!")
+  CND_MM_LOCAL_ENTRY(Lsh, "<<")
+  CND_MM_LOCAL_ENTRY(Rsh, ">>")
+  CND_MM_LOCAL_ENTRY(Eq, "==")
+  CND_MM_LOCAL_ENTRY(Neq, "!=")
+  CND_MM_LOCAL_ENTRY(Lt, "<")
+  CND_MM_LOCAL_ENTRY(Gt, ">")
+  CND_MM_LOCAL_ENTRY(Lte, "<=")
+  CND_MM_LOCAL_ENTRY(Gte, ">=")
+  CND_MM_LOCAL_ENTRY(Assign, "=")
+  CND_MM_LOCAL_ENTRY(NewAssign, " : =")
+  CND_MM_LOCAL_ENTRY(AddAssign, "+=")
+  CND_MM_LOCAL_ENTRY(SubAssign, "-=")
+  CND_MM_LOCAL_ENTRY(MulAssign, "*=")
+  CND_MM_LOCAL_ENTRY(DivAssign, "/=")
+  CND_MM_LOCAL_ENTRY(ModAssign, "%=")
+  CND_MM_LOCAL_ENTRY(AndAssign, "&=")
+  CND_MM_LOCAL_ENTRY(OrAssign, "|=")
+  CND_MM_LOCAL_ENTRY(XorAssign, "^=")
+  CND_MM_LOCAL_ENTRY(LshAssign, "<<=")
+  CND_MM_LOCAL_ENTRY(RshAssign, ">>=")
+  CND_MM_LOCAL_ENTRY(Inc, "++")
+  CND_MM_LOCAL_ENTRY(Dec, "--")
+  CND_MM_LOCAL_ENTRY(Dot, ".")
+  CND_MM_LOCAL_ENTRY(Bnot, "~")
+  CND_MM_LOCAL_ENTRY(Band, "&&")
+  CND_MM_LOCAL_ENTRY(Bor, "||")
+  CND_MM_LOCAL_ENTRY(Spaceship, "<=>")
   // Scopes
-  CND_MM_LOCAL_CASE(LParen, "(");
-  CND_MM_LOCAL_CASE(RParen, ")");
-  CND_MM_LOCAL_CASE(LBrace, "{");
-  CND_MM_LOCAL_CASE(RBrace, "}");
-  CND_MM_LOCAL_CASE(LBracket, "[");
-  CND_MM_LOCAL_CASE(RBracket, "]");
-  CND_MM_LOCAL_CASE(Semicolon, ";");
-  CND_MM_LOCAL_CASE(Colon, ":");
-  CND_MM_LOCAL_CASE(Comma, ",");
-  CND_MM_LOCAL_CASE(Period, ".");
-  CND_MM_LOCAL_CASE(DoubleColon, "::");
-  CND_MM_LOCAL_CASE(Ellipsis, "...");
-  CND_MM_LOCAL_CASE(CommercialAt, "@");
+  CND_MM_LOCAL_ENTRY(LParen, "(")
+  CND_MM_LOCAL_ENTRY(RParen, ")")
+  CND_MM_LOCAL_ENTRY(LBrace, "{")
+  CND_MM_LOCAL_ENTRY(RBrace, "}")
+  CND_MM_LOCAL_ENTRY(LBracket, "[")
+  CND_MM_LOCAL_ENTRY(RBracket, "]")
+  CND_MM_LOCAL_ENTRY(Semicolon, ";")
+  CND_MM_LOCAL_ENTRY(Colon, ":")
+  CND_MM_LOCAL_ENTRY(Comma, ",")
+  CND_MM_LOCAL_ENTRY(Period, ".")
+  CND_MM_LOCAL_ENTRY(DoubleColon, "::")
+  CND_MM_LOCAL_ENTRY(Ellipsis, "...")
+  CND_MM_LOCAL_ENTRY(CommercialAt, "@")
   // Special
-  CND_MM_LOCAL_CASE(Eofile, "\0");
-  CND_MM_LOCAL_CASE(Whitespace, " ");
-  CND_MM_LOCAL_CASE(Newline, "\n");
-  CND_MM_LOCAL_CASE(BlockComment, "///");
-  CND_MM_LOCAL_CASE(LineComment, "//");
-#undef CND_MM_LOCAL_CASE
-  else return eTk::kNONE;
+  CND_MM_LOCAL_ENTRY(Eofile, "\0")
+  CND_MM_LOCAL_ENTRY(Whitespace, " ")
+  CND_MM_LOCAL_ENTRY(Newline, "\n")
+  CND_MM_LOCAL_ENTRY(BlockComment, "///")
+  CND_MM_LOCAL_ENTRY(LineComment, "//")
+};
+#undef CND_MM_LOCAL_ENTRY
+
+inline constexpr Size kTkKeywordMaxLength = [] {
+  Size max_length = 0;
+  for (const auto& e : kTkKeywordEntries) max_length = e.literal.size() > max_length ? e.literal.size() : max_length;
+  return max_length;
+}();
+
+/// @brief Keyword entries bucketed by (length, first char), built at compile time with a counting sort.
+///
+/// Bucket 'length * 256 + first char' spans [bucket_offsets[bucket], bucket_offsets[bucket + 1]) in 'entries'.
+/// Entries keep their declaration order within a bucket, so the first-entry-wins rule is preserved. Most buckets
+/// are empty or hold one entry, so a lookup is at most a couple of string compares.
+struct TkKeywordIndex {
+  static constexpr Size kBucketCount = (kTkKeywordMaxLength + 1) * 256;
+  std::array<TkKeywordEntry, std::size(kTkKeywordEntries)> entries{};
+  std::array<UI8, kBucketCount + 1> bucket_offsets{};
+
+  static constexpr Size BucketOf(StrView literal) noexcept {
+    return literal.size() * 256 + static_cast<UChar>(literal[0]);
+  }
+};
+static_assert(std::size(kTkKeywordEntries) <= std::numeric_limits<UI8>::max(), "Bucket offsets are stored as UI8.");
+
+inline constexpr TkKeywordIndex kTkKeywordIndex = [] {
+  TkKeywordIndex index{};
+  std::array<UI8, TkKeywordIndex::kBucketCount + 1> next_slot{};
+  for (const auto& e : kTkKeywordEntries)  // Empty literals can never be looked up.
+    if (!e.literal.empty()) index.bucket_offsets[TkKeywordIndex::BucketOf(e.literal) + 1]++;
+  for (Size b = 0; b < TkKeywordIndex::kBucketCount; b++) index.bucket_offsets[b + 1] += index.bucket_offsets[b];
+  next_slot = index.bucket_offsets;
+  for (const auto& e : kTkKeywordEntries)
+    if (!e.literal.empty()) index.entries[next_slot[TkKeywordIndex::BucketOf(e.literal)]++] = e;
+  return index;
+}();
+}  // namespace detail
+
+constexpr eTk GetTkFromKeyword(StrView kw) noexcept {
+  using detail::kTkKeywordIndex;
+  using detail::TkKeywordIndex;
+  // Most identifiers are rejected here by length alone, or by an empty (length, first char) bucket below.
+  if (kw.empty() || kw.size() > detail::kTkKeywordMaxLength) return eTk::kNONE;
+  const Size bucket = TkKeywordIndex::BucketOf(kw);
+  for (Size i = kTkKeywordIndex.bucket_offsets[bucket]; i < kTkKeywordIndex.bucket_offsets[bucket + 1]; i++)
+    if (kTkKeywordIndex.entries[i].literal == kw) return kTkKeywordIndex.entries[i].type;
+  return eTk::kNONE;
 };
 
 }  // namespace cnd::corevals::grammar
@@ -89,11 +89,30 @@ enum class eTypeIndex : std::size_t {
   MapIter
 };
 
+/// Meta types, integrals, floating points and constant strings are stored inline in the AnyValue, so creating and
+/// copying them never allocates. Strings, containers and iterators are reference counted heap objects. Strings and
+/// containers are copied on write, a copy shares the data until either side is mutated.
+template <class T>
+inline constexpr bool kIsInlineValue =
+    std::same_as<T, Undefined> || std::same_as<T, None> || std::same_as<T, Error> || std::same_as<T, I8> ||
+    std::same_as<T, I16> || std::same_as<T, I32> || std::same_as<T, I64> || std::same_as<T, Bool> ||
+    std::same_as<T, U8> || std::same_as<T, U16> || std::same_as<T, U32> || std::same_as<T, U64> ||
+    std::same_as<T, F32> || std::same_as<T, F64> || std::same_as<T, CStr>;
+
+template <class T>
+inline constexpr bool kIsCowValue = std::same_as<T, String> || std::same_as<T, Array> || std::same_as<T, Map>;
+
+/// Storage of a value of type T inside an AnyValue.
+template <class T>
+using ValueObject = std::conditional_t<kIsInlineValue<T>, InlineObject<T>,
+                                       std::conditional_t<kIsCowValue<T>, CowObject<T>, RefObject<T>>>;
+
 using AnyVariantBase =
-    std::variant<RefObject<Undefined>, RefObject<None>, RefObject<Error>, RefObject<I8>, RefObject<I16>, RefObject<I32>,
-                 RefObject<I64>, RefObject<Bool>, RefObject<U8>, RefObject<U16>, RefObject<U32>, RefObject<U64>,
-                 RefObject<F32>, RefObject<F64>, RefObject<CStr>, RefObject<String>, RefObject<Array>, RefObject<Map>,
-                 RefObject<StrIter>, RefObject<ArrayIter>, RefObject<MapIter>>;
+    std::variant<ValueObject<Undefined>, ValueObject<None>, ValueObject<Error>, ValueObject<I8>, ValueObject<I16>,
+                 ValueObject<I32>, ValueObject<I64>, ValueObject<Bool>, ValueObject<U8>, ValueObject<U16>,
+                 ValueObject<U32>, ValueObject<U64>, ValueObject<F32>, ValueObject<F64>, ValueObject<CStr>,
+                 ValueObject<String>, ValueObject<Array>, ValueObject<Map>, ValueObject<StrIter>,
+                 ValueObject<ArrayIter>, ValueObject<MapIter>>;
 
 template<class T>
 concept iIntegral =
@@ -324,10 +343,14 @@ struct Array {
 };
 
 struct Map {
-  using DataT = std::unordered_map<String::DataT, AnyValue>;
+  using DataT = FlatMap<String::DataT, AnyValue>;
   DataT data;
 };
 
+// A clone of a shared container copies its elements, nested containers are shared until they are mutated.
+Array CowClone(const Array& value);
+Map CowClone(const Map& value);
+
 struct StrIter {
   using DataT = std::string::iterator;
   DataT data;
@@ -339,7 +362,7 @@ struct ArrayIter {
 };
 
 struct MapIter {
-  using DataT = std::unordered_map<String::DataT, AnyValue>::iterator;
+  using DataT = Map::DataT::iterator;
   DataT data;
 };
 
@@ -350,16 +373,16 @@ struct AnyValue : public AnyVariantBase {
 
   template <class T>
   static constexpr AnyValue Make() noexcept {
-    return RefObject<T>{};
+    return ValueObject<T>{};
   }
 
   template <class T, class... ArgTs>
   static constexpr AnyValue Make(ArgTs... args) noexcept {
-    return RefObject<T>::New(kInplaceConstructor, std::forward<ArgTs>(args)...);
+    return ValueObject<T>::New(kInplaceConstructor, std::forward<ArgTs>(args)...);
   }
 
   static constexpr AnyValue MakeInvalidOpError() noexcept {
-    return RefObject<Error>::New(kInplaceConstructor, "Invalid Operation");
+    return ValueObject<Error>::New(kInplaceConstructor, "Invalid Operation");
   }
 
   template <typename T>
@@ -372,27 +395,29 @@ struct AnyValue : public AnyVariantBase {
     return other.Move();
   }
 
+  // Inline values are stored in the AnyValue which holds them, a reference could not alias the original.
+  static constexpr AnyValue MakeScalarRefError() noexcept {
+    return ValueObject<Error>::New(kInplaceConstructor, "Cannot reference a scalar value.");
+  }
+
   template <typename T>
   static constexpr AnyValue MakeRef(T& other) noexcept {
-    return other.MakeRef();
+    if constexpr (requires { other.MakeRef(); })
+      return other.MakeRef();
+    else
+      return MakeScalarRefError();
   }
 
   template <typename T>
   static constexpr AnyValue WeakRef(T& other) noexcept {
-    return other.NewWeak(other.ptr);
+    if constexpr (requires { other.MakeWeak(); })
+      return other.MakeWeak();
+    else
+      return MakeScalarRefError();
   }
 
   static constexpr AnyValue Copy(const AnyValue& other) noexcept {
-    if (Is<Map>(other)) {
-      // Visit each key-value pair and copy them
-      auto& map = CppRef<Map>(other);
-      Map new_map;
-      for (auto& [key, value] : map.data) {
-        new_map.data[key] = Copy(value);
-      }
-      return Make<Map>(new_map);
-    } else
-      return std::visit([&](auto&& arg) -> AnyValue { return arg.Copy(); }, other);
+    return std::visit([&](auto&& arg) -> AnyValue { return arg.Copy(); }, other);
   }
 
   static constexpr AnyValue Move(AnyValue& other) noexcept {
@@ -407,19 +432,22 @@ struct AnyValue : public AnyVariantBase {
     return std::visit([&](auto&& arg) -> AnyValue { return WeakRef(arg); }, other);
   }
 
+  // True if the value is stored inline, see kIsInlineValue.
+  static constexpr bool IsInline(const AnyValue& self) noexcept { return self.TypeIndex() <= eTypeIndex::CStr; }
+
   template <typename T>
   static constexpr bool Is(const AnyValue& self) noexcept {
-    return std::holds_alternative<RefObject<T>>(self);
+    return std::holds_alternative<ValueObject<T>>(self);
   }
 
   template <typename T>
-  static constexpr RefObject<T>& Ref(AnyValue& self) {
-    return std::get<RefObject<T>>(self);
+  static constexpr ValueObject<T>& Ref(AnyValue& self) {
+    return std::get<ValueObject<T>>(self);
   }
 
   template <typename T>
-  static constexpr const RefObject<T>& Ref(const AnyValue& self) {
-    return std::get<RefObject<T>>(self);
+  static constexpr const ValueObject<T>& Ref(const AnyValue& self) {
+    return std::get<ValueObject<T>>(self);
   }
 
   template <typename T>
@@ -1117,32 +1145,28 @@ struct AnyValue : public AnyVariantBase {
     }
   }
 
-  template <class T>
-    requires(!std::is_same_v<T, AnyValue>)
+  // Bitwise operations are only defined for integral operands.
+  template <iIntegral T>
   static constexpr AnyValue And(const AnyValue& lhs, const T& rhs) {
     switch (lhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Make<I32>(CppRef<I8>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I8>(lhs).data & rhs.data);
       case eTypeIndex::I16:
-        return Make<I32>(CppRef<I16>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I16>(lhs).data & rhs.data);
       case eTypeIndex::I32:
-        return Make<I32>(CppRef<I32>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I32>(lhs).data & rhs.data);
       case eTypeIndex::I64:
-        return Make<I64>(CppRef<I64>(lhs).data / rhs.data);
+        return Make<I64>(CppRef<I64>(lhs).data & rhs.data);
       case eTypeIndex::Bool:
-        return Make<U32>(CppRef<Bool>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<Bool>(lhs).data & rhs.data);
       case eTypeIndex::U8:
-        return Make<U32>(CppRef<U8>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U8>(lhs).data & rhs.data);
       case eTypeIndex::U16:
-        return Make<U32>(CppRef<U16>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U16>(lhs).data & rhs.data);
       case eTypeIndex::U32:
-        return Make<U32>(CppRef<U32>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U32>(lhs).data & rhs.data);
       case eTypeIndex::U64:
-        return Make<U64>(CppRef<U64>(lhs).data / rhs.data);
-      case eTypeIndex::F32:
-        return Make<F32>(CppRef<F32>(lhs).data / rhs.data);
-      case eTypeIndex::F64:
-        return Make<F64>(CppRef<F64>(lhs).data / rhs.data);
+        return Make<U64>(CppRef<U64>(lhs).data & rhs.data);
       default:
         return MakeInvalidOpError();
     }
@@ -1151,58 +1175,49 @@ struct AnyValue : public AnyVariantBase {
   static constexpr AnyValue And(const AnyValue& self, const AnyValue& rhs) {
     switch (rhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Div(self, CppRef<I32>(rhs));
+        return And(self, CppRef<I8>(rhs));
       case eTypeIndex::I16:
-        return Div(self, CppRef<I16>(rhs));
+        return And(self, CppRef<I16>(rhs));
       case eTypeIndex::I32:
-        return Div(self, CppRef<I32>(rhs));
+        return And(self, CppRef<I32>(rhs));
       case eTypeIndex::I64:
-        return Div(self, CppRef<I64>(rhs));
+        return And(self, CppRef<I64>(rhs));
       case eTypeIndex::Bool:
-        return Div(self, CppRef<Bool>(rhs));
+        return And(self, CppRef<Bool>(rhs));
       case eTypeIndex::U8:
-        return Div(self, CppRef<U8>(rhs));
+        return And(self, CppRef<U8>(rhs));
       case eTypeIndex::U16:
-        return Div(self, CppRef<U16>(rhs));
+        return And(self, CppRef<U16>(rhs));
       case eTypeIndex::U32:
-        return Div(self, CppRef<U32>(rhs));
+        return And(self, CppRef<U32>(rhs));
       case eTypeIndex::U64:
-        return Div(self, CppRef<U64>(rhs));
-      case eTypeIndex::F32:
-        return Div(self, CppRef<F32>(rhs));
-      case eTypeIndex::F64:
-        return Div(self, CppRef<F64>(rhs));
+        return And(self, CppRef<U64>(rhs));
       default:
         return MakeInvalidOpError();
     }
   }
 
-  template <class T>
-    requires(!std::is_same_v<T, AnyValue>)
+  template <iIntegral T>
   static constexpr AnyValue Or(const AnyValue& lhs, const T& rhs) {
     switch (lhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Make<I32>(CppRef<I8>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I8>(lhs).data | rhs.data);
       case eTypeIndex::I16:
-        return Make<I32>(CppRef<I16>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I16>(lhs).data | rhs.data);
       case eTypeIndex::I32:
-        return Make<I32>(CppRef<I32>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I32>(lhs).data | rhs.data);
       case eTypeIndex::I64:
-        return Make<I64>(CppRef<I64>(lhs).data / rhs.data);
+        return Make<I64>(CppRef<I64>(lhs).data | rhs.data);
       case eTypeIndex::Bool:
-        return Make<U32>(CppRef<Bool>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<Bool>(lhs).data | rhs.data);
       case eTypeIndex::U8:
-        return Make<U32>(CppRef<U8>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U8>(lhs).data | rhs.data);
       case eTypeIndex::U16:
-        return Make<U32>(CppRef<U16>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U16>(lhs).data | rhs.data);
       case eTypeIndex::U32:
-        return Make<U32>(CppRef<U32>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U32>(lhs).data | rhs.data);
       case eTypeIndex::U64:
-        return Make<U64>(CppRef<U64>(lhs).data / rhs.data);
-      case eTypeIndex::F32:
-        return Make<F32>(CppRef<F32>(lhs).data / rhs.data);
-      case eTypeIndex::F64:
-        return Make<F64>(CppRef<F64>(lhs).data / rhs.data);
+        return Make<U64>(CppRef<U64>(lhs).data | rhs.data);
       default:
         return MakeInvalidOpError();
     }
@@ -1211,58 +1226,49 @@ struct AnyValue : public AnyVariantBase {
   static constexpr AnyValue Or(const AnyValue& self, const AnyValue& rhs) {
     switch (rhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Div(self, CppRef<I32>(rhs));
+        return Or(self, CppRef<I8>(rhs));
       case eTypeIndex::I16:
-        return Div(self, CppRef<I16>(rhs));
+        return Or(self, CppRef<I16>(rhs));
       case eTypeIndex::I32:
-        return Div(self, CppRef<I32>(rhs));
+        return Or(self, CppRef<I32>(rhs));
       case eTypeIndex::I64:
-        return Div(self, CppRef<I64>(rhs));
+        return Or(self, CppRef<I64>(rhs));
       case eTypeIndex::Bool:
-        return Div(self, CppRef<Bool>(rhs));
+        return Or(self, CppRef<Bool>(rhs));
       case eTypeIndex::U8:
-        return Div(self, CppRef<U8>(rhs));
+        return Or(self, CppRef<U8>(rhs));
       case eTypeIndex::U16:
-        return Div(self, CppRef<U16>(rhs));
+        return Or(self, CppRef<U16>(rhs));
       case eTypeIndex::U32:
-        return Div(self, CppRef<U32>(rhs));
+        return Or(self, CppRef<U32>(rhs));
       case eTypeIndex::U64:
-        return Div(self, CppRef<U64>(rhs));
-      case eTypeIndex::F32:
-        return Div(self, CppRef<F32>(rhs));
-      case eTypeIndex::F64:
-        return Div(self, CppRef<F64>(rhs));
+        return Or(self, CppRef<U64>(rhs));
       default:
         return MakeInvalidOpError();
     }
   }
 
-  template <class T>
-    requires(!std::is_same_v<T, AnyValue>)
+  template <iIntegral T>
   static constexpr AnyValue Xor(const AnyValue& lhs, const T& rhs) {
     switch (lhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Make<I32>(CppRef<I8>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I8>(lhs).data ^ rhs.data);
       case eTypeIndex::I16:
-        return Make<I32>(CppRef<I16>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I16>(lhs).data ^ rhs.data);
       case eTypeIndex::I32:
-        return Make<I32>(CppRef<I32>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I32>(lhs).data ^ rhs.data);
       case eTypeIndex::I64:
-        return Make<I64>(CppRef<I64>(lhs).data / rhs.data);
+        return Make<I64>(CppRef<I64>(lhs).data ^ rhs.data);
       case eTypeIndex::Bool:
-        return Make<U32>(CppRef<Bool>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<Bool>(lhs).data ^ rhs.data);
       case eTypeIndex::U8:
-        return Make<U32>(CppRef<U8>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U8>(lhs).data ^ rhs.data);
       case eTypeIndex::U16:
-        return Make<U32>(CppRef<U16>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U16>(lhs).data ^ rhs.data);
       case eTypeIndex::U32:
-        return Make<U32>(CppRef<U32>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U32>(lhs).data ^ rhs.data);
       case eTypeIndex::U64:
-        return Make<U64>(CppRef<U64>(lhs).data / rhs.data);
-      case eTypeIndex::F32:
-        return Make<F32>(CppRef<F32>(lhs).data / rhs.data);
-      case eTypeIndex::F64:
-        return Make<F64>(CppRef<F64>(lhs).data / rhs.data);
+        return Make<U64>(CppRef<U64>(lhs).data ^ rhs.data);
       default:
         return MakeInvalidOpError();
     }
@@ -1271,58 +1277,49 @@ struct AnyValue : public AnyVariantBase {
   static constexpr AnyValue Xor(const AnyValue& self, const AnyValue& rhs) {
     switch (rhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Div(self, CppRef<I32>(rhs));
+        return Xor(self, CppRef<I8>(rhs));
       case eTypeIndex::I16:
-        return Div(self, CppRef<I16>(rhs));
+        return Xor(self, CppRef<I16>(rhs));
       case eTypeIndex::I32:
-        return Div(self, CppRef<I32>(rhs));
+        return Xor(self, CppRef<I32>(rhs));
       case eTypeIndex::I64:
-        return Div(self, CppRef<I64>(rhs));
+        return Xor(self, CppRef<I64>(rhs));
       case eTypeIndex::Bool:
-        return Div(self, CppRef<Bool>(rhs));
+        return Xor(self, CppRef<Bool>(rhs));
       case eTypeIndex::U8:
-        return Div(self, CppRef<U8>(rhs));
+        return Xor(self, CppRef<U8>(rhs));
       case eTypeIndex::U16:
-        return Div(self, CppRef<U16>(rhs));
+        return Xor(self, CppRef<U16>(rhs));
       case eTypeIndex::U32:
-        return Div(self, CppRef<U32>(rhs));
+        return Xor(self, CppRef<U32>(rhs));
       case eTypeIndex::U64:
-        return Div(self, CppRef<U64>(rhs));
-      case eTypeIndex::F32:
-        return Div(self, CppRef<F32>(rhs));
-      case eTypeIndex::F64:
-        return Div(self, CppRef<F64>(rhs));
+        return Xor(self, CppRef<U64>(rhs));
       default:
         return MakeInvalidOpError();
     }
   }
 
-  template <class T>
-    requires(!std::is_same_v<T, AnyValue>)
+  template <iIntegral T>
   static constexpr AnyValue Lsh(const AnyValue& lhs, const T& rhs) {
     switch (lhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Make<I32>(CppRef<I8>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I8>(lhs).data << rhs.data);
       case eTypeIndex::I16:
-        return Make<I32>(CppRef<I16>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I16>(lhs).data << rhs.data);
       case eTypeIndex::I32:
-        return Make<I32>(CppRef<I32>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I32>(lhs).data << rhs.data);
       case eTypeIndex::I64:
-        return Make<I64>(CppRef<I64>(lhs).data / rhs.data);
+        return Make<I64>(CppRef<I64>(lhs).data << rhs.data);
       case eTypeIndex::Bool:
-        return Make<U32>(CppRef<Bool>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<Bool>(lhs).data << rhs.data);
       case eTypeIndex::U8:
-        return Make<U32>(CppRef<U8>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U8>(lhs).data << rhs.data);
       case eTypeIndex::U16:
-        return Make<U32>(CppRef<U16>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U16>(lhs).data << rhs.data);
       case eTypeIndex::U32:
-        return Make<U32>(CppRef<U32>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U32>(lhs).data << rhs.data);
       case eTypeIndex::U64:
-        return Make<U64>(CppRef<U64>(lhs).data / rhs.data);
-      case eTypeIndex::F32:
-        return Make<F32>(CppRef<F32>(lhs).data / rhs.data);
-      case eTypeIndex::F64:
-        return Make<F64>(CppRef<F64>(lhs).data / rhs.data);
+        return Make<U64>(CppRef<U64>(lhs).data << rhs.data);
       default:
         return MakeInvalidOpError();
     }
@@ -1331,58 +1328,49 @@ struct AnyValue : public AnyVariantBase {
   static constexpr AnyValue Lsh(const AnyValue& self, const AnyValue& rhs) {
     switch (rhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Div(self, CppRef<I32>(rhs));
+        return Lsh(self, CppRef<I8>(rhs));
       case eTypeIndex::I16:
-        return Div(self, CppRef<I16>(rhs));
+        return Lsh(self, CppRef<I16>(rhs));
       case eTypeIndex::I32:
-        return Div(self, CppRef<I32>(rhs));
+        return Lsh(self, CppRef<I32>(rhs));
       case eTypeIndex::I64:
-        return Div(self, CppRef<I64>(rhs));
+        return Lsh(self, CppRef<I64>(rhs));
       case eTypeIndex::Bool:
-        return Div(self, CppRef<Bool>(rhs));
+        return Lsh(self, CppRef<Bool>(rhs));
       case eTypeIndex::U8:
-        return Div(self, CppRef<U8>(rhs));
+        return Lsh(self, CppRef<U8>(rhs));
       case eTypeIndex::U16:
-        return Div(self, CppRef<U16>(rhs));
+        return Lsh(self, CppRef<U16>(rhs));
       case eTypeIndex::U32:
-        return Div(self, CppRef<U32>(rhs));
+        return Lsh(self, CppRef<U32>(rhs));
       case eTypeIndex::U64:
-        return Div(self, CppRef<U64>(rhs));
-      case eTypeIndex::F32:
-        return Div(self, CppRef<F32>(rhs));
-      case eTypeIndex::F64:
-        return Div(self, CppRef<F64>(rhs));
+        return Lsh(self, CppRef<U64>(rhs));
       default:
         return MakeInvalidOpError();
     }
   }
 
-  template <class T>
-    requires(!std::is_same_v<T, AnyValue>)
+  template <iIntegral T>
   static constexpr AnyValue Rsh(const AnyValue& lhs, const T& rhs) {
     switch (lhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Make<I32>(CppRef<I8>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I8>(lhs).data >> rhs.data);
       case eTypeIndex::I16:
-        return Make<I32>(CppRef<I16>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I16>(lhs).data >> rhs.data);
       case eTypeIndex::I32:
-        return Make<I32>(CppRef<I32>(lhs).data / rhs.data);
+        return Make<I32>(CppRef<I32>(lhs).data >> rhs.data);
       case eTypeIndex::I64:
-        return Make<I64>(CppRef<I64>(lhs).data / rhs.data);
+        return Make<I64>(CppRef<I64>(lhs).data >> rhs.data);
       case eTypeIndex::Bool:
-        return Make<U32>(CppRef<Bool>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<Bool>(lhs).data >> rhs.data);
       case eTypeIndex::U8:
-        return Make<U32>(CppRef<U8>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U8>(lhs).data >> rhs.data);
       case eTypeIndex::U16:
-        return Make<U32>(CppRef<U16>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U16>(lhs).data >> rhs.data);
       case eTypeIndex::U32:
-        return Make<U32>(CppRef<U32>(lhs).data / rhs.data);
+        return Make<U32>(CppRef<U32>(lhs).data >> rhs.data);
       case eTypeIndex::U64:
-        return Make<U64>(CppRef<U64>(lhs).data / rhs.data);
-      case eTypeIndex::F32:
-        return Make<F32>(CppRef<F32>(lhs).data / rhs.data);
-      case eTypeIndex::F64:
-        return Make<F64>(CppRef<F64>(lhs).data / rhs.data);
+        return Make<U64>(CppRef<U64>(lhs).data >> rhs.data);
       default:
         return MakeInvalidOpError();
     }
@@ -1391,27 +1379,23 @@ struct AnyValue : public AnyVariantBase {
   static constexpr AnyValue Rsh(const AnyValue& self, const AnyValue& rhs) {
     switch (rhs.TypeIndex()) {
       case eTypeIndex::I8:
-        return Div(self, CppRef<I32>(rhs));
+        return Rsh(self, CppRef<I8>(rhs));
       case eTypeIndex::I16:
-        return Div(self, CppRef<I16>(rhs));
+        return Rsh(self, CppRef<I16>(rhs));
       case eTypeIndex::I32:
-        return Div(self, CppRef<I32>(rhs));
+        return Rsh(self, CppRef<I32>(rhs));
       case eTypeIndex::I64:
-        return Div(self, CppRef<I64>(rhs));
+        return Rsh(self, CppRef<I64>(rhs));
       case eTypeIndex::Bool:
-        return Div(self, CppRef<Bool>(rhs));
+        return Rsh(self, CppRef<Bool>(rhs));
       case eTypeIndex::U8:
-        return Div(self, CppRef<U8>(rhs));
+        return Rsh(self, CppRef<U8>(rhs));
       case eTypeIndex::U16:
-        return Div(self, CppRef<U16>(rhs));
+        return Rsh(self, CppRef<U16>(rhs));
       case eTypeIndex::U32:
-        return Div(self, CppRef<U32>(rhs));
+        return Rsh(self, CppRef<U32>(rhs));
       case eTypeIndex::U64:
-        return Div(self, CppRef<U64>(rhs));
-      case eTypeIndex::F32:
-        return Div(self, CppRef<F32>(rhs));
-      case eTypeIndex::F64:
-        return Div(self, CppRef<F64>(rhs));
+        return Rsh(self, CppRef<U64>(rhs));
       default:
         return MakeInvalidOpError();
     }
@@ -2206,11 +2190,12 @@ struct AnyValue : public AnyVariantBase {
   bool operator>(AnyValue& rhs) { return LessThanDirect(rhs, *this); }
 
   static bool Release(AnyValue& self) {
-    if (Is<Array>(self)) {
+    // Elements are owned by the container data, which other references or copies may still observe.
+    if (Is<Array>(self) && Ref<Array>(self).IsSoleOwner()) {
       for (auto& elem : CppRef<Array>(self).data) {
         Release(elem);
       }
-    } else if (Is<Map>(self)) {
+    } else if (Is<Map>(self) && Ref<Map>(self).IsSoleOwner()) {
       for (auto& [key, value] : CppRef<Map>(self).data) {
         Release(value);
       }
@@ -2360,6 +2345,20 @@ struct AnyValue : public AnyVariantBase {
   }
 };
 
+inline Array CowClone(const Array& value) {
+  Array clone{};
+  clone.data.reserve(value.data.size());
+  for (const AnyValue& elem : value.data) clone.data.push_back(AnyValue::Copy(elem));
+  return clone;
+}
+
+inline Map CowClone(const Map& value) {
+  Map clone{};
+  clone.data.reserve(value.data.size());
+  for (const auto& [key, elem] : value.data) clone.data.emplace(key, AnyValue::Copy(elem));
+  return clone;
+}
+
 }  // namespace cnd::hir
 
 /// @} // end of cnd_compiler
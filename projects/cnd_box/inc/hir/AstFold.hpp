@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Constant folding and dead branch elimination over the Ast.
+///
+/// Binary operators whose operands are integer or boolean literals are computed with the AnyValue operators the
+/// evaluator uses, and replaced by a literal of the result. If and cxif clauses whose condition folds to a boolean
+/// are resolved: false clauses are removed, a true clause becomes the final else and the clauses after it are removed.
+/// Conditions which are not constant are left to the evaluator.
+///
+/// A folded literal has no token in the source, so the folder owns a token for it, carrying the location of the
+/// expression it replaced. Folded trees must not outlive their folder.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Ast.hpp"
+#include "hir/AnyValue.hpp"
+#include <deque>
+// clang-format on
+
+namespace cnd::hir {
+
+class AstFolder {
+ public:
+  /// Number of operators replaced by a literal.
+  Size FoldedExprs() const noexcept { return folded_exprs_; }
+  /// Number of if clauses removed, or reduced to an else, because their condition was constant.
+  Size PrunedClauses() const noexcept { return pruned_clauses_; }
+
+  /// @brief Fold 'ast' in place, bottom up. Folding a folded tree again changes nothing.
+  void Fold(Ast& ast);
+
+ private:
+  std::deque<Str> literal_text_{};  // Deques, so tokens and the text they view never move.
+  std::deque<Tk> literal_tokens_{};
+  Size folded_exprs_{0};
+  Size pruned_clauses_{0};
+
+  void FoldIf(Ast& stmt);
+  Opt<AV> LiteralValue(const Ast& node) const;
+  Opt<Ast> MakeLiteral(const AV& value, const Ast& replaced);
+};
+
+// Operator of a binary expression kind, or null if it is not folded.
+inline AV (*FoldableBinop(eAst type))(const AV&, const AV&) {
+  switch (type) {
+    case eAst::kAdd: return AV::Add;
+    case eAst::kSub: return AV::Sub;
+    case eAst::kMul: return AV::Mul;
+    case eAst::kDiv: return AV::Div;
+    case eAst::kMod: return AV::Mod;
+    case eAst::kAnd: return AV::And;
+    case eAst::kOr: return AV::Or;
+    case eAst::kXor: return AV::Xor;
+    case eAst::kLsh: return AV::Lsh;
+    case eAst::kRsh: return AV::Rsh;
+    case eAst::kEq: return AV::Eq;
+    case eAst::kNeq: return AV::Neq;
+    case eAst::kLt: return AV::Lt;
+    case eAst::kGt: return AV::Gt;
+    case eAst::kLte: return AV::Lte;
+    case eAst::kGte: return AV::Gte;
+    default: return nullptr;
+  }
+}
+
+inline void AstFolder::Fold(Ast& ast) {
+  for (Ast& child : ast.children) Fold(child);
+
+  // A parenthesized literal is the literal.
+  if (ast.TypeIs(eAst::kSubexpression) && ast.children.size() == 1 && LiteralValue(ast.At(0))) {
+    Ast inner = std::move(ast.children.front());
+    inner.parent = ast.parent;
+    ast = std::move(inner);
+    return;
+  }
+
+  if (ast.TypeIs(eAst::kIfStatement)) {
+    FoldIf(ast);
+    return;
+  }
+
+  auto binop = FoldableBinop(ast.type);
+  if (binop == nullptr || ast.children.size() != 2) return;
+  Opt<AV> lhs = LiteralValue(ast.At(0));
+  Opt<AV> rhs = LiteralValue(ast.At(1));
+  if (!lhs || !rhs) return;
+
+  // Division by zero is left for the evaluator to report.
+  if ((ast.TypeIs(eAst::kDiv) || ast.TypeIs(eAst::kMod)) && AV::Is<I32>(*rhs) && AV::CppRef<I32>(*rhs).data == 0)
+    return;
+
+  Opt<Ast> folded = MakeLiteral(binop(*lhs, *rhs), ast);
+  if (!folded) return;
+  ast = std::move(*folded);
+  folded_exprs_++;
+}
+
+inline void AstFolder::FoldIf(Ast& stmt) {
+  Vec<Ast> kept{};
+  for (Ast& clause : stmt.children) {
+    const bool is_else = clause.TypeIs(eAst::kKwElse) || clause.TypeIs(eAst::kKwCxelse);
+    Opt<AV> cond = is_else ? std::nullopt : LiteralValue(clause.At(0));
+    if (!cond || !AV::Is<Bool>(*cond)) {
+      kept.push_back(std::move(clause));
+      continue;
+    }
+
+    pruned_clauses_++;
+    if (!AV::CppRef<Bool>(*cond).data) continue;
+
+    // Taken whenever the clauses before it are not, which is what an else does.
+    const bool is_cx = clause.TypeIs(eAst::kKwCxif) || clause.TypeIs(eAst::kKwCxelif);
+    Ast taken{is_cx ? eAst::kKwCxelse : eAst::kKwElse};
+    taken.parent = clause.parent;
+    taken.src_begin = clause.src_begin;
+    taken.src_end = clause.src_end;
+    taken.children.push_back(std::move(clause.children.back()));
+    kept.push_back(std::move(taken));
+    break;
+  }
+
+  // The first remaining conditional clause leads the chain.
+  if (!kept.empty() && kept.front().TypeIs(eAst::kKwElif)) kept.front().type = eAst::kKwIf;
+  if (!kept.empty() && kept.front().TypeIs(eAst::kKwCxelif)) kept.front().type = eAst::kKwCxif;
+  stmt.children = std::move(kept);
+}
+
+// Value of an integer or boolean literal. Other nodes, and literals which do not convert, have none.
+inline Opt<AV> AstFolder::LiteralValue(const Ast& node) const {
+  if (node.src_begin == node.src_end) return std::nullopt;
+  if (node.TypeIs(eAst::kLitInt)) {
+    auto value = I32::FromLiteral(node.RawLiteral());
+    if (value) return AV::Make<I32>(value->data);
+  } else if (node.TypeIs(eAst::kLitBool)) {
+    auto value = Bool::FromLiteral(node.RawLiteral());
+    if (value) return AV::Make<Bool>(value->data);
+  }
+  return std::nullopt;
+}
+
+// Literal node holding 'value', located where 'replaced' was. Results other than integers and booleans, including
+// errors, are not folded.
+inline Opt<Ast> AstFolder::MakeLiteral(const AV& value, const Ast& replaced) {
+  if (replaced.src_begin == replaced.src_end) return std::nullopt;
+  eAst type{};
+  eTk tk_type{};
+  if (AV::Is<I32>(value)) {
+    type = eAst::kLitInt;
+    tk_type = eTk::kLitInt;
+    literal_text_.push_back(std::to_string(AV::CppRef<I32>(value).data));
+  } else if (AV::Is<Bool>(value)) {
+    type = eAst::kLitBool;
+    tk_type = eTk::kLitBool;
+    literal_text_.push_back(AV::CppRef<Bool>(value).data ? "true" : "false");
+  } else
+    return std::nullopt;
+
+  const Tk& first = *replaced.src_begin;
+  const Tk& last = *std::prev(replaced.src_end);
+  Tk& tk = literal_tokens_.emplace_back(tk_type, literal_text_.back(), first.beg_line_, first.beg_col_,
+                                        last.end_line_, last.end_col_);
+  tk.file_ = first.file_;
+
+  Ast lit{type};
+  lit.parent = replaced.parent;
+  std::span<const Tk> src{&tk, 1};
+  lit.src_begin = src.cbegin();
+  lit.src_end = src.cend();
+  return lit;
+}
+
+}  // namespace cnd::hir
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
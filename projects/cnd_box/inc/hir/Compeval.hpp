@@ -5,11 +5,14 @@
 #include "compiler/TranslationInput.hpp"
 #include "compiler/TranslationOutput.hpp"
 #include "compiler_utils/CompilerProcessResult.hpp"
+#include "compiler_utils/SourceManager.hpp"
 #include "frontend/Ast.hpp"
 #include "frontend/Lexer.hpp"
 #include "frontend/Parser.hpp"
 #include "hir/AnyValue.hpp"
+#include "hir/AstFold.hpp"
 #include "hir/HirOp.hpp"
+#include "hir/HirLower.hpp"
 
 namespace cnd {
 
@@ -30,15 +33,27 @@ struct PrimaryExpr;
 struct FunctionParameter;
 struct FunctionDefinition;
 
+/// Location of a variable relative to the namespace it was resolved from: 'depth' parents up, at index 'slot'.
+struct VarSlot {
+  UI32 depth;
+  UI32 slot;
+};
+
 struct Namespace {
   Namespace* parent{nullptr};
   StrView ident{};
-  std::unordered_map<StrView, Namespace> subspaces;
-  std::unordered_map<StrView, AV> vars;
-  std::unordered_map<StrView, FunctionDefinition> funcs;
-  ClRes<std::reference_wrapper<AV>> ResolveVariable(StrView ident);
-  ClRes<std::reference_wrapper<const FunctionDefinition>> ResolveFunction(StrView ident);
-  bool ContainsLocalVariable(StrView ident) const { return vars.contains(ident); }
+  std::unordered_map<SymbolId, Namespace> subspaces;
+  std::deque<AV> vars;  // Variable storage, indexed by slot. A deque so bound globals stay valid as it grows.
+  FlatMap<SymbolId, UI32> var_slots;
+  FlatMap<SymbolId, FunctionDefinition> funcs;
+
+  // Name lookups happen once, when a name is declared or resolved. Accesses through a VarSlot are array indexing.
+  UI32 DeclareVariable(SymbolId ident);
+  ClRes<VarSlot> ResolveVariableSlot(SymbolId ident) const;
+  AV& At(VarSlot loc) noexcept;
+  ClRes<std::reference_wrapper<AV>> ResolveVariable(SymbolId ident);
+  ClRes<std::reference_wrapper<const FunctionDefinition>> ResolveFunction(SymbolId ident);
+  bool ContainsLocalVariable(SymbolId ident) const { return var_slots.contains(ident); }
 };
 
 struct FunctionArgument {
@@ -47,7 +62,7 @@ struct FunctionArgument {
 };
 
 struct FunctionParameter {
-  StrView name;
+  SymbolId name;
   eTypeIndex type;
   eValCat valcat;
 };
@@ -55,9 +70,9 @@ struct FunctionParameter {
 struct FunctionDefinition {
   StrView name;
   std::vector<FunctionParameter> params;
-  std::map<StrView, std::size_t> lookup_params;
+  FlatMap<SymbolId, std::size_t> lookup_params;
   eTypeIndex return_type;
-  std::vector<HirOp> impl;
+  HirProgram::FnId impl;  // Bytecode of the body in the translation unit's program.
 };
 
 struct FunctionCall {
@@ -72,48 +87,34 @@ struct TrUnit {
   static constexpr inline StrView kGlobalNamespaceName = "__global__";
   bool is_terminated{false};  // Has the compile time evaluation been terminated
   int exit_code{};            // Exit code returned by the compile time evaluation.
-  std::unordered_map<Str, Vec<char>> sources{};
-  std::unordered_map<StrView, Vec<Tk>> tokens{};
+  trtools::SourceManager sources{};
   std::unordered_map<StrView, Vec<Tk>> sanitized_tokens{};
   std::unordered_map<StrView, Span<const Tk>> span_tokens{};
+  AstFolder folder{};  // Owns the literals of folded trees, so it is declared before them.
   std::unordered_map<StrView, Ast> trees{};
+  RefArena values{};  // Heap values of the evaluation. Declared before their users, so it is destroyed last.
   Namespace global{.parent = nullptr, .ident = kGlobalNamespaceName};
+  HirProgram program{};  // Bytecode of every function defined in the translation unit.
+  Context vm{};
 
   ClRes<std::unordered_map<StrView, Ast>::iterator> ParseSourceFile(StrView fp) noexcept;
-  ClRes<std::unordered_map<Str, Vec<char>>::iterator> ReadSourceFile(StrView fp) noexcept;
+  ClRes<trtools::SourceManager::FileId> ReadSourceFile(StrView fp) noexcept;
 
   ClRes<void> Evaluate();
   ClRes<bool> EvalSourceFile(StrView fp) noexcept;
+  ClRes<void> DeclarePragmaticFunction(const Ast& ast, Namespace& ns) noexcept;
+  ClRes<void> DeclarePragmaticVariable(const Ast& ast, Namespace& ns) noexcept;
   ClRes<void> EvalPragmaticReturnStmt(const Ast& ast, Namespace& ns) noexcept;
   ClRes<void> EvalPragmaticVariableDefinition(const Ast& ast, Namespace& ns) noexcept;
   ClRes<void> EvalPragmaticFunctionDefinition(const Ast& ast, Namespace& ns) noexcept;
+  ClRes<AV> EvalExpr(const Ast& ast, Namespace& ns) noexcept;
   ClRes<AV> EvalPrimaryExpr(const Ast& ast, Namespace& ns) noexcept;
-  ClRes<AV> EvaluateFunctionCall(const FunctionCall& call, Namespace& caller_ns) noexcept;
   ClRes<AV> ComputeBinop(const Ast& lhs, const Ast& rhs, Namespace& ns, AV (*binop)(const AV&, const AV&));
 };
 
-// Loads source file at given path and stores in 'sources' at file path key. Currently only used  internally by
-// 'LoadSourceFile' method.
-ClRes<std::unordered_map<Str, Vec<char>>::iterator> TrUnit::ReadSourceFile(StrView fp) noexcept {
-  if (!stdfs::exists(fp)) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Does not exist"));
-
-  if (!stdfs::is_regular_file(fp)) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Not a regular file."));
-
-  std::ifstream source_file_stream(fp.data());
-  if (!source_file_stream.is_open()) return ClFail(MakeClMsg<eClErr::kFailedToReadFile>(fp, "Could not open file."));
-
-  std::vector<char> temp_file_buffer =
-      std::vector<char>((std::istreambuf_iterator<char>(source_file_stream)), std::istreambuf_iterator<char>());
-  source_file_stream.close();
-
-  // Add \0 if not already at end.
-  if (temp_file_buffer.back() != '\0') temp_file_buffer.push_back('\0');
-  
-  auto new_key = std::string{fp.begin(), fp.end()};
-  sources[new_key] = temp_file_buffer;
-
-  return sources.find(new_key);
-}
+// Loads source file at given path into 'sources'. The source bytes are stored once and the returned id is stamped
+// into the file's tokens.
+ClRes<trtools::SourceManager::FileId> TrUnit::ReadSourceFile(StrView fp) noexcept { return sources.Load(fp); }
 
 // Loads, lexes, sanitizes and parses a C& source file. Stores result of operations into associated maps at file path
 // key. Assert a file has not been already loaded for this compiler instance before calling this method on a given
@@ -122,17 +123,15 @@ ClRes<std::unordered_map<StrView, Ast>::iterator> TrUnit::ParseSourceFile(StrVie
   // Load file data.
   auto src_read = ReadSourceFile(fp);
   if (!src_read) return ClFail(src_read.error());
-  StrView src_key = src_read.value()->first;
-  const auto & src_data = src_read.value()->second;
+  const auto file_id = src_read.value();
+  StrView src_key = sources.PathOf(file_id);
+  StrView src_view = sources.Text(file_id);
 
-  // Lex and store tokens.
-  StrView src_view = {src_data.cbegin(), src_data.cend()};
-  auto lex_res = trtools::Lexer::Lex(src_view);
+  // Lex and sanitize in a single pass, trivia is never stored.
+  auto lex_res = trtools::Lexer::LexSanitized(src_view, file_id);
   if (!lex_res) return ClFail(lex_res.error());
-  tokens[src_key] = lex_res.value();
+  sanitized_tokens[src_key] = std::move(lex_res.value());
 
-  // Sanitize and store sanitized tokens.
-  sanitized_tokens[src_key] = trtools::Lexer::Sanitize(tokens[src_key]);
   span_tokens[src_key] = Span{sanitized_tokens[src_key].data(), sanitized_tokens[src_key].size()};
 
   // Parse and store abstract syntax tree.
@@ -160,6 +159,8 @@ ClRes<void> TrUnit::Evaluate() {
 // Evaluates a source file as a fragment of the translation unit. Returns true if further source files should be
 // evaluated.
 ClRes<bool> TrUnit::EvalSourceFile(StrView src_key) noexcept {
+  RefArenaScope arena_scope{values};
+  folder.Fold(trees[src_key]);  // In place, so later passes over the tree see the folded form too.
   const Ast& ast = trees[src_key];
 
   if (ast.TypeIsnt(eAst::kProgram)) {
@@ -167,6 +168,26 @@ ClRes<bool> TrUnit::EvalSourceFile(StrView src_key) noexcept {
         MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(), "Root ast must be a program."));
   }
 
+  // Declare every function and variable first, so a function body may refer to names defined after it.
+  for (const auto& stmt : ast.children) {
+    if (stmt.TypeIs(eAst::kMethodDeclaration) && stmt.children.size() > 3) {
+      auto decl_res = DeclarePragmaticFunction(stmt, global);
+      if (!decl_res) return ClFail(decl_res.Error());
+    } else if (stmt.TypeIs(eAst::kVariableDeclaration)) {
+      auto decl_res = DeclarePragmaticVariable(stmt, global);
+      if (!decl_res) return ClFail(decl_res.Error());
+    }
+  }
+
+  // Lower function bodies to bytecode once every name they may call is known.
+  for (const auto& stmt : ast.children) {
+    if (stmt.TypeIs(eAst::kMethodDeclaration) && stmt.children.size() > 3) {
+      auto def_res = EvalPragmaticFunctionDefinition(stmt, global);
+      if (!def_res) return ClFail(def_res.Error());
+    }
+  }
+  program.ResolvePurity();  // Calls to pure functions are memoized by the virtual machine.
+
   for (const auto& stmt : ast.children) {
     if (stmt.TypeIs(eAst::kKwReturn)) {
       auto eval_res = EvalPragmaticReturnStmt(stmt, global);
@@ -181,9 +202,62 @@ ClRes<bool> TrUnit::EvalSourceFile(StrView src_key) noexcept {
   return true;
 }
 
+ClRes<void> TrUnit::DeclarePragmaticFunction(const Ast& ast, Namespace& ns) noexcept {
+  assert(ast.TypeIs(eAst::kMethodDeclaration) && __FUNCTION__ ": Expected eAst::kMethodDeclaration ast type.");
+  const SymbolId ident = ast.At(1).Symbol();
+  if (ns.funcs.contains(ident) || program.FindFunction(ident))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Function '{}' already exists in namespace '{}'.", Symbols().Name(ident), ns.ident)));
+
+  Vec<SymbolId> param_names = GetMethodParameterNames(ast);
+  FunctionDefinition def{.name = Symbols().Name(ident),
+                         .return_type = eTypeIndex::Undefined,
+                         .impl = program.DeclareFunction(ident, static_cast<UI32>(param_names.size()))};
+  for (SymbolId param_name : param_names) {
+    def.lookup_params[param_name] = def.params.size();
+    def.params.push_back(FunctionParameter{.name = param_name, .type = eTypeIndex::Undefined, .valcat = eValCat::Value});
+  }
+  ns.funcs[ident] = std::move(def);
+  return ClRes<void>{};
+}
+
+// Reserves the variable's storage, undefined until its definition is evaluated, and binds it as a program global.
+ClRes<void> TrUnit::DeclarePragmaticVariable(const Ast& ast, Namespace& ns) noexcept {
+  assert(ast.TypeIs(eAst::kVariableDeclaration) && __FUNCTION__ ": Expected eAst::kVariableDeclaration ast type.");
+  const SymbolId ident = ast.At(2).Symbol();
+  if (ns.ContainsLocalVariable(ident))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Variable '{}' already exists in namespace '{}'.", Symbols().Name(ident), ns.ident)));
+  program.BindGlobal(ident, ns.vars[ns.DeclareVariable(ident)]);
+  return ClRes<void>{};
+}
+
+ClRes<void> TrUnit::EvalPragmaticFunctionDefinition(const Ast& ast, Namespace& ns) noexcept {
+  assert(ast.TypeIs(eAst::kMethodDeclaration) && __FUNCTION__ ": Expected eAst::kMethodDeclaration ast type.");
+  auto resolution_res = ns.ResolveFunction(ast.At(1).Symbol());
+  if (!resolution_res) return ClFail(resolution_res.Error());
+  HirLowering lowering{program, program.functions[resolution_res->get().impl]};
+  return lowering.LowerFunction(ast);
+}
+
+// Evaluates an expression by lowering it to a single use chunk and running it on the virtual machine.
+ClRes<AV> TrUnit::EvalExpr(const Ast& ast, Namespace& ns) noexcept {
+  RefArenaScope arena_scope{values};
+  HirChunk thunk{.name = ns.ident};
+  HirLowering lowering{program, thunk};
+  auto lower_res = lowering.LowerExpression(ast);
+  if (!lower_res) return ClFail(lower_res.Error());
+  return vm.Run(program, thunk);
+}
+
 ClRes<void> TrUnit::EvalPragmaticReturnStmt(const Ast& ast, Namespace& ns) noexcept {
   assert(ast.TypeIs(eAst::kKwReturn) && __FUNCTION__ ": Expected eAst::kKwReturn ast type.");
-  auto eval_res = EvalPrimaryExpr(ast.At(0), ns);
+  if (ast.children.empty())
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), "A pragmatic return statement must return an int."));
+  auto eval_res = EvalExpr(ast.At(0), ns);
   if (!eval_res) return ClFail(eval_res.Error());
 
   if (!AV::Is<I32>(*eval_res))
@@ -191,25 +265,28 @@ ClRes<void> TrUnit::EvalPragmaticReturnStmt(const Ast& ast, Namespace& ns) noexc
         std::source_location::current(), "Return type of a pragmatic return statement must be an int."));
   exit_code = 0;
   output_.return_value = AV::CppRef<I32>(*eval_res).data;
+  return ClRes<void>{};
 };
 
 ClRes<void> TrUnit::EvalPragmaticVariableDefinition(const Ast& ast, Namespace& ns) noexcept {
   assert(ast.TypeIs(eAst::kVariableDeclaration) && __FUNCTION__ ": Expected eAst::kVariableDeclaration ast type.");
   // TODO: mods
 
-  // Get the variable identifier. Assert it's unique in the namespace.
-  StrView ident = ast.At(ast.children.size() - 2).RawLiteral();
-  if (ns.ContainsLocalVariable(ident))
-    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
-        std::source_location::current(),
-        std::format("Variable '{}' already exists in namespace '{}'.", ident, ns.ident)));
+  // Get the variable's slot. Uniqueness was checked when the source file's variables were declared.
+  auto slot_res = ns.ResolveVariableSlot(ast.At(2).Symbol());
+  if (!slot_res) return ClFail(slot_res.Error());
+  AV& var = ns.At(*slot_res);
+  if (ast.children.size() < 4) {
+    var = AV::Make<None>();
+    return ClRes<void>{};
+  }
 
   // Evaluate the initalizer.
-  auto initializer_res = EvalPrimaryExpr(ast.At(ast.children.size() - 1).At(0), ns);
+  auto initializer_res = EvalExpr(ast.At(3).At(0), ns);
   if (!initializer_res) return ClFail(initializer_res.Error());
 
-  // Add to var map in this namespace.
-  ns.vars[ident] = *initializer_res;
+  // Store into the variable's slot, which the program's globals are bound to.
+  var = *initializer_res;
 
   return ClRes<void>{};
 }
@@ -302,8 +379,10 @@ ClRes<AV> TrUnit::EvalPrimaryExpr(const Ast& ast, Namespace& ns) noexcept {
       return DEBUG_FAIL("Inline binary operations not implemented.");
     // Other
     case eAst::kIdent: {
-      auto resolution_res = ns.ResolveVariable(ast.src_begin->Literal());
+      auto resolution_res = ns.ResolveVariable(ast.Symbol());
       if (!resolution_res) return ClFail(resolution_res.error());
+      // Scalars cannot be referenced, the expression reads a copy of their value.
+      if (AV::IsInline(resolution_res->get())) return AV::Copy(resolution_res->get());
       return AV::WeakRef(resolution_res->get());
     }
     case eAst::kSubexpression:
@@ -313,33 +392,40 @@ ClRes<AV> TrUnit::EvalPrimaryExpr(const Ast& ast, Namespace& ns) noexcept {
   return DEBUG_FAIL("Cannot evaluate primary expression.");
 }
 
-ClRes<std::reference_wrapper<AV>> Namespace::ResolveVariable(StrView ident) {
-  if (vars.contains(ident))
-    return vars[ident];
-  else if (parent != nullptr)
-    return parent->ResolveVariable(ident);
-  else
-    return DEBUG_FAIL("Cannot resolve variable value.");
+// Reserves an undefined slot for a new variable of this namespace. Returns the existing slot if already declared.
+UI32 Namespace::DeclareVariable(SymbolId ident) {
+  auto [it, inserted] = var_slots.try_emplace(ident, static_cast<UI32>(vars.size()));
+  if (inserted) vars.emplace_back();
+  return it->second;
 }
 
-ClRes<std::reference_wrapper<const FunctionDefinition>> Namespace::ResolveFunction(StrView ident) {
-  if (funcs.contains(ident))
-    return funcs[ident];
-  else if (parent != nullptr)
-    return parent->ResolveFunction(ident);
-  else
-    return DEBUG_FAIL(std::format("Cannot resolve function {}.", ident));
+ClRes<VarSlot> Namespace::ResolveVariableSlot(SymbolId ident) const {
+  UI32 depth = 0;
+  for (const Namespace* ns = this; ns != nullptr; ns = ns->parent, depth++) {
+    auto found = ns->var_slots.find(ident);
+    if (found != ns->var_slots.end()) return VarSlot{.depth = depth, .slot = found->second};
+  }
+  return DEBUG_FAIL("Cannot resolve variable value.");
 }
 
-ClRes<AV> EvaluateFunctionCall(StrView name, std::vector<FunctionArgument> args, Namespace& ns) noexcept {
-  auto resolution_res = ns.ResolveFunction(name);
-  if (!resolution_res) return ClFail(resolution_res.Error());
-  const FunctionDefinition& def = resolution_res->get();
-  if (def.params.size() != args.size())
-    return DEBUG_FAIL(std::format("Function '{}' expects {} arguments but {} were provided.", def.name,
-                                  def.params.size(), args.size()));
+AV& Namespace::At(VarSlot loc) noexcept {
+  Namespace* ns = this;
+  for (UI32 i = 0; i < loc.depth; i++) ns = ns->parent;
+  return ns->vars[loc.slot];
+}
 
+ClRes<std::reference_wrapper<AV>> Namespace::ResolveVariable(SymbolId ident) {
+  auto slot_res = ResolveVariableSlot(ident);
+  if (!slot_res) return ClFail(slot_res.Error());
+  return At(*slot_res);
+}
 
+ClRes<std::reference_wrapper<const FunctionDefinition>> Namespace::ResolveFunction(SymbolId ident) {
+  for (Namespace* ns = this; ns != nullptr; ns = ns->parent) {
+    auto found = ns->funcs.find(ident);
+    if (found != ns->funcs.end()) return found->second;
+  }
+  return DEBUG_FAIL(std::format("Cannot resolve function {}.", Symbols().Name(ident)));
 }
 // using cxx::Expected;
 //
@@ -0,0 +1,653 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Lowers function bodies and expressions from the Ast into register bytecode.
+///
+/// Locals live in registers for the duration of their block. Temporaries are allocated above the last live local and
+/// released at the end of the statement which created them, so the register window of a frame stays small. Names
+/// resolve to a local first, then to a global of the program.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "frontend/Ast.hpp"
+#include "hir/AnyValue.hpp"
+#include "hir/HirOp.hpp"
+// clang-format on
+
+namespace cnd::hir {
+
+/// @brief Names of the parameters of a kMethodDeclaration, in order. A void parameter list has no names.
+inline Vec<SymbolId> GetMethodParameterNames(const Ast& method_decl) {
+  Vec<SymbolId> names{};
+  const Ast& signature = method_decl.At(2);
+  if (signature.children.empty()) return names;
+  for (const Ast& param : signature.At(0).children) {
+    if (param.children.empty() || param.children.back().TypeIs(eAst::kMethodVoid)) continue;
+    names.push_back(param.children.back().Symbol());
+  }
+  return names;
+}
+
+/// @brief Bytecode op of a binary operator ast, including the operator of a compound assignment.
+constexpr Opt<eHirOp> GetHirBinaryOp(eAst type) noexcept {
+  switch (type) {
+    case eAst::kAdd:
+    case eAst::kAddAssign:
+      return eHirOp::kAdd;
+    case eAst::kSub:
+    case eAst::kSubAssign:
+      return eHirOp::kSub;
+    case eAst::kMul:
+    case eAst::kMulAssign:
+      return eHirOp::kMul;
+    case eAst::kDiv:
+    case eAst::kDivAssign:
+      return eHirOp::kDiv;
+    case eAst::kMod:
+    case eAst::kModAssign:
+      return eHirOp::kMod;
+    case eAst::kAnd:
+    case eAst::kAndAssign:
+      return eHirOp::kAnd;
+    case eAst::kOr:
+    case eAst::kOrAssign:
+      return eHirOp::kOr;
+    case eAst::kXor:
+    case eAst::kXorAssign:
+      return eHirOp::kXor;
+    case eAst::kLsh:
+    case eAst::kLshAssign:
+      return eHirOp::kLsh;
+    case eAst::kRsh:
+    case eAst::kRshAssign:
+      return eHirOp::kRsh;
+    case eAst::kEq:
+      return eHirOp::kEq;
+    case eAst::kNeq:
+      return eHirOp::kNeq;
+    case eAst::kLt:
+      return eHirOp::kLt;
+    case eAst::kGt:
+      return eHirOp::kGt;
+    case eAst::kLte:
+      return eHirOp::kLte;
+    case eAst::kGte:
+      return eHirOp::kGte;
+    default:
+      return std::nullopt;
+  }
+}
+
+/// @brief Type of value a variable's type constraint admits, Undefined if it admits any. Empty if the constraint is not
+/// a type the compile time evaluator can check.
+constexpr Opt<eTypeIndex> GetHirConstraintType(eAst constraint) noexcept {
+  switch (constraint) {
+    case eAst::kKwAny:
+    case eAst::kKwAuto:
+      return eTypeIndex::Undefined;
+    case eAst::kKwInt:
+      return eTypeIndex::I32;
+    case eAst::kKwBool:
+      return eTypeIndex::Bool;
+    case eAst::kKwChar:
+      return eTypeIndex::I8;
+    default:
+      return std::nullopt;
+  }
+}
+
+/// @brief Value of a variable of a constrained type declared without a definition.
+inline AV GetHirDefaultValue(eTypeIndex type) noexcept {
+  switch (type) {
+    case eTypeIndex::I32:
+      return AV::Make<I32>(I32::DataT{});
+    case eTypeIndex::Bool:
+      return AV::Make<Bool>(Bool::DataT{});
+    case eTypeIndex::I8:
+      return AV::Make<I8>(I8::DataT{});
+    default:
+      return AV::Make<None>();
+  }
+}
+
+constexpr bool IsAstCompoundAssignment(eAst type) noexcept {
+  switch (type) {
+    case eAst::kAddAssign:
+    case eAst::kSubAssign:
+    case eAst::kMulAssign:
+    case eAst::kDivAssign:
+    case eAst::kModAssign:
+    case eAst::kAndAssign:
+    case eAst::kOrAssign:
+    case eAst::kXorAssign:
+    case eAst::kLshAssign:
+    case eAst::kRshAssign:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// @brief Lowers into a single chunk. Functions the chunk calls must already be declared in the program.
+struct HirLowering {
+  HirProgram& program;
+  HirChunk& chunk;
+
+  HirLowering(HirProgram& program, HirChunk& chunk) : program(program), chunk(chunk) {}
+
+  /// @brief Lower a kMethodDeclaration with a definition. Parameters occupy the first registers.
+  ClRes<void> LowerFunction(const Ast& method_decl);
+
+  /// @brief Lower an expression into a chunk returning its value.
+  ClRes<void> LowerExpression(const Ast& expr);
+
+ private:
+  struct Local {
+    SymbolId name;
+    UI32 reg;
+    bool is_const{false};
+    eTypeIndex type{eTypeIndex::Undefined};  // Checked after every write, unless Undefined.
+  };
+
+  Vec<Local> locals_{};
+  Vec<Size> scopes_{};  // Count of locals when each open block began.
+  UI32 top_{0};         // First free register.
+
+  UI32 AllocReg();
+  UI32 Out(Opt<UI32> dst) { return dst ? *dst : AllocReg(); }
+  void OpenScope() { scopes_.push_back(locals_.size()); }
+  void CloseScope();
+  ClRes<void> CheckRegisterCount() const;
+  const Local* FindLocal(SymbolId name) const;
+  ClRes<void> CheckLocalUnique(SymbolId name) const;
+  ClRes<UI32> DeclareLocal(SymbolId name);
+
+  ClRes<void> LowerBlock(const Ast& block);
+  ClRes<void> LowerStmt(const Ast& stmt);
+  ClRes<void> LowerVariableDecl(const Ast& decl);
+  ClRes<void> LowerIf(const Ast& stmt);
+  ClRes<void> LowerWhile(const Ast& stmt);
+  ClRes<void> LowerFor(const Ast& stmt);
+  ClRes<UI32> LowerExpr(const Ast& expr, Opt<UI32> dst = std::nullopt);
+  ClRes<UI32> LowerIdent(const Ast& ident, Opt<UI32> dst);
+  ClRes<UI32> LowerAssign(const Ast& expr, Opt<UI32> dst);
+  ClRes<UI32> LowerIncDec(const Ast& expr, Opt<UI32> dst, bool is_value_used);
+  ClRes<UI32> LowerCall(const Ast& expr, Opt<UI32> dst);
+
+  template <class T>
+  ClRes<UI32> LowerLiteral(const Ast& lit, Opt<UI32> dst);
+};
+
+inline UI32 HirLowering::AllocReg() {
+  const UI32 reg = top_++;
+  chunk.register_count = std::max(chunk.register_count, top_);
+  return reg;
+}
+
+// Register operands are 16 bits wide. Ops emitted past the limit are truncated, so the chunk must be rejected.
+inline ClRes<void> HirLowering::CheckRegisterCount() const {
+  if (chunk.register_count > HirOp::kMaxRegister)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("'{}' needs more than {} registers.", chunk.name, HirOp::kMaxRegister)));
+  return ClRes<void>{};
+}
+
+inline void HirLowering::CloseScope() {
+  locals_.resize(scopes_.back());
+  scopes_.pop_back();
+  top_ = locals_.empty() ? 0 : locals_.back().reg + 1;
+}
+
+inline const HirLowering::Local* HirLowering::FindLocal(SymbolId name) const {
+  for (auto it = locals_.rbegin(); it != locals_.rend(); it++)
+    if (it->name == name) return &*it;
+  return nullptr;
+}
+
+inline ClRes<void> HirLowering::CheckLocalUnique(SymbolId name) const {
+  const Size scope_begin = scopes_.empty() ? 0 : scopes_.back();
+  for (Size i = scope_begin; i < locals_.size(); i++)
+    if (locals_[i].name == name)
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(), std::format("Variable '{}' already exists in this scope.", Symbols().Name(name))));
+  return ClRes<void>{};
+}
+
+inline ClRes<UI32> HirLowering::DeclareLocal(SymbolId name) {
+  auto unique = CheckLocalUnique(name);
+  if (!unique) return ClFail(unique.Error());
+  const UI32 reg = AllocReg();
+  locals_.push_back(Local{name, reg});
+  return reg;
+}
+
+inline ClRes<void> HirLowering::LowerFunction(const Ast& method_decl) {
+  if (method_decl.children.size() < 4)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            "Function declaration has no definition to lower."));
+  OpenScope();
+  for (SymbolId name : GetMethodParameterNames(method_decl)) {
+    auto param_res = DeclareLocal(name);
+    if (!param_res) return ClFail(param_res.Error());
+  }
+  if (top_ != chunk.param_count)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), "Parameter count does not match the declared function."));
+
+  auto body_res = LowerBlock(method_decl.At(3));
+  if (!body_res) return ClFail(body_res.Error());
+  CloseScope();
+
+  // Falling off the end of a function returns none.
+  chunk.Emit(eHirOp::kReturnNone);
+  return CheckRegisterCount();
+}
+
+inline ClRes<void> HirLowering::LowerExpression(const Ast& expr) {
+  auto value = LowerExpr(expr);
+  if (!value) return ClFail(value.Error());
+  chunk.Emit(eHirOp::kReturn, *value);
+  return CheckRegisterCount();
+}
+
+inline ClRes<void> HirLowering::LowerBlock(const Ast& block) {
+  OpenScope();
+  for (const Ast& stmt : block.children) {
+    auto stmt_res = LowerStmt(stmt);
+    if (!stmt_res) return stmt_res;
+  }
+  CloseScope();
+  return ClRes<void>{};
+}
+
+inline ClRes<void> HirLowering::LowerStmt(const Ast& stmt) {
+  const UI32 mark = top_;
+  switch (stmt.type) {
+    case eAst::kVariableDeclaration:
+      return LowerVariableDecl(stmt);
+    case eAst::kKwReturn: {
+      if (stmt.children.empty()) {
+        chunk.Emit(eHirOp::kReturnNone);
+        return ClRes<void>{};
+      }
+      auto value = LowerExpr(stmt.At(0));
+      if (!value) return ClFail(value.Error());
+      chunk.Emit(eHirOp::kReturn, *value);
+      break;
+    }
+    case eAst::kIfStatement:
+      return LowerIf(stmt);
+    case eAst::kKwWhile:
+      return LowerWhile(stmt);
+    case eAst::kKwFor:
+      return LowerFor(stmt);
+    case eAst::kMethodDeclaration:
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(), "Nested function definitions cannot be evaluated at compile time."));
+    case eAst::kInc:
+    case eAst::kDec: {
+      auto value = LowerIncDec(stmt, std::nullopt, false);
+      if (!value) return ClFail(value.Error());
+      break;
+    }
+    default: {
+      auto value = LowerExpr(stmt);
+      if (!value) return ClFail(value.Error());
+      break;
+    }
+  }
+  top_ = mark;
+  return ClRes<void>{};
+}
+
+// Children are [<modifiers>, <type-constraint>, <identifier>, <variable-definition>?]. Of the modifiers only 'const'
+// has a meaning for a local.
+inline ClRes<void> HirLowering::LowerVariableDecl(const Ast& decl) {
+  const Ast& ident = decl.At(2);
+  Local local{.name = ident.Symbol()};
+  for (const Ast& mod : decl.At(0).children) {
+    if (mod.TypeIsnt(eAst::kKwConst))
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(), std::format("Modifier '{}' cannot be applied to local variable '{}'.",
+                                                       mod.RawLiteral(), ident.RawLiteral())));
+    local.is_const = true;
+  }
+  const Opt<eTypeIndex> type = GetHirConstraintType(decl.At(1).type);
+  if (!type)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Type constraint of variable '{}' cannot be checked at compile time.", ident.RawLiteral())));
+  local.type = *type;
+  if (local.is_const && decl.children.size() < 4)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Const variable '{}' must be defined.", ident.RawLiteral())));
+
+  // The register is taken before the initializer is lowered, but the name is only visible after it.
+  auto unique = CheckLocalUnique(local.name);
+  if (!unique) return unique;
+  local.reg = AllocReg();
+  if (decl.children.size() > 3) {
+    auto init = LowerExpr(decl.At(3).At(0), local.reg);
+    if (!init) return ClFail(init.Error());
+    if (local.type != eTypeIndex::Undefined)
+      chunk.EmitBx(eHirOp::kCheckType, local.reg, static_cast<UI32>(local.type));
+  } else {
+    chunk.EmitBx(eHirOp::kLoadConst, local.reg, chunk.AddConstant(GetHirDefaultValue(local.type)));
+  }
+  top_ = local.reg + 1;
+  locals_.push_back(local);
+  return ClRes<void>{};
+}
+
+inline ClRes<void> HirLowering::LowerIf(const Ast& stmt) {
+  Vec<UI32> exits{};
+  for (Size i = 0; i < stmt.children.size(); i++) {
+    const Ast& clause = stmt.At(i);
+    const bool is_last = i + 1 == stmt.children.size();
+    if (clause.TypeIs(eAst::kKwElse) || clause.TypeIs(eAst::kKwCxelse)) {
+      auto body = LowerBlock(clause.At(0));
+      if (!body) return body;
+      continue;
+    }
+
+    const UI32 mark = top_;
+    auto cond = LowerExpr(clause.At(0));
+    if (!cond) return ClFail(cond.Error());
+    top_ = mark;
+    const UI32 skip = chunk.EmitBx(eHirOp::kJumpIfFalse, *cond, 0);
+    auto body = LowerBlock(clause.At(1));
+    if (!body) return body;
+    if (!is_last) exits.push_back(chunk.Emit(eHirOp::kJump));
+    chunk.Patch(skip, chunk.Label());
+  }
+  for (UI32 exit : exits) chunk.Patch(exit, chunk.Label());
+  return ClRes<void>{};
+}
+
+// Loops test their condition at the bottom, so each iteration takes a single branch.
+inline ClRes<void> HirLowering::LowerWhile(const Ast& stmt) {
+  const UI32 enter = chunk.Emit(eHirOp::kJump);
+  const UI32 body_label = chunk.Label();
+  auto body = LowerBlock(stmt.At(1));
+  if (!body) return body;
+
+  chunk.Patch(enter, chunk.Label());
+  const UI32 mark = top_;
+  auto cond = LowerExpr(stmt.At(0));
+  if (!cond) return ClFail(cond.Error());
+  top_ = mark;
+  chunk.EmitBx(eHirOp::kJumpIfTrue, *cond, body_label);
+  return ClRes<void>{};
+}
+
+// Children are [<variable-decl>?, <condition>, <increment>?, <body>].
+inline ClRes<void> HirLowering::LowerFor(const Ast& stmt) {
+  OpenScope();
+  Size next = 0;
+  if (stmt.At(0).TypeIs(eAst::kVariableDeclaration)) {
+    auto init = LowerVariableDecl(stmt.At(next++));
+    if (!init) return init;
+  }
+  const Ast& cond_ast = stmt.At(next++);
+  const Ast* inc_ast = stmt.children.size() - next == 2 ? &stmt.At(next) : nullptr;
+
+  const UI32 enter = chunk.Emit(eHirOp::kJump);
+  const UI32 body_label = chunk.Label();
+  auto body = LowerBlock(stmt.children.back());
+  if (!body) return body;
+  if (inc_ast) {
+    auto inc = LowerStmt(*inc_ast);
+    if (!inc) return inc;
+  }
+
+  chunk.Patch(enter, chunk.Label());
+  const UI32 mark = top_;
+  auto cond = LowerExpr(cond_ast);
+  if (!cond) return ClFail(cond.Error());
+  top_ = mark;
+  chunk.EmitBx(eHirOp::kJumpIfTrue, *cond, body_label);
+  CloseScope();
+  return ClRes<void>{};
+}
+
+template <class T>
+ClRes<UI32> HirLowering::LowerLiteral(const Ast& lit, Opt<UI32> dst) {
+  auto value = T::FromLiteral(lit.RawLiteral());
+  if (!value) return ClFail(value.error());
+  const UI32 out = Out(dst);
+  chunk.EmitBx(eHirOp::kLoadConst, out, chunk.AddConstant(AV::Make<T>(*value)));
+  return out;
+}
+
+inline ClRes<UI32> HirLowering::LowerExpr(const Ast& expr, Opt<UI32> dst) {
+  switch (expr.type) {
+    case eAst::kLitBool:
+      return LowerLiteral<Bool>(expr, dst);
+    case eAst::kLitChar:
+      return LowerLiteral<I8>(expr, dst);
+    case eAst::kLitInt:
+      return LowerLiteral<I32>(expr, dst);
+    case eAst::kLitCstr:
+      return LowerLiteral<CStr>(expr, dst);
+    case eAst::kIdent:
+      return LowerIdent(expr, dst);
+    case eAst::kSubexpression:
+      return LowerExpr(expr.At(0), dst);
+    case eAst::kFunctionCall:
+      return LowerCall(expr, dst);
+    case eAst::kInc:
+    case eAst::kDec:
+      return LowerIncDec(expr, dst, true);
+    case eAst::kAssign:
+      return LowerAssign(expr, dst);
+    default:
+      break;
+  }
+  if (IsAstCompoundAssignment(expr.type)) return LowerAssign(expr, dst);
+
+  // Prefix operators.
+  if (expr.children.size() == 1 && (expr.TypeIs(eAst::kNot) || expr.TypeIs(eAst::kSub) || expr.TypeIs(eAst::kAdd))) {
+    if (expr.TypeIs(eAst::kAdd)) return LowerExpr(expr.At(0), dst);
+    const UI32 mark = top_;
+    auto operand = LowerExpr(expr.At(0));
+    if (!operand) return operand;
+    top_ = mark;
+    const UI32 out = Out(dst);
+    chunk.Emit(expr.TypeIs(eAst::kNot) ? eHirOp::kNot : eHirOp::kNeg, out, *operand);
+    return out;
+  }
+
+  auto binop = GetHirBinaryOp(expr.type);
+  if (binop && expr.children.size() == 2) {
+    const UI32 mark = top_;
+    auto lhs = LowerExpr(expr.At(0));
+    if (!lhs) return lhs;
+    auto rhs = LowerExpr(expr.At(1));
+    if (!rhs) return rhs;
+    top_ = mark;
+    const UI32 out = Out(dst);
+    chunk.Emit(*binop, out, *lhs, *rhs);
+    return out;
+  }
+
+  return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+      std::source_location::current(),
+      std::format("Cannot evaluate '{}' expression at compile time.", eAstToCStr(expr.type))));
+}
+
+inline ClRes<UI32> HirLowering::LowerIdent(const Ast& ident, Opt<UI32> dst) {
+  const SymbolId name = ident.Symbol();
+  if (const Local* local = FindLocal(name)) {
+    if (!dst) return local->reg;
+    if (*dst != local->reg) chunk.Emit(eHirOp::kMove, *dst, local->reg);
+    return *dst;
+  }
+  if (auto global = program.FindGlobal(name)) {
+    const UI32 out = Out(dst);
+    chunk.EmitBx(eHirOp::kLoadGlobal, out, *global);
+    return out;
+  }
+  return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+      std::source_location::current(), std::format("Cannot resolve variable '{}'.", ident.RawLiteral())));
+}
+
+inline ClRes<UI32> HirLowering::LowerAssign(const Ast& expr, Opt<UI32> dst) {
+  const Ast& target = expr.At(0);
+  if (target.TypeIsnt(eAst::kIdent))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            "Only variables may be assigned at compile time."));
+  const SymbolId name = target.Symbol();
+  const Local* local = FindLocal(name);
+  const Opt<HirProgram::GlobalId> global = local ? std::nullopt : program.FindGlobal(name);
+  if (!local && !global)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot resolve variable '{}'.", target.RawLiteral())));
+  if (local && local->is_const)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot assign to const variable '{}'.", target.RawLiteral())));
+
+  // A local is written in place. A global is computed into a register, then stored.
+  const UI32 mark = top_;
+  const UI32 value_reg = local ? local->reg : Out(dst);
+  if (expr.TypeIs(eAst::kAssign)) {
+    auto value = LowerExpr(expr.At(1), value_reg);
+    if (!value) return value;
+  } else {
+    auto lhs = LowerIdent(target, local ? Opt<UI32>{} : Opt<UI32>{value_reg});
+    if (!lhs) return lhs;
+    auto rhs = LowerExpr(expr.At(1));
+    if (!rhs) return rhs;
+    chunk.Emit(*GetHirBinaryOp(expr.type), value_reg, *lhs, *rhs);
+  }
+  // Only a global assigned without a destination keeps its value register live.
+  top_ = global && !dst ? value_reg + 1 : mark;
+
+  if (global) {
+    chunk.EmitBx(eHirOp::kStoreGlobal, value_reg, *global);
+    return value_reg;
+  }
+  if (local->type != eTypeIndex::Undefined) chunk.EmitBx(eHirOp::kCheckType, value_reg, static_cast<UI32>(local->type));
+  if (dst && *dst != value_reg) chunk.Emit(eHirOp::kMove, *dst, value_reg);
+  return dst ? *dst : value_reg;
+}
+
+inline ClRes<UI32> HirLowering::LowerIncDec(const Ast& expr, Opt<UI32> dst, bool is_value_used) {
+  const Ast& target = expr.At(0);
+  if (target.TypeIsnt(eAst::kIdent))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            "Only variables may be incremented at compile time."));
+  // A postfix operator begins at its operand, a prefix operator begins at its own token.
+  const bool is_postfix = expr.src_begin == target.src_begin;
+  const SymbolId name = target.Symbol();
+  const Local* local = FindLocal(name);
+  const Opt<HirProgram::GlobalId> global = local ? std::nullopt : program.FindGlobal(name);
+  if (!local && !global)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot resolve variable '{}'.", target.RawLiteral())));
+  if (local && local->is_const)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot increment const variable '{}'.", target.RawLiteral())));
+
+  const UI32 mark = top_;
+  const Opt<UI32> old_reg = is_value_used && is_postfix ? Opt<UI32>{Out(dst)} : std::nullopt;
+  const UI32 value_reg = local ? local->reg : AllocReg();
+  if (global) chunk.EmitBx(eHirOp::kLoadGlobal, value_reg, *global);
+  if (old_reg) chunk.Emit(eHirOp::kMove, *old_reg, value_reg);
+  const UI32 one = AllocReg();
+  chunk.EmitBx(eHirOp::kLoadConst, one, chunk.AddConstant(AV::Make<I32>(1)));
+  chunk.Emit(expr.TypeIs(eAst::kInc) ? eHirOp::kAdd : eHirOp::kSub, value_reg, value_reg, one);
+  if (global) chunk.EmitBx(eHirOp::kStoreGlobal, value_reg, *global);
+  if (local && local->type != eTypeIndex::Undefined)
+    chunk.EmitBx(eHirOp::kCheckType, value_reg, static_cast<UI32>(local->type));
+  top_ = mark;
+
+  if (old_reg) {
+    if (!dst) top_ = *old_reg + 1;
+    return *old_reg;
+  }
+  if (!is_value_used || (local && !dst)) return value_reg;
+  const UI32 out = Out(dst);
+  if (out != value_reg) chunk.Emit(eHirOp::kMove, out, value_reg);
+  return out;
+}
+
+inline ClRes<UI32> HirLowering::LowerCall(const Ast& expr, Opt<UI32> dst) {
+  const Ast& callee = expr.At(0);
+  if (callee.TypeIsnt(eAst::kIdent))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            "Only named functions may be called at compile time."));
+  auto fn = program.FindFunction(callee.Symbol());
+  if (!fn)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot resolve function '{}'.", callee.RawLiteral())));
+
+  // Arguments are a single expression, with several arguments folded left by the comma operator.
+  Vec<const Ast*> args{};
+  if (!expr.At(1).children.empty()) {
+    const Ast* folded = &expr.At(1).At(0);
+    while (folded->TypeIs(eAst::kComma)) {
+      args.push_back(&folded->At(1));
+      folded = &folded->At(0);
+    }
+    args.push_back(folded);
+    std::reverse(args.begin(), args.end());
+  }
+  if (args.size() != program.functions[*fn].param_count)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Function '{}' expects {} arguments but {} were provided.", callee.RawLiteral(),
+                    program.functions[*fn].param_count, args.size())));
+
+  // Arguments are placed in consecutive registers at the top of the frame, which become the callee's window. The
+  // result is returned in the first of them, so at least one is reserved.
+  const UI32 mark = top_;
+  const UI32 base = top_;
+  for (Size i = 0; i < std::max<Size>(args.size(), 1); i++) AllocReg();
+  for (Size i = 0; i < args.size(); i++) {
+    auto arg = LowerExpr(*args[i], base + static_cast<UI32>(i));
+    if (!arg) return arg;
+  }
+  top_ = mark;
+  chunk.EmitBx(eHirOp::kCall, base, *fn);
+  const UI32 out = Out(dst);
+  if (out != base) chunk.Emit(eHirOp::kMove, out, base);
+  return out;
+}
+
+}  // namespace cnd::hir
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
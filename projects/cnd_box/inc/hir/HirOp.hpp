@@ -7,8 +7,16 @@
 // @website: https://www.acpp.dev
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @file
-/// @ingroup
-/// @brief
+/// @ingroup cnd_compiler
+/// @brief Register bytecode and virtual machine for compile time evaluation.
+///
+/// A HirChunk is the bytecode of one function. Each frame owns a window of registers in the context's register file,
+/// the first 'param_count' registers of a frame hold its arguments. A call passes the caller registers starting at
+/// its argument register as the callee's window, so arguments are never copied.
+///
+/// Calls to pure functions with scalar arguments are memoized by the context. A function is pure if its bytecode
+/// neither reads nor writes a global and every function it calls is pure, so its result depends on its arguments
+/// alone. Bytecode has no I/O, an op which performs any must be treated as impure by 'IsHirOpPure'.
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @addtogroup cnd_compiler
@@ -16,7 +24,10 @@
 #pragma once
 // clang-format off
 #include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "compiler_utils/SymbolTable.hpp"
 #include "hir/AnyValue.hpp"
+#include <bit>
 // clang-format on
 
 namespace cnd::hir {
@@ -27,67 +38,541 @@ enum class eContextState {
   kExit
 };
 
-enum class eHirOp : int { 
-  kAdd,   // LHS<slot> RHS<slot> OUT<slot>
-  kJump  // TO<label>
-};
+enum class eHirOp : UI8 {
+  kNop,
+  kLoadConst,    // DST<reg> CONST<bx>
+  kMove,         // DST<reg> SRC<reg>
+  kLoadGlobal,   // DST<reg> GLOBAL<bx>
+  kStoreGlobal,  // SRC<reg> GLOBAL<bx>
+  kCheckType,    // SRC<reg> TYPE<bx> : Fails unless the value's eTypeIndex is TYPE.
 
-struct HirOp;
-struct Environment;
-struct Context;
-struct Slot;
-struct Label;
+  // Binary operations. DST<reg> LHS<reg> RHS<reg>
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+  kMod,
+  kAnd,
+  kOr,
+  kXor,
+  kLsh,
+  kRsh,
+  kEq,
+  kNeq,
+  kLt,
+  kGt,
+  kLte,
+  kGte,
 
-struct Environment {
-  Environment* root{nullptr};
-  std::list<Environment> branches{};
-  std::vector<AV> data;
-  std::vector<HirOp> ops;
+  // Unary operations. DST<reg> SRC<reg>
+  kNot,
+  kNeg,
+
+  // Control flow.
+  kJump,         // - TO<bx>
+  kJumpIfFalse,  // COND<reg> TO<bx>
+  kJumpIfTrue,   // COND<reg> TO<bx>
+  kCall,         // ARGS<reg> FN<bx> : The result is written to the first argument register.
+  kReturn,       // SRC<reg>
+  kReturnNone,   //
+  COUNT
 };
 
-struct Context {
-  eContextState state{eContextState::kPause};
-  Environment root{};
-  Environment* curr_env{nullptr};
-  Environment* prev_env{nullptr};
-  std::vector<HirOp>::iterator curr_line;
-  std::vector<HirOp>::iterator prev_line;
-  
-  void ExecuteNext();
+/// @brief True if the op writes an AnyValue operation result to register 'a', which may be an Error value.
+constexpr bool IsHirOpFallible(eHirOp op) noexcept { return op >= eHirOp::kAdd && op <= eHirOp::kNeg; }
+
+/// @brief True if the op only depends on and writes to the registers of its frame. Calls are pure if the callee is.
+constexpr bool IsHirOpPure(eHirOp op) noexcept { return op != eHirOp::kLoadGlobal && op != eHirOp::kStoreGlobal; }
+
+/// @brief Fixed width 8 byte instruction. Operands are register indices relative to the frame, except the wide 'bx'
+/// operand formed by 'b' and 'c' which holds a constant, global, function or jump target index.
+struct HirOp {
+  static constexpr UI32 kMaxRegister = std::numeric_limits<UI16>::max();
+
+  eHirOp op{eHirOp::kNop};
+  UI16 a{0};
+  UI16 b{0};
+  UI16 c{0};
+
+  constexpr UI32 Bx() const noexcept { return static_cast<UI32>(b) | (static_cast<UI32>(c) << 16); }
+  constexpr void SetBx(UI32 bx) noexcept {
+    b = static_cast<UI16>(bx);
+    c = static_cast<UI16>(bx >> 16);
+  }
 };
+static_assert(sizeof(HirOp) == 8, "HirOp must stay 8 bytes wide.");
+
+/// @brief Bytecode of a single function, or of a top level expression evaluated once.
+struct HirChunk {
+  StrView name{};
+  UI32 param_count{0};
+  UI32 register_count{0};
+  bool is_pure{false};  // Set by HirProgram::ResolvePurity.
+  Vec<HirOp> code{};
+  Vec<AV> constants{};
 
-struct Slot {
-  Environment* env;
-  std::size_t index;
+  UI32 AddConstant(AV value) {
+    constants.push_back(value);
+    return static_cast<UI32>(constants.size() - 1);
+  }
 
-  std::vector<AV>::iterator Get() { return env->data.begin() + index; }
+  UI32 Emit(eHirOp op, UI32 a = 0, UI32 b = 0, UI32 c = 0) {
+    code.push_back(HirOp{op, static_cast<UI16>(a), static_cast<UI16>(b), static_cast<UI16>(c)});
+    return static_cast<UI32>(code.size() - 1);
+  }
+
+  UI32 EmitBx(eHirOp op, UI32 a, UI32 bx) {
+    HirOp& emitted = code.emplace_back(HirOp{op, static_cast<UI16>(a)});
+    emitted.SetBx(bx);
+    return static_cast<UI32>(code.size() - 1);
+  }
+
+  /// @brief Position the next emitted op will occupy. Used as a jump label.
+  UI32 Label() const noexcept { return static_cast<UI32>(code.size()); }
+
+  /// @brief Point the jump emitted at 'at' to 'label'.
+  void Patch(UI32 at, UI32 label) noexcept { code[at].SetBx(label); }
 };
 
-struct Label {
-  Environment* env;
-  std::size_t index;
-  std::vector<HirOp>::iterator Get() { return env->ops.begin() + index; }
+/// @brief Every function of a translation unit, and the global variables its bytecode refers to by index.
+struct HirProgram {
+  using FnId = UI32;
+  using GlobalId = UI32;
+
+  Vec<HirChunk> functions{};
+  FlatMap<SymbolId, FnId> function_ids{};
+  Vec<AV*> globals{};  // Bound to variable storage owned by a namespace. Not owned.
+  FlatMap<SymbolId, GlobalId> global_ids{};
+
+  Opt<FnId> FindFunction(SymbolId name) const {
+    auto found = function_ids.find(name);
+    return found == function_ids.end() ? Opt<FnId>{} : found->second;
+  }
+
+  FnId DeclareFunction(SymbolId name, UI32 param_count) {
+    functions.push_back(
+        HirChunk{.name = Symbols().Name(name), .param_count = param_count, .register_count = param_count});
+    return function_ids[name] = static_cast<FnId>(functions.size() - 1);
+  }
+
+  Opt<GlobalId> FindGlobal(SymbolId name) const {
+    auto found = global_ids.find(name);
+    return found == global_ids.end() ? Opt<GlobalId>{} : found->second;
+  }
+
+  GlobalId BindGlobal(SymbolId name, AV& storage) {
+    globals.push_back(&storage);
+    return global_ids[name] = static_cast<GlobalId>(globals.size() - 1);
+  }
+
+  /// @brief Mark the functions whose result depends on their arguments alone. Call once every function is lowered.
+  void ResolvePurity();
 };
 
-struct HirOp {
-  eHirOp op;
-  std::vector<std::variant<Slot, Label>> args;
-
-  void Execute(Context& ctx) {
-    switch (op) {
-      case eHirOp::kAdd:
-        *std::get<Slot>(args[2]).Get() = AV::Add(*std::get<Slot>(args[0]).Get(), *std::get<Slot>(args[1]).Get());
-      case eHirOp::kJump:
-        ctx.curr_line = std::get<Label>(args[0]).Get();
-        
+// Functions start out pure unless their own code is not, then any function calling an impure one is marked impure
+// until nothing changes. Starting optimistic lets recursive functions stay pure.
+inline void HirProgram::ResolvePurity() {
+  for (HirChunk& fn : functions)
+    fn.is_pure = std::ranges::all_of(fn.code, [](const HirOp& op) { return IsHirOpPure(op.op); });
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (HirChunk& fn : functions) {
+      if (!fn.is_pure) continue;
+      for (const HirOp& op : fn.code) {
+        if (op.op == eHirOp::kCall && !functions[op.Bx()].is_pure) {
+          fn.is_pure = false;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+/// @brief Callee and arguments of a memoized call. Arguments are held as their type and bit pattern.
+struct HirMemoKey {
+  HirProgram::FnId fn{0};
+  Vec<std::pair<eTypeIndex, UI64>> args{};
+
+  bool operator==(const HirMemoKey&) const = default;
+
+  /// @brief Key of a call to 'fn', or none if an argument is not an integral, boolean or floating point value.
+  static Opt<HirMemoKey> Make(HirProgram::FnId fn, std::span<const AV> args) {
+    HirMemoKey key{.fn = fn};
+    key.args.reserve(args.size());
+    for (const AV& arg : args) {
+      UI64 bits{};
+      switch (arg.TypeIndex()) {
+        case eTypeIndex::I8: bits = static_cast<UI64>(AV::CppRef<I8>(arg).data); break;
+        case eTypeIndex::I16: bits = static_cast<UI64>(AV::CppRef<I16>(arg).data); break;
+        case eTypeIndex::I32: bits = static_cast<UI64>(AV::CppRef<I32>(arg).data); break;
+        case eTypeIndex::I64: bits = static_cast<UI64>(AV::CppRef<I64>(arg).data); break;
+        case eTypeIndex::Bool: bits = AV::CppRef<Bool>(arg).data; break;
+        case eTypeIndex::U8: bits = AV::CppRef<U8>(arg).data; break;
+        case eTypeIndex::U16: bits = AV::CppRef<U16>(arg).data; break;
+        case eTypeIndex::U32: bits = AV::CppRef<U32>(arg).data; break;
+        case eTypeIndex::U64: bits = AV::CppRef<U64>(arg).data; break;
+        case eTypeIndex::F32: bits = std::bit_cast<UI32>(AV::CppRef<F32>(arg).data); break;
+        case eTypeIndex::F64: bits = std::bit_cast<UI64>(AV::CppRef<F64>(arg).data); break;
+        default: return std::nullopt;
+      }
+      key.args.emplace_back(arg.TypeIndex(), bits);
     }
+    return key;
+  }
+
+  /// @brief Approximate memory held by an entry of this key.
+  Size Bytes() const noexcept { return sizeof(HirMemoKey) + sizeof(AV) + args.capacity() * sizeof(args[0]); }
+};
+
+struct HirMemoKeyHash {
+  Size operator()(const HirMemoKey& key) const noexcept {
+    UI64 h = key.fn;
+    for (const auto& [type, bits] : key.args)
+      h = (h ^ (bits + static_cast<UI64>(type) * 0x9E3779B97F4A7C15ull)) * 0xFF51AFD7ED558CCDull;
+    return static_cast<Size>(h ^ (h >> 32));
+  }
+};
+
+/// @brief Truth value of a condition. Only booleans and integrals may be tested.
+inline Opt<bool> HirTruthOf(const AV& value) {
+  switch (value.TypeIndex()) {
+    case eTypeIndex::Bool:
+      return AV::CppRef<Bool>(value).data;
+    case eTypeIndex::I8:
+      return AV::CppRef<I8>(value).data != 0;
+    case eTypeIndex::I16:
+      return AV::CppRef<I16>(value).data != 0;
+    case eTypeIndex::I32:
+      return AV::CppRef<I32>(value).data != 0;
+    case eTypeIndex::I64:
+      return AV::CppRef<I64>(value).data != 0;
+    case eTypeIndex::U8:
+      return AV::CppRef<U8>(value).data != 0;
+    case eTypeIndex::U16:
+      return AV::CppRef<U16>(value).data != 0;
+    case eTypeIndex::U32:
+      return AV::CppRef<U32>(value).data != 0;
+    case eTypeIndex::U64:
+      return AV::CppRef<U64>(value).data != 0;
+    default:
+      return std::nullopt;
+  }
+}
+
+inline AV HirNot(const AV& value) {
+  auto truth = HirTruthOf(value);
+  return truth ? AV::Make<Bool>(!*truth) : AV::MakeInvalidOpError();
+}
+
+inline AV HirNegate(const AV& value) {
+  switch (value.TypeIndex()) {
+    case eTypeIndex::I8:
+      return AV::Make<I8>(static_cast<I8::DataT>(-AV::CppRef<I8>(value).data));
+    case eTypeIndex::I16:
+      return AV::Make<I16>(static_cast<I16::DataT>(-AV::CppRef<I16>(value).data));
+    case eTypeIndex::I32:
+      return AV::Make<I32>(-AV::CppRef<I32>(value).data);
+    case eTypeIndex::I64:
+      return AV::Make<I64>(-AV::CppRef<I64>(value).data);
+    case eTypeIndex::F32:
+      return AV::Make<F32>(-AV::CppRef<F32>(value).data);
+    case eTypeIndex::F64:
+      return AV::Make<F64>(-AV::CppRef<F64>(value).data);
+    default:
+      return AV::MakeInvalidOpError();
   }
+}
+
+/// @brief A call frame. Registers of the frame start at 'base' in the context register file.
+struct Environment {
+  const HirChunk* chunk{nullptr};
+  UI32 pc{0};
+  UI32 base{0};
+  UI32 ret_reg{0};  // Absolute register receiving the return value in the caller frame.
+  bool is_memoized{false};  // The result is stored under the last pending memo key on return.
 };
 
-void Context::ExecuteNext() { 
-  prev_line = curr_line;
-  curr_line++;
-  curr_line->Execute(*this);
+/// @brief Interpreter loop dispatch. Threaded dispatch ends every handler with its own indirect jump to the next
+/// handler through a table of label addresses, instead of returning to a single shared switch. It relies on the
+/// GCC/Clang labels-as-values extension, other compilers always use the switch loop.
+enum class eHirDispatch : UI8 { kSwitch, kThreaded };
+
+// clang-format off
+#if defined(__GNUC__) || defined(__clang__)
+  #define CND_HIR_THREADED_DISPATCH 1
+#else
+  #define CND_HIR_THREADED_DISPATCH 0
+#endif
+// clang-format on
+
+inline constexpr eHirDispatch kDefaultHirDispatch =
+    CND_HIR_THREADED_DISPATCH ? eHirDispatch::kThreaded : eHirDispatch::kSwitch;
+
+/// @brief Register virtual machine. Reusable between runs, the register file and frame stack keep their capacity.
+///
+/// Memoized results are kept between runs of the same program, and dropped when a different program is run. A
+/// program may grow between runs, but its functions must not be replaced.
+struct Context {
+  static constexpr Size kMaxCallDepth = 1024;
+  static constexpr Size kDefaultMemoBudget = Size{16} << 20;
+
+  eContextState state{eContextState::kPause};
+  eHirDispatch dispatch{kDefaultHirDispatch};
+  Vec<AV> regs{};
+  Vec<Environment> frames{};
+  Size memo_budget{kDefaultMemoBudget};  // Bytes of memoized results to keep at most. Zero disables memoization.
+  Size memo_hits{0};
+
+  ClRes<AV> Run(const HirProgram& program, const HirChunk& entry, std::span<const AV> args = {});
+
+  Size MemoBytes() const noexcept { return memo_bytes_; }
+  Size MemoCount() const noexcept { return memo_.size(); }
+  void ClearMemo() noexcept;
+
+ private:
+  FlatMap<HirMemoKey, AV, HirMemoKeyHash> memo_{};
+  Vec<HirMemoKey> memo_pending_{};  // Keys of the memoized frames on the stack, innermost last.
+  Size memo_bytes_{0};
+  const HirProgram* memo_program_{nullptr};
+
+  enum class eMemoLookup : UI8 { kSkip, kHit, kMiss };
+
+  template <eHirDispatch kDispatch>
+  ClRes<AV> Execute(const HirProgram& program);
+  eMemoLookup LookupMemo(HirProgram::FnId fn, AV* args, UI32 arg_count);
+  void Memoize(const AV& result);
+};
+
+inline void Context::ClearMemo() noexcept {
+  memo_.clear();
+  memo_bytes_ = 0;
+}
+
+// On a hit the result replaces the first argument, where the call would have returned it. On a miss the key is kept
+// until the call returns.
+inline Context::eMemoLookup Context::LookupMemo(HirProgram::FnId fn, AV* args, UI32 arg_count) {
+  auto key = HirMemoKey::Make(fn, std::span<const AV>{args, arg_count});
+  if (!key) return eMemoLookup::kSkip;
+  if (auto hit = memo_.find(*key); hit != memo_.end()) {
+    args[0] = hit->second;
+    memo_hits++;
+    return eMemoLookup::kHit;
+  }
+  memo_pending_.push_back(std::move(*key));
+  return eMemoLookup::kMiss;
 }
 
-}  // namespace cnd::hir
\ No newline at end of file
+// Results are kept until the budget is spent. Later results are not stored, the earlier ones are not evicted.
+inline void Context::Memoize(const AV& result) {
+  HirMemoKey key = std::move(memo_pending_.back());
+  memo_pending_.pop_back();
+  if (!AV::IsInline(result)) return;  // Only inline values, they hold no heap memory.
+  const Size bytes = key.Bytes();
+  if (memo_bytes_ + bytes > memo_budget) return;
+  if (memo_.try_emplace(std::move(key), result).second) memo_bytes_ += bytes;
+}
+
+inline ClRes<AV> Context::Run(const HirProgram& program, const HirChunk& entry, std::span<const AV> args) {
+  if (args.size() != entry.param_count) {
+    state = eContextState::kExit;
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), "Argument count does not match the entry chunk parameters."));
+  }
+
+  frames.clear();
+  memo_pending_.clear();
+  if (memo_program_ != &program) {
+    ClearMemo();
+    memo_program_ = &program;
+  }
+  if (regs.size() < entry.register_count) regs.resize(entry.register_count);
+  std::copy(args.begin(), args.end(), regs.begin());
+  frames.push_back(Environment{.chunk = &entry, .pc = 0, .base = 0, .ret_reg = 0});
+  state = eContextState::kExecute;
+
+  if (CND_HIR_THREADED_DISPATCH && dispatch == eHirDispatch::kThreaded)
+    return Execute<eHirDispatch::kThreaded>(program);
+  return Execute<eHirDispatch::kSwitch>(program);
+}
+
+// Every handler is written once. 'CND_MM_LOCAL_HIR_CASE' labels it as a switch case and, when threaded dispatch is
+// available, as a jump target. 'CND_MM_LOCAL_HIR_NEXT' fetches the next op and jumps straight to its handler, or
+// returns to the switch.
+// clang-format off
+#define CND_MM_LOCAL_HIR_CASE(n) case eHirOp::n: op_##n
+#if CND_HIR_THREADED_DISPATCH
+  #define CND_MM_LOCAL_HIR_NEXT()                                      \
+    do {                                                               \
+      if constexpr (kDispatch == eHirDispatch::kThreaded) {            \
+        op = ip++;                                                     \
+        goto* kHandlers[static_cast<Size>(op->op)];                    \
+      } else {                                                         \
+        goto dispatch;                                                 \
+      }                                                                \
+    } while (false)
+#else
+  #define CND_MM_LOCAL_HIR_NEXT() goto dispatch
+#endif
+#define CND_MM_LOCAL_HIR_RESULT_CHECK()                                \
+  if (AV::Is<Error>(r[op->a])) [[unlikely]]                            \
+    return xFail(AV::CppRef<Error>(r[op->a]).data)
+#define CND_MM_LOCAL_HIR_BINARY_CASE(n, fn)                            \
+  CND_MM_LOCAL_HIR_CASE(n):                                            \
+    r[op->a] = AV::fn(r[op->b], r[op->c]);                             \
+    CND_MM_LOCAL_HIR_RESULT_CHECK();                                   \
+    CND_MM_LOCAL_HIR_NEXT()
+// clang-format on
+
+template <eHirDispatch kDispatch>
+ClRes<AV> Context::Execute(const HirProgram& program) {
+  LAMBDA xFail = [this](const char* msg) -> ClRes<AV> {
+    state = eContextState::kExit;
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(), msg));
+  };
+
+#if CND_HIR_THREADED_DISPATCH
+  // Indexed by eHirOp, in declaration order.
+  static void* const kHandlers[] = {
+      &&op_kNop, &&op_kLoadConst, &&op_kMove, &&op_kLoadGlobal, &&op_kStoreGlobal, &&op_kCheckType,
+      &&op_kAdd, &&op_kSub, &&op_kMul, &&op_kDiv, &&op_kMod, &&op_kAnd, &&op_kOr, &&op_kXor, &&op_kLsh, &&op_kRsh,
+      &&op_kEq, &&op_kNeq, &&op_kLt, &&op_kGt, &&op_kLte, &&op_kGte,
+      &&op_kNot, &&op_kNeg,
+      &&op_kJump, &&op_kJumpIfFalse, &&op_kJumpIfTrue, &&op_kCall, &&op_kReturn, &&op_kReturnNone};
+  static_assert(std::size(kHandlers) == static_cast<Size>(eHirOp::COUNT), "Missing a threaded op handler.");
+#endif
+
+  // Cached state of the top frame, reloaded on every call and return. The frame's pc is only written back on calls.
+  Environment* frame = &frames.back();
+  const HirOp* code = frame->chunk->code.data();
+  const HirOp* ip = code + frame->pc;
+  const HirOp* op = nullptr;
+  const AV* consts = frame->chunk->constants.data();
+  AV* r = regs.data() + frame->base;
+
+[[maybe_unused]] dispatch:  // Threaded dispatch only passes through here for the first op.
+  op = ip++;
+  switch (op->op) {
+    CND_MM_LOCAL_HIR_CASE(kNop):
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kLoadConst):
+      r[op->a] = consts[op->Bx()];
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kMove):
+      r[op->a] = r[op->b];
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kLoadGlobal):
+      if (AV::Is<Undefined>(*program.globals[op->Bx()])) return xFail("Global variable used before its definition.");
+      r[op->a] = *program.globals[op->Bx()];
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kStoreGlobal):
+      *program.globals[op->Bx()] = r[op->a];
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kCheckType):
+      if (r[op->a].TypeIndex() != static_cast<eTypeIndex>(op->Bx()))
+        return xFail("Value does not satisfy the type constraint of its variable.");
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_BINARY_CASE(kAdd, Add);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kSub, Sub);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kMul, Mul);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kDiv, Div);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kMod, Mod);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kAnd, And);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kOr, Or);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kXor, Xor);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kLsh, Lsh);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kRsh, Rsh);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kEq, Eq);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kNeq, Neq);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kLt, Lt);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kGt, Gt);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kLte, Lte);
+    CND_MM_LOCAL_HIR_BINARY_CASE(kGte, Gte);
+    CND_MM_LOCAL_HIR_CASE(kNot):
+      r[op->a] = HirNot(r[op->b]);
+      CND_MM_LOCAL_HIR_RESULT_CHECK();
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kNeg):
+      r[op->a] = HirNegate(r[op->b]);
+      CND_MM_LOCAL_HIR_RESULT_CHECK();
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kJump):
+      ip = code + op->Bx();
+      CND_MM_LOCAL_HIR_NEXT();
+    CND_MM_LOCAL_HIR_CASE(kJumpIfFalse):
+    CND_MM_LOCAL_HIR_CASE(kJumpIfTrue): {
+      auto truth = HirTruthOf(r[op->a]);
+      if (!truth) return xFail("Condition must be a boolean or integral value.");
+      if (*truth == (op->op == eHirOp::kJumpIfTrue)) ip = code + op->Bx();
+      CND_MM_LOCAL_HIR_NEXT();
+    }
+    CND_MM_LOCAL_HIR_CASE(kCall): {
+      const HirChunk& callee = program.functions[op->Bx()];
+      const eMemoLookup memo =
+          callee.is_pure && memo_budget > 0 ? LookupMemo(op->Bx(), r + op->a, callee.param_count) : eMemoLookup::kSkip;
+      if (memo == eMemoLookup::kHit) CND_MM_LOCAL_HIR_NEXT();
+      if (frames.size() >= kMaxCallDepth) return xFail("Compile time call depth limit exceeded.");
+      const UI32 base = frame->base + op->a;
+      if (regs.size() < base + callee.register_count) regs.resize(base + callee.register_count);
+      frame->pc = static_cast<UI32>(ip - code);
+      frames.push_back(
+          Environment{.chunk = &callee, .pc = 0, .base = base, .ret_reg = base, .is_memoized = memo == eMemoLookup::kMiss});
+      frame = &frames.back();
+      code = callee.code.data();
+      ip = code;
+      consts = callee.constants.data();
+      r = regs.data() + base;
+      CND_MM_LOCAL_HIR_NEXT();
+    }
+    CND_MM_LOCAL_HIR_CASE(kReturn):
+    CND_MM_LOCAL_HIR_CASE(kReturnNone): {
+      AV result = op->op == eHirOp::kReturn ? r[op->a] : AV::Make<None>();
+      if (frame->is_memoized) Memoize(result);
+      const UI32 ret_reg = frame->ret_reg;
+      frames.pop_back();
+      if (frames.empty()) {
+        state = eContextState::kExit;
+        return result;
+      }
+      frame = &frames.back();
+      code = frame->chunk->code.data();
+      ip = code + frame->pc;
+      consts = frame->chunk->constants.data();
+      regs[ret_reg] = result;
+      r = regs.data() + frame->base;
+      CND_MM_LOCAL_HIR_NEXT();
+    }
+    default:
+      return xFail("Invalid bytecode operation.");
+  }
+}
+
+#undef CND_MM_LOCAL_HIR_CASE
+#undef CND_MM_LOCAL_HIR_NEXT
+#undef CND_MM_LOCAL_HIR_RESULT_CHECK
+#undef CND_MM_LOCAL_HIR_BINARY_CASE
+
+}  // namespace cnd::hir
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
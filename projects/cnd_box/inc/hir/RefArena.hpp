@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_hir
+/// @brief Pooled storage for reference counted objects.
+///
+/// A RefBlock holds the reference count of an object next to its payload, so an object is a single allocation. Blocks
+/// are taken from per-type pools of a RefArena, which carve them out of geometrically growing slabs and keep released
+/// blocks on a free list. Destroying the arena frees every slab at once. Payloads which are trivially destructible are
+/// never visited, others still alive are destroyed first because they may own heap memory of their own.
+///
+/// Blocks are allocated from the arena active on the current thread, see RefArenaScope. Without an active arena they
+/// are allocated on the heap, one at a time.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_hir
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include <atomic>
+#include <memory>
+#include <new>
+// clang-format on
+
+namespace cnd::hir {
+
+class RefPoolBase;
+
+/// Header of a reference counted block. 'pool' is the pool the block was taken from, or null for a heap block.
+struct RefControl {
+  std::size_t count{0};
+  RefPoolBase* pool{nullptr};
+};
+
+/// A reference count and the storage of its payload in a single allocation.
+template <class T>
+struct RefBlock {
+  RefControl control{};
+  alignas(T) std::byte storage[sizeof(T)];
+
+  T* Value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+  // The count is the first member of the block, so a RefObject finds its block from its count pointer.
+  static RefBlock* FromCount(std::size_t* count) noexcept { return reinterpret_cast<RefBlock*>(count); }
+};
+
+class RefPoolBase {
+ public:
+  virtual ~RefPoolBase() = default;
+};
+
+/// Blocks of a single payload type.
+template <class T>
+class RefPool final : public RefPoolBase {
+ public:
+  static constexpr Size kFirstSlabSize = 64;
+  static constexpr Size kMaxSlabSize = 4096;
+
+  RefPool() = default;
+  RefPool(const RefPool&) = delete;
+  RefPool& operator=(const RefPool&) = delete;
+
+  ~RefPool() override {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      if (live_ == 0) return;
+      for (Size i = 0; i < slabs_.size(); i++) {
+        const Size carved = i + 1 == slabs_.size() ? slab_used_ : slabs_[i].size;
+        for (Size j = 0; j < carved; j++)
+          if (slabs_[i].blocks[j].control.count > 0) std::destroy_at(slabs_[i].blocks[j].Value());
+      }
+    }
+  }
+
+  template <class... ArgTs>
+  RefBlock<T>* New(ArgTs&&... args) {
+    RefBlock<T>* block = Take();
+    ::new (static_cast<void*>(block->storage)) T(std::forward<ArgTs>(args)...);
+    block->control = RefControl{.count = 1, .pool = this};
+    live_++;
+    return block;
+  }
+
+  void Delete(RefBlock<T>* block) noexcept {
+    std::destroy_at(block->Value());
+    block->control.count = 0;
+    free_.push_back(block);
+    live_--;
+  }
+
+  Size LiveCount() const noexcept { return live_; }
+  Size SlabCount() const noexcept { return slabs_.size(); }
+
+ private:
+  struct Slab {
+    std::unique_ptr<RefBlock<T>[]> blocks;
+    Size size;
+  };
+
+  Vec<Slab> slabs_{};
+  Size slab_used_{0};  // Blocks carved from the last slab.
+  Vec<RefBlock<T>*> free_{};
+  Size live_{0};
+
+  RefBlock<T>* Take() {
+    if (!free_.empty()) {
+      RefBlock<T>* block = free_.back();
+      free_.pop_back();
+      return block;
+    }
+    if (slabs_.empty() || slab_used_ == slabs_.back().size) {
+      const Size size = slabs_.empty() ? kFirstSlabSize : std::min(slabs_.back().size * 2, kMaxSlabSize);
+      slabs_.push_back(Slab{std::make_unique<RefBlock<T>[]>(size), size});
+      slab_used_ = 0;
+    }
+    return &slabs_.back().blocks[slab_used_++];
+  }
+};
+
+inline Size NextRefPoolId() noexcept {
+  static std::atomic<Size> next{0};
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// Index of the pool of T in every arena.
+template <class T>
+Size RefPoolId() noexcept {
+  static const Size id = NextRefPoolId();
+  return id;
+}
+
+/// Owns one pool per payload type. Not thread safe, an arena is used by the thread evaluating its translation unit.
+class RefArena {
+ public:
+  RefArena() = default;
+  RefArena(const RefArena&) = delete;
+  RefArena& operator=(const RefArena&) = delete;
+
+  template <class T>
+  RefPool<T>& Pool() {
+    const Size id = RefPoolId<T>();
+    if (id >= pools_.size()) pools_.resize(id + 1);
+    if (!pools_[id]) pools_[id] = std::make_unique<RefPool<T>>();
+    return static_cast<RefPool<T>&>(*pools_[id]);
+  }
+
+ private:
+  Vec<std::unique_ptr<RefPoolBase>> pools_{};
+};
+
+/// @brief Arena receiving new reference counted blocks on the current thread. Null if blocks go to the heap.
+inline RefArena*& ActiveRefArena() noexcept {
+  thread_local RefArena* active = nullptr;
+  return active;
+}
+
+/// @brief Activates an arena on the current thread for the lifetime of the guard. The previous arena is restored on
+/// destruction.
+class RefArenaScope {
+ public:
+  explicit RefArenaScope(RefArena& arena) noexcept : prev_(ActiveRefArena()) { ActiveRefArena() = &arena; }
+  ~RefArenaScope() noexcept { ActiveRefArena() = prev_; }
+  RefArenaScope(const RefArenaScope&) = delete;
+  RefArenaScope& operator=(const RefArenaScope&) = delete;
+
+ private:
+  RefArena* prev_{nullptr};
+};
+
+/// @brief Construct a payload in a block of the active arena, or in a heap block if there is none.
+template <class T, class... ArgTs>
+RefBlock<T>* NewRefBlock(ArgTs&&... args) {
+  if (RefArena* arena = ActiveRefArena()) return arena->Pool<T>().New(std::forward<ArgTs>(args)...);
+  auto* block = new RefBlock<T>{};
+  ::new (static_cast<void*>(block->storage)) T(std::forward<ArgTs>(args)...);
+  block->control.count = 1;
+  return block;
+}
+
+/// @brief Destroy the payload of a block and return the block to the pool it came from.
+template <class T>
+void DeleteRefBlock(RefBlock<T>* block) noexcept {
+  if (block->control.pool != nullptr) {
+    static_cast<RefPool<T>*>(block->control.pool)->Delete(block);
+    return;
+  }
+  std::destroy_at(block->Value());
+  delete block;
+}
+
+}  // namespace cnd::hir
+
+/// @} // end of cnd_hir
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,10 +32,24 @@
 ///
 ///    - GetRef : Get a new C& reference to the object.
 ///                      Increments the reference count.
+///
+/// InlineObject stores a small value in place, behind the same interface.
+///  Copy and Move produce an independent copy of the value. It cannot be
+///  referenced, AnyValue::Ref and AnyValue::WeakRef of an inline value
+///  are errors. It never allocates and is never deleted.
+///
+/// CowObject is a reference counted object which is copied on write.
+///  References of the object share a handle, the handle points to a
+///  payload which is shared by copies of the object. Copy only counts
+///  another owner of the payload. The first mutable access through
+///  a handle whose payload has other owners clones the payload, so
+///  references keep observing each other while copies diverge.
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
 #include <type_traits>
+#include <utility>
+#include "RefArena.hpp"
 
 namespace cnd::hir {
 
@@ -45,24 +59,17 @@ template <typename T>
 // requires(not std::is_trivial_v<T>)
 class RefObject {
  public:
-  static constexpr RefObject New() noexcept {
-    return RefObject{
-        .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = new T{},
-    };
-  }
+  static RefObject New() { return FromBlock(NewRefBlock<T>()); }
 
   // Pass to New with arguments to construct the object in-place.
   // Create a new C& rvalue with the given data pointer.
   // RefObject owns the data pointer. And will handle deletion.
-  static constexpr RefObject New(T* data_ptr) noexcept {
+  // The data is moved into a new block, then the pointer is deleted.
+  static RefObject New(T* data_ptr) {
     assert(data_ptr != nullptr && "[C&] Creating null data is forbidden.");
-    return RefObject{
-        .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = data_ptr,
-    };
+    RefObject ret = FromBlock(NewRefBlock<T>(std::move(*data_ptr)));
+    delete data_ptr;
+    return ret;
   }
 
   // RefObject does not own the data pointer. And will not handle deletion.
@@ -76,32 +83,25 @@ class RefObject {
 
   // Create a new C& rvalue given a C++ rvalue.
   // Forwards the rvalue to the constructor of the object.
-  static constexpr RefObject New(T&& rvalue_data) noexcept {
-    return RefObject{
-        .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = new T(std::forward<T>(rvalue_data)),
-    };
-  }
+  static RefObject New(T&& rvalue_data) { return FromBlock(NewRefBlock<T>(std::forward<T>(rvalue_data))); }
 
   // Create a new C& rvalue given a C++ lvalue.
   // Copies the lvalue to the constructor of the object.
-  static constexpr RefObject New(const T& lvalue_data) noexcept {
-    return RefObject{
-        .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = new T(lvalue_data),
-    };
-  }
+  static RefObject New(const T& lvalue_data) { return FromBlock(NewRefBlock<T>(lvalue_data)); }
 
   // Create a new C& rvalue given an inplace constructor tag
   // and the arguments to pass to the constructor.
   template <typename... Args>
-  static constexpr RefObject New(InplaceConstructorTag, Args&&... args) noexcept {
+  static RefObject New(InplaceConstructorTag, Args&&... args) {
+    return FromBlock(NewRefBlock<T>(std::forward<Args>(args)...));
+  }
+
+  // The count and the data of a new object share a single block.
+  static RefObject FromBlock(RefBlock<T>* block) noexcept {
     return RefObject{
         .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = new T(std::forward<Args>(args)...),
+        .count = &block->control.count,
+        .ptr = block->Value(),
     };
   }
 
@@ -132,13 +132,9 @@ class RefObject {
   }
 
   // Creates a copy of the object with a new reference count.
-  constexpr inline RefObject Copy() const noexcept {
+  inline RefObject Copy() const {
     assert(not is_deleted && "[C&] Cannot copy a deleted object.");
-    return RefObject{
-        .is_deleted = false,
-        .count = new std::size_t(1),
-        .ptr = new T(*ptr),
-    };
+    return New(*ptr);
   }
 
   // The count of this object is deleted.
@@ -176,6 +172,9 @@ class RefObject {
     };
   }
 
+  // Obtain a weak reference to the object. Does not increment the reference count.
+  constexpr inline RefObject MakeWeak() const noexcept { return NewWeak(ptr); }
+
  public:
   //// Copy constructor. Does not increment the reference count.
   // constexpr inline RefObject(const RefObject& other) noexcept
@@ -219,15 +218,14 @@ class RefObject {
   // 1. Was the object moved/already deleted ?
   // 2. Is the object still being referenced? -> Decrement the reference count
   // 3. Are there no references left? -> Delete the object
-  constexpr inline bool Release() noexcept {
+  inline bool Release() noexcept {
     if (not is_deleted) {
       if ((*count) > 0) {
         (*count)--;
 
         if (*count == 0) {
           is_deleted = true;
-          delete count;
-          delete ptr;
+          DeleteRefBlock(RefBlock<T>::FromCount(count));
           return false;
         } else
           return true;
@@ -241,6 +239,166 @@ class RefObject {
   std::size_t* count{nullptr};      // C& Reference count of the object.
   T* ptr{nullptr};                  // Pointer to the object data.
 };
+
+// Clone of a shared payload made by CowObject on its first mutation. Overloaded for payloads holding values.
+template <typename T>
+T CowClone(const T& value) {
+  return value;
+}
+
+template <typename T>
+class CowObject {
+ public:
+  using HandleT = RefBlock<RefBlock<T>*>;
+
+  static CowObject New() { return FromPayload(NewRefBlock<T>()); }
+
+  // CowObject owns the data pointer. The data is moved into a new payload, then the pointer is deleted.
+  static CowObject New(T* data_ptr) {
+    assert(data_ptr != nullptr && "[C&] Creating null data is forbidden.");
+    CowObject ret = FromPayload(NewRefBlock<T>(std::move(*data_ptr)));
+    delete data_ptr;
+    return ret;
+  }
+
+  static CowObject New(T&& rvalue_data) { return FromPayload(NewRefBlock<T>(std::forward<T>(rvalue_data))); }
+
+  static CowObject New(const T& lvalue_data) { return FromPayload(NewRefBlock<T>(lvalue_data)); }
+
+  template <typename... Args>
+  static CowObject New(InplaceConstructorTag, Args&&... args) {
+    return FromPayload(NewRefBlock<T>(std::forward<Args>(args)...));
+  }
+
+  // Creates a new handle owning one count of the payload.
+  static CowObject FromPayload(RefBlock<T>* payload) {
+    HandleT* handle = NewRefBlock<RefBlock<T>*>(payload);
+    return CowObject{
+        .is_deleted = false,
+        .count = &handle->control.count,
+        .ptr = handle->Value(),
+    };
+  }
+
+ public:
+  constexpr inline bool IsDeleted() const noexcept { return is_deleted; }
+
+  // Get a mutable C++ reference to the object. Clones the payload if it is shared with a copy.
+  inline T& Self() {
+    if ((*ptr)->control.count > 1) Unshare();
+    return *(*ptr)->Value();
+  }
+
+  // Get a C++ reference to the object. Never clones.
+  inline const T& Self() const noexcept { return *(*ptr)->Value(); }
+
+  inline const T& ConstSelf() const noexcept { return *(*ptr)->Value(); }
+
+  // Creates a copy of the object sharing its payload. The copy is cloned once either side is mutated.
+  inline CowObject Copy() const {
+    assert(not is_deleted && "[C&] Cannot copy a deleted object.");
+    (*ptr)->control.count++;
+    return FromPayload(*ptr);
+  }
+
+  constexpr inline CowObject Move() noexcept {
+    assert(not is_deleted && "[C&] Cannot move a deleted object.");
+    auto ret = CowObject{
+        .is_deleted = false,
+        .count = count,
+        .ptr = ptr,
+    };
+    count = nullptr;
+    ptr = nullptr;
+    is_deleted = true;
+    return ret;
+  }
+
+  // Obtain a C& reference to the object. Increments the reference count of the handle.
+  constexpr inline CowObject MakeRef() noexcept {
+    assert(not is_deleted && "[C&] Cannot reference a deleted object.");
+    (*count)++;
+    return CowObject{
+        .is_deleted = false,
+        .count = count,
+        .ptr = ptr,
+    };
+  }
+
+  // Obtain a weak reference to the object. Does not increment the reference count.
+  constexpr inline CowObject MakeWeak() const noexcept {
+    return CowObject{
+        .is_deleted = true,
+        .count = nullptr,
+        .ptr = ptr,
+    };
+  }
+
+  // True if releasing this object destroys the payload: no other reference or copy can observe it.
+  constexpr inline bool IsSoleOwner() const noexcept {
+    return not is_deleted && *count == 1 && (*ptr)->control.count == 1;
+  }
+
+  // Block currently holding the value. Changes when a shared payload is cloned.
+  constexpr inline RefBlock<T>* Payload() const noexcept { return *ptr; }
+
+  // Releases a count of the handle. The last reference releases a count of the payload, which is deleted with
+  // its last owner.
+  inline bool Release() noexcept {
+    if (is_deleted || *count == 0) return false;
+    (*count)--;
+    if (*count > 0) return true;
+    is_deleted = true;
+    RefBlock<T>* payload = *ptr;
+    DeleteRefBlock(HandleT::FromCount(count));
+    if (--payload->control.count == 0) DeleteRefBlock(payload);
+    return false;
+  }
+
+ private:
+  // The handle leaves its shared payload to the other owners and points to a clone of it.
+  void Unshare() {
+    RefBlock<T>* shared = *ptr;
+    *ptr = NewRefBlock<T>(CowClone(std::as_const(*shared->Value())));
+    shared->control.count--;
+  }
+
+ public:
+  bool is_deleted{true};         // False if the object is still alive.
+  std::size_t* count{nullptr};   // C& Reference count of the handle.
+  RefBlock<T>** ptr{nullptr};    // Payload slot of the handle. The payload count is the number of copies.
+};
+
+template <typename T>
+class InlineObject {
+ public:
+  static constexpr InlineObject New() noexcept { return InlineObject{}; }
+
+  static constexpr InlineObject New(const T& lvalue_data) noexcept { return InlineObject{.data = lvalue_data}; }
+
+  template <typename... Args>
+  static constexpr InlineObject New(InplaceConstructorTag, Args&&... args) noexcept {
+    return InlineObject{.data = T(std::forward<Args>(args)...)};
+  }
+
+ public:
+  // Inline objects are never deleted.
+  constexpr inline bool IsDeleted() const noexcept { return false; }
+
+  constexpr inline T& Self() noexcept { return data; }
+  constexpr inline const T& Self() const noexcept { return data; }
+  constexpr inline const T& ConstSelf() const noexcept { return data; }
+
+  // Copies and moves of an inline object are copies of the value. A copy cannot alias, so there is no MakeRef.
+  constexpr inline InlineObject Copy() const noexcept { return *this; }
+  constexpr inline InlineObject Move() noexcept { return *this; }
+
+  // Nothing to release, the value is owned by whatever holds the object.
+  constexpr inline bool Release() noexcept { return false; }
+
+ public:
+  T data{};  // The object data.
+};
 }  // namespace cnd::hir
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,538 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Low level intermediate representation in static single assignment form.
+///
+/// A LirFunction is a control flow graph of basic blocks. Every virtual register is typed and defined by exactly one
+/// instruction. Values which depend on the path taken are merged by the phi nodes at the top of a block, a phi holds
+/// one operand per predecessor, in the order of the block's 'preds'. Every block ends with a single terminator.
+///
+/// Values are 32 bit integers and booleans. Integer arithmetic wraps, shifts use the low 5 bits of their amount, and
+/// division or modulo by zero traps. Functions take and return integers. The code generators consume the LIR once
+/// the passes of LirPasses.hpp have optimized it, LirExecute runs it directly.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "compiler_utils/SymbolTable.hpp"
+// clang-format on
+
+namespace cnd::lir {
+
+enum class eLirType : UI8 { kVoid, kBool, kI32 };
+
+constexpr CStr eLirTypeToCStr(eLirType type) noexcept {
+  switch (type) {
+    case eLirType::kBool: return "bool";
+    case eLirType::kI32: return "i32";
+    default: return "void";
+  }
+}
+
+enum class eLirOp : UI8 {
+  kConst,  // DST = IMM
+  kParam,  // DST = argument IMM
+  kCopy,   // DST = ARG0
+  kPhi,    // DST = ARGi, if entered from the i-th predecessor.
+
+  // Binary operations. DST = ARG0 op ARG1. Comparisons produce a bool.
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+  kMod,
+  kAnd,
+  kOr,
+  kXor,
+  kLsh,
+  kRsh,
+  kEq,
+  kNeq,
+  kLt,
+  kGt,
+  kLte,
+  kGte,
+
+  // Unary operations. DST = op ARG0
+  kNeg,   // i32 negation.
+  kNot,   // bool negation.
+  kZext,  // bool to i32.
+
+  kCall,  // DST = function IMM (ARGS...)
+
+  // Terminators.
+  kJump,    // TARGET0
+  kBranch,  // ARG0 ? TARGET0 : TARGET1
+  kReturn,  // ARG0
+  COUNT
+};
+
+constexpr CStr eLirOpToCStr(eLirOp op) noexcept {
+  constexpr CStr kNames[] = {"const", "param", "copy", "phi", "add", "sub", "mul", "div", "mod", "and", "or",
+                             "xor", "lsh", "rsh", "eq", "neq", "lt", "gt", "lte", "gte", "neg", "not", "zext",
+                             "call", "jump", "br", "ret"};
+  static_assert(std::size(kNames) == static_cast<Size>(eLirOp::COUNT));
+  return kNames[static_cast<Size>(op)];
+}
+
+constexpr bool IsLirOpBinary(eLirOp op) noexcept { return op >= eLirOp::kAdd && op <= eLirOp::kGte; }
+constexpr bool IsLirOpComparison(eLirOp op) noexcept { return op >= eLirOp::kEq && op <= eLirOp::kGte; }
+constexpr bool IsLirOpUnary(eLirOp op) noexcept { return op >= eLirOp::kNeg && op <= eLirOp::kZext; }
+constexpr bool IsLirOpTerminator(eLirOp op) noexcept { return op >= eLirOp::kJump; }
+
+/// @brief True if swapping the operands of the binary op does not change its result.
+constexpr bool IsLirOpCommutative(eLirOp op) noexcept {
+  switch (op) {
+    case eLirOp::kAdd:
+    case eLirOp::kMul:
+    case eLirOp::kAnd:
+    case eLirOp::kOr:
+    case eLirOp::kXor:
+    case eLirOp::kEq:
+    case eLirOp::kNeq:
+      return true;
+    default:
+      return false;
+  }
+}
+
+using LirReg = UI32;
+using LirBlockId = UI32;
+using LirFnId = UI32;
+inline constexpr LirReg kNoLirReg = std::numeric_limits<LirReg>::max();
+inline constexpr LirBlockId kNoLirBlock = std::numeric_limits<LirBlockId>::max();
+
+struct LirInst {
+  eLirOp op{eLirOp::kConst};
+  eLirType type{eLirType::kVoid};  // Type of 'dst'.
+  LirReg dst{kNoLirReg};
+  Vec<LirReg> args{};
+  I64 imm{0};  // kConst value, kParam index or kCall function.
+  std::array<LirBlockId, 2> targets{kNoLirBlock, kNoLirBlock};
+};
+
+struct LirBlock {
+  Vec<LirInst> phis{};
+  Vec<LirInst> insts{};  // The last one is the terminator once the block is complete.
+  Vec<LirBlockId> preds{};
+
+  bool IsTerminated() const noexcept { return !insts.empty() && IsLirOpTerminator(insts.back().op); }
+
+  /// @brief Blocks the terminator may jump to. A branch to the same block twice lists it twice.
+  Vec<LirBlockId> Succs() const {
+    if (!IsTerminated()) return {};
+    const LirInst& term = insts.back();
+    if (term.op == eLirOp::kJump) return {term.targets[0]};
+    if (term.op == eLirOp::kBranch) return {term.targets[0], term.targets[1]};
+    return {};
+  }
+};
+
+struct LirFunction {
+  Str name{};
+  SymbolId symbol{kNoSymbol};
+  UI32 param_count{0};
+  Vec<LirBlock> blocks{};  // The first block is the entry, it has no predecessors.
+  Vec<eLirType> reg_types{};
+
+  LirReg NewReg(eLirType type) {
+    reg_types.push_back(type);
+    return static_cast<LirReg>(reg_types.size() - 1);
+  }
+
+  LirBlockId NewBlock() {
+    blocks.emplace_back();
+    return static_cast<LirBlockId>(blocks.size() - 1);
+  }
+
+  /// @brief Count of instructions and phis.
+  Size InstCount() const noexcept {
+    Size count = 0;
+    for (const LirBlock& block : blocks) count += block.phis.size() + block.insts.size();
+    return count;
+  }
+
+  Str Format() const;
+};
+
+/// @brief Every function of a translation unit. Calls refer to functions by index.
+struct LirModule {
+  Vec<LirFunction> functions{};
+  FlatMap<SymbolId, LirFnId> function_ids{};
+
+  Opt<LirFnId> FindFunction(SymbolId name) const {
+    auto found = function_ids.find(name);
+    return found == function_ids.end() ? Opt<LirFnId>{} : found->second;
+  }
+
+  Size InstCount() const noexcept {
+    Size count = 0;
+    for (const LirFunction& fn : functions) count += fn.InstCount();
+    return count;
+  }
+
+  Str Format() const {
+    Str out{};
+    for (const LirFunction& fn : functions) out += fn.Format();
+    return out;
+  }
+};
+
+/// @brief Value of an operation on constant operands, or none if it traps. Operands of type 'type'.
+constexpr Opt<I64> LirEvalOp(eLirOp op, I64 lhs, I64 rhs = 0) noexcept {
+  const auto a = static_cast<I32>(lhs);
+  const auto b = static_cast<I32>(rhs);
+  const auto ua = static_cast<UI32>(a);
+  const auto ub = static_cast<UI32>(b);
+  switch (op) {
+    case eLirOp::kAdd: return static_cast<I32>(ua + ub);
+    case eLirOp::kSub: return static_cast<I32>(ua - ub);
+    case eLirOp::kMul: return static_cast<I32>(ua * ub);
+    case eLirOp::kDiv:
+      if (b == 0) return std::nullopt;
+      return b == -1 ? static_cast<I32>(0u - ua) : a / b;
+    case eLirOp::kMod:
+      if (b == 0) return std::nullopt;
+      return b == -1 ? 0 : a % b;
+    case eLirOp::kAnd: return a & b;
+    case eLirOp::kOr: return a | b;
+    case eLirOp::kXor: return a ^ b;
+    case eLirOp::kLsh: return static_cast<I32>(ua << (ub & 31));
+    case eLirOp::kRsh: return a >> (ub & 31);
+    case eLirOp::kEq: return a == b;
+    case eLirOp::kNeq: return a != b;
+    case eLirOp::kLt: return a < b;
+    case eLirOp::kGt: return a > b;
+    case eLirOp::kLte: return a <= b;
+    case eLirOp::kGte: return a >= b;
+    case eLirOp::kNeg: return static_cast<I32>(0u - ua);
+    case eLirOp::kNot: return a == 0;
+    case eLirOp::kZext: return a != 0;
+    default: return std::nullopt;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Control flow graph utilities.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Blocks reachable from the entry, in reverse postorder.
+inline Vec<LirBlockId> LirReversePostorder(const LirFunction& fn) {
+  Vec<LirBlockId> order{};
+  if (fn.blocks.empty()) return order;
+  Vec<char> visited(fn.blocks.size(), 0);
+  Vec<std::pair<LirBlockId, Size>> stack{{0, 0}};  // Block and index of the next successor to visit.
+  visited[0] = 1;
+  while (!stack.empty()) {
+    auto& [block, next] = stack.back();
+    const Vec<LirBlockId> succs = fn.blocks[block].Succs();
+    if (next < succs.size()) {
+      const LirBlockId succ = succs[next++];
+      if (!visited[succ]) {
+        visited[succ] = 1;
+        stack.emplace_back(succ, 0);
+      }
+      continue;
+    }
+    order.push_back(block);
+    stack.pop_back();
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/// @brief Immediate dominator of every block, kNoLirBlock for unreachable blocks. The entry dominates itself.
+/// Computed with the iterative algorithm of Cooper, Harvey and Kennedy.
+inline Vec<LirBlockId> LirDominators(const LirFunction& fn) {
+  Vec<LirBlockId> idom(fn.blocks.size(), kNoLirBlock);
+  const Vec<LirBlockId> rpo = LirReversePostorder(fn);
+  if (rpo.empty()) return idom;
+  Vec<Size> rpo_index(fn.blocks.size(), 0);
+  for (Size i = 0; i < rpo.size(); i++) rpo_index[rpo[i]] = i;
+
+  LAMBDA xIntersect = [&](LirBlockId a, LirBlockId b) {
+    while (a != b) {
+      while (rpo_index[a] > rpo_index[b]) a = idom[a];
+      while (rpo_index[b] > rpo_index[a]) b = idom[b];
+    }
+    return a;
+  };
+
+  idom[rpo.front()] = rpo.front();
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (Size i = 1; i < rpo.size(); i++) {
+      const LirBlockId block = rpo[i];
+      LirBlockId new_idom = kNoLirBlock;
+      for (LirBlockId pred : fn.blocks[block].preds) {
+        if (idom[pred] == kNoLirBlock) continue;
+        new_idom = new_idom == kNoLirBlock ? pred : xIntersect(pred, new_idom);
+      }
+      if (idom[block] != new_idom) {
+        idom[block] = new_idom;
+        changed = true;
+      }
+    }
+  }
+  return idom;
+}
+
+/// @brief True if 'a' dominates 'b', given the immediate dominators of a function.
+inline bool LirDominates(const Vec<LirBlockId>& idom, LirBlockId a, LirBlockId b) {
+  if (idom[b] == kNoLirBlock) return false;
+  while (b != a) {
+    if (idom[b] == b) return false;
+    b = idom[b];
+  }
+  return true;
+}
+
+/// @brief Remove the edge from 'pred' to 'block', and the operand each phi of 'block' takes from it.
+inline void LirRemoveEdge(LirFunction& fn, LirBlockId pred, LirBlockId block) {
+  LirBlock& succ = fn.blocks[block];
+  auto found = std::find(succ.preds.begin(), succ.preds.end(), pred);
+  if (found == succ.preds.end()) return;
+  const auto at = found - succ.preds.begin();
+  succ.preds.erase(found);
+  for (LirInst& phi : succ.phis) phi.args.erase(phi.args.begin() + at);
+}
+
+/// @brief Remove the blocks which cannot be reached from the entry, and renumber the others in their order.
+/// @return True if a block was removed.
+inline bool LirRemoveUnreachable(LirFunction& fn) {
+  Vec<char> reachable(fn.blocks.size(), 0);
+  for (LirBlockId block : LirReversePostorder(fn)) reachable[block] = 1;
+  if (std::ranges::all_of(reachable, [](char r) { return r != 0; })) return false;
+
+  for (LirBlockId block = 0; block < fn.blocks.size(); block++) {
+    if (!reachable[block]) continue;
+    for (Size p = fn.blocks[block].preds.size(); p-- > 0;)
+      if (!reachable[fn.blocks[block].preds[p]]) LirRemoveEdge(fn, fn.blocks[block].preds[p], block);
+  }
+
+  Vec<LirBlockId> renumbered(fn.blocks.size(), kNoLirBlock);
+  Vec<LirBlock> kept{};
+  for (LirBlockId block = 0; block < fn.blocks.size(); block++) {
+    if (!reachable[block]) continue;
+    renumbered[block] = static_cast<LirBlockId>(kept.size());
+    kept.push_back(std::move(fn.blocks[block]));
+  }
+  for (LirBlock& block : kept) {
+    for (LirBlockId& pred : block.preds) pred = renumbered[pred];
+    if (block.IsTerminated())
+      for (LirBlockId& target : block.insts.back().targets)
+        if (target != kNoLirBlock) target = renumbered[target];
+  }
+  fn.blocks = std::move(kept);
+  return true;
+}
+
+/// @brief Replace every use of a register 'r' with 'replacement[r]', where it is not kNoLirReg. Chains of
+/// replacements are followed to their end.
+inline void LirReplaceUses(LirFunction& fn, Vec<LirReg>& replacement) {
+  LAMBDA xResolve = [&](LirReg reg) {
+    LirReg end = reg;
+    while (end < replacement.size() && replacement[end] != kNoLirReg) end = replacement[end];
+    while (reg != end && reg < replacement.size() && replacement[reg] != kNoLirReg) {
+      const LirReg next = replacement[reg];
+      replacement[reg] = end;
+      reg = next;
+    }
+    return end;
+  };
+  for (LirBlock& block : fn.blocks) {
+    for (LirInst& phi : block.phis)
+      for (LirReg& arg : phi.args) arg = xResolve(arg);
+    for (LirInst& inst : block.insts)
+      for (LirReg& arg : inst.args) arg = xResolve(arg);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Printing, verification and execution.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline Str LirFunction::Format() const {
+  Str out = std::format("fn {}({}):\n", name, param_count);
+  LAMBDA xFormatInst = [&](const LirInst& inst) {
+    out += "  ";
+    if (inst.dst != kNoLirReg) out += std::format("%{}:{} = ", inst.dst, eLirTypeToCStr(inst.type));
+    out += eLirOpToCStr(inst.op);
+    if (inst.op == eLirOp::kConst || inst.op == eLirOp::kParam || inst.op == eLirOp::kCall)
+      out += std::format(" {}", inst.imm);
+    for (Size i = 0; i < inst.args.size(); i++) out += std::format("{}%{}", i == 0 ? " " : ", ", inst.args[i]);
+    if (inst.op == eLirOp::kJump) out += std::format(" b{}", inst.targets[0]);
+    if (inst.op == eLirOp::kBranch) out += std::format(", b{}, b{}", inst.targets[0], inst.targets[1]);
+    out += '\n';
+  };
+  for (Size b = 0; b < blocks.size(); b++) {
+    out += std::format("b{}:", b);
+    for (Size p = 0; p < blocks[b].preds.size(); p++) out += std::format("{}b{}", p == 0 ? " ; preds " : ", ",
+                                                                          blocks[b].preds[p]);
+    out += '\n';
+    for (const LirInst& phi : blocks[b].phis) xFormatInst(phi);
+    for (const LirInst& inst : blocks[b].insts) xFormatInst(inst);
+  }
+  return out;
+}
+
+/// @brief Check the structure of a function: terminated blocks, predecessor lists matching the terminators, one phi
+/// operand per predecessor, and registers defined once, with the declared type, before every use.
+inline ClRes<void> LirVerify(const LirFunction& fn) {
+  LAMBDA xFail = [&fn](const Str& reason) -> ClRes<void> {
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Invalid LIR in '{}': {}\n{}", fn.name, reason, fn.Format())));
+  };
+  if (fn.blocks.empty()) return xFail("No entry block.");
+  if (!fn.blocks[0].preds.empty()) return xFail("The entry block has predecessors.");
+
+  // Where each register is defined, phis at position 0 before the instructions of their block.
+  struct Def {
+    LirBlockId block{kNoLirBlock};
+    Size pos{0};
+  };
+  Vec<Def> defs(fn.reg_types.size());
+  for (LirBlockId b = 0; b < fn.blocks.size(); b++) {
+    const LirBlock& block = fn.blocks[b];
+    if (!block.IsTerminated()) return xFail(std::format("b{} has no terminator.", b));
+    for (Size i = 0; i + 1 < block.insts.size(); i++)
+      if (IsLirOpTerminator(block.insts[i].op)) return xFail(std::format("b{} has a terminator before its end.", b));
+    for (LirBlockId succ : block.Succs()) {
+      if (succ >= fn.blocks.size()) return xFail(std::format("b{} jumps to a missing block.", b));
+      const Size edges = std::ranges::count(block.Succs(), succ);
+      if (static_cast<Size>(std::ranges::count(fn.blocks[succ].preds, b)) != edges)
+        return xFail(std::format("b{} is not listed once per edge in the predecessors of b{}.", b, succ));
+    }
+    for (LirBlockId pred : block.preds)
+      if (pred >= fn.blocks.size() || std::ranges::count(fn.blocks[pred].Succs(), b) == 0)
+        return xFail(std::format("b{} lists b{} as a predecessor, which does not jump to it.", b, pred));
+
+    for (Size i = 0; i < block.phis.size() + block.insts.size(); i++) {
+      const bool is_phi = i < block.phis.size();
+      const LirInst& inst = is_phi ? block.phis[i] : block.insts[i - block.phis.size()];
+      if (is_phi != (inst.op == eLirOp::kPhi)) return xFail(std::format("b{} has a phi among its instructions.", b));
+      if (is_phi && inst.args.size() != block.preds.size())
+        return xFail(std::format("Phi %{} does not have one operand per predecessor.", inst.dst));
+      if (inst.dst == kNoLirReg) continue;
+      if (inst.dst >= defs.size() || defs[inst.dst].block != kNoLirBlock)
+        return xFail(std::format("%{} is defined more than once.", inst.dst));
+      if (fn.reg_types[inst.dst] != inst.type) return xFail(std::format("%{} does not have its type.", inst.dst));
+      defs[inst.dst] = Def{b, is_phi ? 0 : i + 1};
+    }
+  }
+
+  const Vec<LirBlockId> idom = LirDominators(fn);
+  LAMBDA xIsAvailable = [&](LirReg reg, LirBlockId block, Size pos) {
+    if (reg >= defs.size() || defs[reg].block == kNoLirBlock) return false;
+    if (defs[reg].block == block) return defs[reg].pos < pos;
+    return LirDominates(idom, defs[reg].block, block);
+  };
+  for (LirBlockId b = 0; b < fn.blocks.size(); b++) {
+    const LirBlock& block = fn.blocks[b];
+    if (idom[b] == kNoLirBlock) continue;  // Uses in unreachable blocks are never executed.
+    for (const LirInst& phi : block.phis)
+      for (Size p = 0; p < phi.args.size(); p++)
+        if (!xIsAvailable(phi.args[p], block.preds[p], std::numeric_limits<Size>::max()))
+          return xFail(std::format("Phi %{} operand %{} is not available in b{}.", phi.dst, phi.args[p],
+                                   block.preds[p]));
+    for (Size i = 0; i < block.insts.size(); i++)
+      for (LirReg arg : block.insts[i].args)
+        if (!xIsAvailable(arg, b, block.phis.size() + i + 1))
+          return xFail(std::format("%{} is used in b{} where it is not defined.", arg, b));
+  }
+  return ClRes<void>{};
+}
+
+/// @brief Run function 'fn' of 'module' with 'args'. Fails on a trap, or when calls nest deeper than 'max_depth'.
+inline ClRes<I64> LirExecute(const LirModule& module, LirFnId fn_id, std::span<const I64> args,
+                             Size max_depth = 1024) {
+  LAMBDA xFail = [](StrView reason) -> ClRes<I64> {
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(), Str{reason}));
+  };
+  if (max_depth == 0) return xFail("LIR call depth limit exceeded.");
+  const LirFunction& fn = module.functions[fn_id];
+  if (args.size() != fn.param_count) return xFail("LIR call has the wrong number of arguments.");
+
+  Vec<I64> regs(fn.reg_types.size(), 0);
+  Vec<I64> phi_values{};
+  LirBlockId prev = kNoLirBlock;
+  LirBlockId curr = 0;
+  while (true) {
+    const LirBlock& block = fn.blocks[curr];
+    // Phis read their operands as they were on the edge, before any of them is written.
+    if (!block.phis.empty()) {
+      const auto pred_at = std::find(block.preds.begin(), block.preds.end(), prev) - block.preds.begin();
+      phi_values.clear();
+      for (const LirInst& phi : block.phis) phi_values.push_back(regs[phi.args[pred_at]]);
+      for (Size i = 0; i < block.phis.size(); i++) regs[block.phis[i].dst] = phi_values[i];
+    }
+    for (const LirInst& inst : block.insts) {
+      switch (inst.op) {
+        case eLirOp::kConst: regs[inst.dst] = inst.imm; break;
+        case eLirOp::kParam: regs[inst.dst] = args[static_cast<Size>(inst.imm)]; break;
+        case eLirOp::kCopy: regs[inst.dst] = regs[inst.args[0]]; break;
+        case eLirOp::kCall: {
+          Vec<I64> call_args{};
+          call_args.reserve(inst.args.size());
+          for (LirReg arg : inst.args) call_args.push_back(regs[arg]);
+          auto result = LirExecute(module, static_cast<LirFnId>(inst.imm), call_args, max_depth - 1);
+          if (!result) return result;
+          regs[inst.dst] = *result;
+          break;
+        }
+        case eLirOp::kJump:
+          prev = curr;
+          curr = inst.targets[0];
+          break;
+        case eLirOp::kBranch:
+          prev = curr;
+          curr = regs[inst.args[0]] != 0 ? inst.targets[0] : inst.targets[1];
+          break;
+        case eLirOp::kReturn: return regs[inst.args[0]];
+        default: {
+          auto value = LirEvalOp(inst.op, regs[inst.args[0]], inst.args.size() > 1 ? regs[inst.args[1]] : 0);
+          if (!value) return xFail("Division by zero.");
+          regs[inst.dst] = *value;
+          break;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace cnd::lir
+
+/// @} // end of cnd_compiler
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,662 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Builds the low level IR of the functions of a program from the Ast.
+///
+/// SSA form is constructed while the Ast is walked, following Braun et al., "Simple and Efficient Construction of
+/// Static Single Assignment Form". Each block maps the variables assigned in it to their current register. Reading a
+/// variable not assigned in the block looks it up in the predecessors, placing a phi where several meet. A block is
+/// sealed once all of its predecessors are known, phis placed in a block before it is sealed get their operands then.
+///
+/// Variables and function results are 32 bit integers, booleans are widened when stored. Phis which turn out to merge
+/// a single value are left for LirPropagateCopies to remove. The logical operators short circuit, their result is a
+/// bool phi of the block the two paths meet in.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "frontend/Ast.hpp"
+#include "hir/AnyValue.hpp"
+#include "hir/HirLower.hpp"
+#include "lir/Lir.hpp"
+// clang-format on
+
+namespace cnd::lir {
+
+/// @brief LIR op of a binary operator ast, including the operator of a compound assignment.
+constexpr Opt<eLirOp> GetLirBinaryOp(eAst type) noexcept {
+  switch (type) {
+    case eAst::kAdd:
+    case eAst::kAddAssign:
+      return eLirOp::kAdd;
+    case eAst::kSub:
+    case eAst::kSubAssign:
+      return eLirOp::kSub;
+    case eAst::kMul:
+    case eAst::kMulAssign:
+      return eLirOp::kMul;
+    case eAst::kDiv:
+    case eAst::kDivAssign:
+      return eLirOp::kDiv;
+    case eAst::kMod:
+    case eAst::kModAssign:
+      return eLirOp::kMod;
+    case eAst::kAnd:
+    case eAst::kAndAssign:
+      return eLirOp::kAnd;
+    case eAst::kOr:
+    case eAst::kOrAssign:
+      return eLirOp::kOr;
+    case eAst::kXor:
+    case eAst::kXorAssign:
+      return eLirOp::kXor;
+    case eAst::kLsh:
+    case eAst::kLshAssign:
+      return eLirOp::kLsh;
+    case eAst::kRsh:
+    case eAst::kRshAssign:
+      return eLirOp::kRsh;
+    case eAst::kEq:
+      return eLirOp::kEq;
+    case eAst::kNeq:
+      return eLirOp::kNeq;
+    case eAst::kLt:
+      return eLirOp::kLt;
+    case eAst::kGt:
+      return eLirOp::kGt;
+    case eAst::kLte:
+      return eLirOp::kLte;
+    case eAst::kGte:
+      return eLirOp::kGte;
+    default:
+      return std::nullopt;
+  }
+}
+
+/// @brief Builds a LirModule holding every function defined at the top level of a kProgram, or at the top level of a
+/// process definition. The main of a process is a function named 'main' without parameters. Other top level
+/// statements are not part of any function and are ignored.
+class LirBuilder {
+ public:
+  static ClRes<LirModule> Build(const Ast& program);
+
+ private:
+  struct FunctionDecl {
+    SymbolId name;
+    Vec<SymbolId> params;
+    const Ast* body;
+  };
+
+  using VarId = UI32;
+
+  struct Local {
+    SymbolId name;
+    VarId var;
+  };
+
+  struct Value {
+    LirReg reg;
+    eLirType type;
+  };
+
+  struct IncompletePhi {
+    VarId var;
+    Size phi;  // Index in the phis of the block.
+  };
+
+  LirModule& module_;
+  LirFunction& fn_;
+  LirBlockId block_{0};
+  Vec<Local> locals_{};
+  Vec<Size> scopes_{};  // Count of locals when each open block began.
+  VarId var_count_{0};
+  Vec<FlatMap<VarId, LirReg>> current_defs_{};  // Per block.
+  Vec<char> sealed_{};
+  Vec<Vec<IncompletePhi>> incomplete_phis_{};
+
+  LirBuilder(LirModule& module, LirFunction& fn) : module_(module), fn_(fn) {}
+
+  static void CollectFunctions(const Ast& scope, Vec<FunctionDecl>& decls);
+  ClRes<void> BuildFunction(const FunctionDecl& decl);
+
+  LirBlockId NewBlock();
+  void SealBlock(LirBlockId block);
+  void WriteVariable(VarId var, LirBlockId block, LirReg value) { current_defs_[block][var] = value; }
+  LirReg ReadVariable(VarId var, LirBlockId block);
+  LirReg ReadVariableRecursive(VarId var, LirBlockId block);
+
+  void SkipTerminatedBlock();
+  LirReg Emit(eLirOp op, eLirType type, Vec<LirReg> args = {}, I64 imm = 0);
+  LirReg EmitConst(I64 value, eLirType type = eLirType::kI32) { return Emit(eLirOp::kConst, type, {}, value); }
+  void Jump(LirBlockId target);
+  void Branch(LirReg cond, LirBlockId if_true, LirBlockId if_false);
+  LirReg ToI32(Value value);
+  LirReg ToBool(Value value);
+
+  void OpenScope() { scopes_.push_back(locals_.size()); }
+  void CloseScope() {
+    locals_.resize(scopes_.back());
+    scopes_.pop_back();
+  }
+  Opt<VarId> FindLocal(SymbolId name) const;
+  ClRes<VarId> DeclareLocal(SymbolId name);
+  ClRes<VarId> ResolveTarget(const Ast& target, StrView action) const;
+
+  ClRes<void> BuildBlock(const Ast& block);
+  ClRes<void> BuildStmt(const Ast& stmt);
+  ClRes<void> BuildVariableDecl(const Ast& decl);
+  ClRes<void> BuildIf(const Ast& stmt);
+  ClRes<void> BuildLoop(const Ast* cond, const Ast& body, const Ast* inc);
+  ClRes<void> BuildFor(const Ast& stmt);
+  ClRes<Value> BuildExpr(const Ast& expr);
+  ClRes<Value> BuildLiteral(const Ast& lit);
+  ClRes<Value> BuildAssign(const Ast& expr);
+  ClRes<Value> BuildIncDec(const Ast& expr);
+  ClRes<Value> BuildCall(const Ast& expr);
+  ClRes<Value> BuildLogical(const Ast& expr);
+};
+
+inline ClRes<LirModule> LirBuilder::Build(const Ast& program) {
+  if (program.TypeIsnt(eAst::kProgram))
+    return ClFail(
+        MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(), "Root ast must be a program."));
+
+  // Declare every function first, so a function body may call functions defined after it.
+  Vec<FunctionDecl> decls{};
+  CollectFunctions(program, decls);
+  LirModule module{};
+  for (const FunctionDecl& decl : decls) {
+    if (module.FindFunction(decl.name))
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(), std::format("Function '{}' already exists.", Symbols().Name(decl.name))));
+    module.function_ids[decl.name] = static_cast<LirFnId>(module.functions.size());
+    module.functions.push_back(LirFunction{.name = Str{Symbols().Name(decl.name)},
+                                           .symbol = decl.name,
+                                           .param_count = static_cast<UI32>(decl.params.size())});
+  }
+
+  for (Size i = 0; i < decls.size(); i++) {
+    auto built = LirBuilder{module, module.functions[i]}.BuildFunction(decls[i]);
+    if (!built) return ClFail(built.Error());
+  }
+  return module;
+}
+
+// A process declaration is [<modifiers>, <ident>?, <process-definition>?], a main is [<signature>, <main-definition>].
+inline void LirBuilder::CollectFunctions(const Ast& scope, Vec<FunctionDecl>& decls) {
+  for (const Ast& stmt : scope.children) {
+    if (stmt.TypeIs(eAst::kMethodDeclaration) && stmt.children.size() > 3) {
+      decls.push_back(FunctionDecl{stmt.At(1).Symbol(), hir::GetMethodParameterNames(stmt), &stmt.At(3)});
+    } else if (stmt.TypeIs(eAst::kMainDeclaration)) {
+      decls.push_back(FunctionDecl{Symbols().Intern("main"), {}, &stmt.At(1)});
+    } else if (stmt.TypeIs(eAst::kProcessDeclaration) && stmt.children.back().TypeIs(eAst::kProcessDefinition)) {
+      CollectFunctions(stmt.children.back(), decls);
+    }
+  }
+}
+
+inline ClRes<void> LirBuilder::BuildFunction(const FunctionDecl& decl) {
+  block_ = NewBlock();
+  SealBlock(block_);  // Nothing jumps to the entry.
+  OpenScope();
+  for (Size i = 0; i < decl.params.size(); i++) {
+    auto var = DeclareLocal(decl.params[i]);
+    if (!var) return ClFail(var.Error());
+    WriteVariable(*var, block_, Emit(eLirOp::kParam, eLirType::kI32, {}, static_cast<I64>(i)));
+  }
+  auto body = BuildBlock(*decl.body);
+  if (!body) return body;
+  CloseScope();
+
+  // Falling off the end of a function returns 0.
+  if (!fn_.blocks[block_].IsTerminated()) Emit(eLirOp::kReturn, eLirType::kVoid, {EmitConst(0)});
+  LirRemoveUnreachable(fn_);
+  return ClRes<void>{};
+}
+
+inline LirBlockId LirBuilder::NewBlock() {
+  current_defs_.emplace_back();
+  sealed_.push_back(0);
+  incomplete_phis_.emplace_back();
+  return fn_.NewBlock();
+}
+
+inline void LirBuilder::SealBlock(LirBlockId block) {
+  for (const IncompletePhi& incomplete : incomplete_phis_[block]) {
+    for (Size p = 0; p < fn_.blocks[block].preds.size(); p++) {
+      const LirReg arg = ReadVariable(incomplete.var, fn_.blocks[block].preds[p]);
+      fn_.blocks[block].phis[incomplete.phi].args.push_back(arg);
+    }
+  }
+  incomplete_phis_[block].clear();
+  sealed_[block] = 1;
+}
+
+inline LirReg LirBuilder::ReadVariable(VarId var, LirBlockId block) {
+  auto found = current_defs_[block].find(var);
+  if (found != current_defs_[block].end()) return found->second;
+  return ReadVariableRecursive(var, block);
+}
+
+// A block without predecessors is unreachable, as the entry assigns every variable it reads. Reads there get a phi
+// without operands, which is removed with the block.
+inline LirReg LirBuilder::ReadVariableRecursive(VarId var, LirBlockId block) {
+  LirBlock& b = fn_.blocks[block];
+  if (sealed_[block] && b.preds.size() == 1) {
+    const LirReg value = ReadVariable(var, b.preds.front());
+    WriteVariable(var, block, value);
+    return value;
+  }
+
+  const LirReg phi = fn_.NewReg(eLirType::kI32);
+  b.phis.push_back(LirInst{.op = eLirOp::kPhi, .type = eLirType::kI32, .dst = phi});
+  const Size phi_index = b.phis.size() - 1;
+  WriteVariable(var, block, phi);  // Before reading the operands, to end cycles through loops.
+  if (!sealed_[block]) {
+    incomplete_phis_[block].push_back(IncompletePhi{var, phi_index});
+    return phi;
+  }
+  const Vec<LirBlockId> preds = b.preds;
+  for (LirBlockId pred : preds) {
+    const LirReg arg = ReadVariable(var, pred);
+    fn_.blocks[block].phis[phi_index].args.push_back(arg);
+  }
+  return phi;
+}
+
+// Code following a terminator is unreachable. It is built into a new block without predecessors.
+inline void LirBuilder::SkipTerminatedBlock() {
+  if (!fn_.blocks[block_].IsTerminated()) return;
+  block_ = NewBlock();
+  SealBlock(block_);
+}
+
+inline LirReg LirBuilder::Emit(eLirOp op, eLirType type, Vec<LirReg> args, I64 imm) {
+  SkipTerminatedBlock();
+  const LirReg dst = type == eLirType::kVoid ? kNoLirReg : fn_.NewReg(type);
+  fn_.blocks[block_].insts.push_back(LirInst{.op = op, .type = type, .dst = dst, .args = std::move(args), .imm = imm});
+  return dst;
+}
+
+inline void LirBuilder::Jump(LirBlockId target) {
+  if (fn_.blocks[block_].IsTerminated()) return;
+  LirInst& jump = fn_.blocks[block_].insts.emplace_back(LirInst{.op = eLirOp::kJump});
+  jump.targets[0] = target;
+  fn_.blocks[target].preds.push_back(block_);
+}
+
+inline void LirBuilder::Branch(LirReg cond, LirBlockId if_true, LirBlockId if_false) {
+  LirInst& branch = fn_.blocks[block_].insts.emplace_back(LirInst{.op = eLirOp::kBranch, .args = {cond}});
+  branch.targets = {if_true, if_false};
+  fn_.blocks[if_true].preds.push_back(block_);
+  fn_.blocks[if_false].preds.push_back(block_);
+}
+
+inline LirReg LirBuilder::ToI32(Value value) {
+  return value.type == eLirType::kI32 ? value.reg : Emit(eLirOp::kZext, eLirType::kI32, {value.reg});
+}
+
+// Integers are true when they are not zero.
+inline LirReg LirBuilder::ToBool(Value value) {
+  return value.type == eLirType::kBool ? value.reg : Emit(eLirOp::kNeq, eLirType::kBool, {value.reg, EmitConst(0)});
+}
+
+inline Opt<LirBuilder::VarId> LirBuilder::FindLocal(SymbolId name) const {
+  for (auto local = locals_.rbegin(); local != locals_.rend(); local++)
+    if (local->name == name) return local->var;
+  return std::nullopt;
+}
+
+inline ClRes<LirBuilder::VarId> LirBuilder::DeclareLocal(SymbolId name) {
+  const Size scope_begin = scopes_.empty() ? 0 : scopes_.back();
+  for (Size i = scope_begin; i < locals_.size(); i++)
+    if (locals_[i].name == name)
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(),
+          std::format("Variable '{}' already exists in this scope.", Symbols().Name(name))));
+  locals_.push_back(Local{name, var_count_});
+  return var_count_++;
+}
+
+inline ClRes<LirBuilder::VarId> LirBuilder::ResolveTarget(const Ast& target, StrView action) const {
+  if (target.TypeIsnt(eAst::kIdent))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            std::format("Only variables may be {}.", action)));
+  auto var = FindLocal(target.Symbol());
+  if (!var)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot resolve variable '{}'.", target.RawLiteral())));
+  return *var;
+}
+
+inline ClRes<void> LirBuilder::BuildBlock(const Ast& block) {
+  OpenScope();
+  for (const Ast& stmt : block.children) {
+    auto stmt_res = BuildStmt(stmt);
+    if (!stmt_res) return stmt_res;
+  }
+  CloseScope();
+  return ClRes<void>{};
+}
+
+inline ClRes<void> LirBuilder::BuildStmt(const Ast& stmt) {
+  SkipTerminatedBlock();
+  switch (stmt.type) {
+    case eAst::kVariableDeclaration:
+      return BuildVariableDecl(stmt);
+    case eAst::kKwReturn: {
+      LirReg value{};
+      if (stmt.children.empty()) {
+        value = EmitConst(0);
+      } else {
+        auto result = BuildExpr(stmt.At(0));
+        if (!result) return ClFail(result.Error());
+        value = ToI32(*result);
+      }
+      Emit(eLirOp::kReturn, eLirType::kVoid, {value});
+      return ClRes<void>{};
+    }
+    case eAst::kIfStatement:
+      return BuildIf(stmt);
+    case eAst::kKwWhile:
+      return BuildLoop(&stmt.At(0), stmt.At(1), nullptr);
+    case eAst::kKwFor:
+      return BuildFor(stmt);
+    case eAst::kMethodDeclaration:
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                              "Nested function definitions cannot be lowered."));
+    default: {
+      auto value = BuildExpr(stmt);
+      if (!value) return ClFail(value.Error());
+      return ClRes<void>{};
+    }
+  }
+}
+
+inline ClRes<void> LirBuilder::BuildVariableDecl(const Ast& decl) {
+  // The name is only visible after the initializer.
+  LirReg value{};
+  if (decl.children.size() > 3) {
+    auto init = BuildExpr(decl.At(3).At(0));
+    if (!init) return ClFail(init.Error());
+    value = ToI32(*init);
+  } else {
+    value = EmitConst(0);
+  }
+  auto var = DeclareLocal(decl.At(2).Symbol());
+  if (!var) return ClFail(var.Error());
+  WriteVariable(*var, block_, value);
+  return ClRes<void>{};
+}
+
+inline ClRes<void> LirBuilder::BuildIf(const Ast& stmt) {
+  const LirBlockId exit = NewBlock();
+  for (const Ast& clause : stmt.children) {
+    if (clause.TypeIs(eAst::kKwElse) || clause.TypeIs(eAst::kKwCxelse)) {
+      auto body = BuildBlock(clause.At(0));
+      if (!body) return body;
+      break;
+    }
+
+    auto cond = BuildExpr(clause.At(0));
+    if (!cond) return ClFail(cond.Error());
+    const LirReg cond_reg = ToBool(*cond);
+    const LirBlockId then_block = NewBlock();
+    const LirBlockId next_block = NewBlock();
+    Branch(cond_reg, then_block, next_block);
+    SealBlock(then_block);
+    SealBlock(next_block);
+
+    block_ = then_block;
+    auto body = BuildBlock(clause.At(1));
+    if (!body) return body;
+    Jump(exit);
+    block_ = next_block;
+  }
+  Jump(exit);
+  SealBlock(exit);
+  block_ = exit;
+  return ClRes<void>{};
+}
+
+// The condition is tested in a header block, which the end of the body jumps back to.
+inline ClRes<void> LirBuilder::BuildLoop(const Ast* cond, const Ast& body, const Ast* inc) {
+  const LirBlockId header = NewBlock();
+  Jump(header);
+  block_ = header;
+  auto cond_value = BuildExpr(*cond);
+  if (!cond_value) return ClFail(cond_value.Error());
+  const LirReg cond_reg = ToBool(*cond_value);
+  const LirBlockId body_block = NewBlock();
+  const LirBlockId exit = NewBlock();
+  Branch(cond_reg, body_block, exit);
+  SealBlock(body_block);
+  SealBlock(exit);
+
+  block_ = body_block;
+  auto body_res = BuildBlock(body);
+  if (!body_res) return body_res;
+  if (inc) {
+    auto inc_res = BuildStmt(*inc);
+    if (!inc_res) return inc_res;
+  }
+  Jump(header);
+  SealBlock(header);
+  block_ = exit;
+  return ClRes<void>{};
+}
+
+// Children are [<variable-decl>?, <condition>, <increment>?, <body>].
+inline ClRes<void> LirBuilder::BuildFor(const Ast& stmt) {
+  OpenScope();
+  Size next = 0;
+  if (stmt.At(0).TypeIs(eAst::kVariableDeclaration)) {
+    auto init = BuildVariableDecl(stmt.At(next++));
+    if (!init) return init;
+  }
+  const Ast& cond = stmt.At(next++);
+  const Ast* inc = stmt.children.size() - next == 2 ? &stmt.At(next) : nullptr;
+  auto loop = BuildLoop(&cond, stmt.children.back(), inc);
+  if (!loop) return loop;
+  CloseScope();
+  return ClRes<void>{};
+}
+
+inline ClRes<LirBuilder::Value> LirBuilder::BuildExpr(const Ast& expr) {
+  switch (expr.type) {
+    case eAst::kLitBool:
+    case eAst::kLitChar:
+    case eAst::kLitInt:
+      return BuildLiteral(expr);
+    case eAst::kIdent: {
+      auto var = ResolveTarget(expr, "read");
+      if (!var) return ClFail(var.Error());
+      return Value{ReadVariable(*var, block_), eLirType::kI32};
+    }
+    case eAst::kSubexpression:
+      return BuildExpr(expr.At(0));
+    case eAst::kFunctionCall:
+      return BuildCall(expr);
+    case eAst::kInc:
+    case eAst::kDec:
+      return BuildIncDec(expr);
+    case eAst::kAssign:
+      return BuildAssign(expr);
+    case eAst::kBand:
+    case eAst::kBor:
+      return BuildLogical(expr);
+    default:
+      break;
+  }
+  if (hir::IsAstCompoundAssignment(expr.type)) return BuildAssign(expr);
+
+  // Prefix operators.
+  if (expr.children.size() == 1 && (expr.TypeIs(eAst::kNot) || expr.TypeIs(eAst::kBnot) || expr.TypeIs(eAst::kSub) ||
+                                     expr.TypeIs(eAst::kAdd))) {
+    auto operand = BuildExpr(expr.At(0));
+    if (!operand) return operand;
+    if (expr.TypeIs(eAst::kAdd)) return operand;
+    if (expr.TypeIs(eAst::kNot)) return Value{Emit(eLirOp::kNot, eLirType::kBool, {ToBool(*operand)}), eLirType::kBool};
+    if (expr.TypeIs(eAst::kBnot))
+      return Value{Emit(eLirOp::kXor, eLirType::kI32, {ToI32(*operand), EmitConst(-1)}), eLirType::kI32};
+    return Value{Emit(eLirOp::kNeg, eLirType::kI32, {ToI32(*operand)}), eLirType::kI32};
+  }
+
+  auto binop = GetLirBinaryOp(expr.type);
+  if (binop && expr.children.size() == 2) {
+    auto lhs = BuildExpr(expr.At(0));
+    if (!lhs) return lhs;
+    const LirReg lhs_reg = ToI32(*lhs);
+    auto rhs = BuildExpr(expr.At(1));
+    if (!rhs) return rhs;
+    const LirReg rhs_reg = ToI32(*rhs);
+    const eLirType type = IsLirOpComparison(*binop) ? eLirType::kBool : eLirType::kI32;
+    return Value{Emit(*binop, type, {lhs_reg, rhs_reg}), type};
+  }
+
+  return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+      std::source_location::current(), std::format("Cannot lower '{}' expression to LIR.", eAstToCStr(expr.type))));
+}
+
+inline ClRes<LirBuilder::Value> LirBuilder::BuildLiteral(const Ast& lit) {
+  if (lit.TypeIs(eAst::kLitBool)) {
+    auto value = hir::Bool::FromLiteral(lit.RawLiteral());
+    if (!value) return ClFail(value.error());
+    return Value{EmitConst(value->data ? 1 : 0, eLirType::kBool), eLirType::kBool};
+  }
+  if (lit.TypeIs(eAst::kLitChar)) {
+    auto value = hir::I8::FromLiteral(lit.RawLiteral());
+    if (!value) return ClFail(value.error());
+    return Value{EmitConst(value->data), eLirType::kI32};
+  }
+  auto value = hir::I32::FromLiteral(lit.RawLiteral());
+  if (!value) return ClFail(value.error());
+  return Value{EmitConst(value->data), eLirType::kI32};
+}
+
+inline ClRes<LirBuilder::Value> LirBuilder::BuildAssign(const Ast& expr) {
+  auto var = ResolveTarget(expr.At(0), "assigned");
+  if (!var) return ClFail(var.Error());
+  auto rhs = BuildExpr(expr.At(1));
+  if (!rhs) return rhs;
+  LirReg value = ToI32(*rhs);
+  if (expr.TypeIsnt(eAst::kAssign))
+    value = Emit(*GetLirBinaryOp(expr.type), eLirType::kI32, {ReadVariable(*var, block_), value});
+  WriteVariable(*var, block_, value);
+  return Value{value, eLirType::kI32};
+}
+
+inline ClRes<LirBuilder::Value> LirBuilder::BuildIncDec(const Ast& expr) {
+  auto var = ResolveTarget(expr.At(0), "incremented");
+  if (!var) return ClFail(var.Error());
+  // A postfix operator begins at its operand, a prefix operator begins at its own token.
+  const bool is_postfix = expr.src_begin == expr.At(0).src_begin;
+  const LirReg old_value = ReadVariable(*var, block_);
+  const LirReg new_value =
+      Emit(expr.TypeIs(eAst::kInc) ? eLirOp::kAdd : eLirOp::kSub, eLirType::kI32, {old_value, EmitConst(1)});
+  WriteVariable(*var, block_, new_value);
+  return Value{is_postfix ? old_value : new_value, eLirType::kI32};
+}
+
+inline ClRes<LirBuilder::Value> LirBuilder::BuildCall(const Ast& expr) {
+  const Ast& callee = expr.At(0);
+  if (callee.TypeIsnt(eAst::kIdent))
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(std::source_location::current(),
+                                                            "Only named functions may be called."));
+  auto fn = module_.FindFunction(callee.Symbol());
+  if (!fn)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Cannot resolve function '{}'.", callee.RawLiteral())));
+
+  // Arguments are a single expression, with several arguments folded left by the comma operator.
+  Vec<const Ast*> args{};
+  if (!expr.At(1).children.empty()) {
+    const Ast* folded = &expr.At(1).At(0);
+    while (folded->TypeIs(eAst::kComma)) {
+      args.push_back(&folded->At(1));
+      folded = &folded->At(0);
+    }
+    args.push_back(folded);
+    std::reverse(args.begin(), args.end());
+  }
+  if (args.size() != module_.functions[*fn].param_count)
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(),
+        std::format("Function '{}' expects {} arguments but {} were provided.", callee.RawLiteral(),
+                    module_.functions[*fn].param_count, args.size())));
+
+  Vec<LirReg> arg_regs{};
+  for (const Ast* arg : args) {
+    auto value = BuildExpr(*arg);
+    if (!value) return value;
+    arg_regs.push_back(ToI32(*value));
+  }
+  return Value{Emit(eLirOp::kCall, eLirType::kI32, std::move(arg_regs), *fn), eLirType::kI32};
+}
+
+// The right operand is only evaluated when the left one does not decide the result. The exit block is entered from
+// the end of the left operand, with the deciding constant, or from the end of the right operand, with its value.
+inline ClRes<LirBuilder::Value> LirBuilder::BuildLogical(const Ast& expr) {
+  const bool is_and = expr.TypeIs(eAst::kBand);
+  auto lhs = BuildExpr(expr.At(0));
+  if (!lhs) return lhs;
+  const LirReg lhs_reg = ToBool(*lhs);
+  const LirReg decided = EmitConst(is_and ? 0 : 1, eLirType::kBool);
+  const LirBlockId rhs_block = NewBlock();
+  const LirBlockId exit = NewBlock();
+  if (is_and)
+    Branch(lhs_reg, rhs_block, exit);
+  else
+    Branch(lhs_reg, exit, rhs_block);
+  SealBlock(rhs_block);
+
+  block_ = rhs_block;
+  auto rhs = BuildExpr(expr.At(1));
+  if (!rhs) return rhs;
+  const LirReg rhs_reg = ToBool(*rhs);
+  Jump(exit);
+  SealBlock(exit);
+
+  block_ = exit;
+  const LirReg result = fn_.NewReg(eLirType::kBool);
+  fn_.blocks[exit].phis.push_back(LirInst{.op = eLirOp::kPhi, .type = eLirType::kBool, .dst = result,
+                                          .args = {decided, rhs_reg}});
+  return Value{result, eLirType::kBool};
+}
+
+}  // namespace cnd::lir
+
+/// @} // end of cnd_compiler
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
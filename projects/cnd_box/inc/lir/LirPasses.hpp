@@ -0,0 +1,482 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Optimization passes over the low level IR, and the pass manager running them.
+///
+/// Every pass returns the number of changes it made, so the pass manager can repeat its pipeline until nothing
+/// changes. Passes keep the function in SSA form, LirVerify holds before and after each of them.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "lir/Lir.hpp"
+#include <chrono>
+#include <functional>
+// clang-format on
+
+namespace cnd::lir {
+
+/// @brief Replace copies, and phis merging a single value, by their value.
+inline Size LirPropagateCopies(LirFunction& fn) {
+  Size changes = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    Vec<LirReg> replacement(fn.reg_types.size(), kNoLirReg);
+    LAMBDA xResolve = [&replacement](LirReg reg) {
+      while (replacement[reg] != kNoLirReg) reg = replacement[reg];
+      return reg;
+    };
+    for (LirBlock& block : fn.blocks) {
+      Size removed = std::erase_if(block.insts, [&](const LirInst& inst) {
+        if (inst.op != eLirOp::kCopy) return false;
+        replacement[inst.dst] = xResolve(inst.args[0]);
+        return true;
+      });
+      // A phi is trivial if its operands are one value, or the phi itself.
+      removed += std::erase_if(block.phis, [&](const LirInst& phi) {
+        LirReg value = kNoLirReg;
+        for (LirReg arg : phi.args) {
+          arg = xResolve(arg);
+          if (arg == phi.dst || arg == value) continue;
+          if (value != kNoLirReg) return false;
+          value = arg;
+        }
+        if (value == kNoLirReg) return false;
+        replacement[phi.dst] = value;
+        return true;
+      });
+      changed |= removed > 0;
+      changes += removed;
+    }
+    if (changed) LirReplaceUses(fn, replacement);
+  }
+  return changes;
+}
+
+/// @brief Compute operations on constants, merge phis of one constant, and resolve branches on a constant.
+inline Size LirPropagateConstants(LirFunction& fn) {
+  Size changes = 0;
+  Vec<Opt<I64>> values(fn.reg_types.size());
+  LAMBDA xValueOf = [&values](LirReg reg) { return reg < values.size() ? values[reg] : Opt<I64>{}; };
+
+  // Blocks are visited in reverse postorder, so operands are seen before their uses except through loops.
+  for (LirBlockId b : LirReversePostorder(fn)) {
+    LirBlock& block = fn.blocks[b];
+    Vec<LirInst> const_phis{};
+    std::erase_if(block.phis, [&](const LirInst& phi) {
+      if (phi.args.empty() || !xValueOf(phi.args.front())) return false;
+      for (LirReg arg : phi.args)
+        if (xValueOf(arg) != xValueOf(phi.args.front())) return false;
+      const_phis.push_back(LirInst{.op = eLirOp::kConst, .type = phi.type, .dst = phi.dst,
+                                   .imm = *xValueOf(phi.args.front())});
+      return true;
+    });
+    block.insts.insert(block.insts.begin(), const_phis.begin(), const_phis.end());
+    changes += const_phis.size();
+
+    for (LirInst& inst : block.insts) {
+      if (inst.op == eLirOp::kConst) {
+        values[inst.dst] = inst.imm;
+        continue;
+      }
+      if (inst.op == eLirOp::kCopy && xValueOf(inst.args[0])) {
+        values[inst.dst] = xValueOf(inst.args[0]);
+        continue;
+      }
+      if (inst.op == eLirOp::kBranch && xValueOf(inst.args[0])) {
+        const bool is_taken = *xValueOf(inst.args[0]) != 0;
+        const LirBlockId target = inst.targets[is_taken ? 0 : 1];
+        const LirBlockId skipped = inst.targets[is_taken ? 1 : 0];
+        inst = LirInst{.op = eLirOp::kJump};
+        inst.targets[0] = target;
+        if (skipped != target) LirRemoveEdge(fn, b, skipped);
+        changes++;
+        continue;
+      }
+      if (!IsLirOpBinary(inst.op) && !IsLirOpUnary(inst.op)) continue;
+      const Opt<I64> lhs = xValueOf(inst.args[0]);
+      const Opt<I64> rhs = inst.args.size() > 1 ? xValueOf(inst.args[1]) : Opt<I64>{0};
+      if (!lhs || !rhs) continue;
+      const Opt<I64> result = LirEvalOp(inst.op, *lhs, *rhs);
+      if (!result) continue;  // Traps are left to happen at run time.
+      inst = LirInst{.op = eLirOp::kConst, .type = inst.type, .dst = inst.dst, .imm = *result};
+      values[inst.dst] = *result;
+      changes++;
+    }
+  }
+  LirRemoveUnreachable(fn);
+  return changes;
+}
+
+/// @brief Merge a block into its only predecessor, when that predecessor always jumps to it.
+inline Size LirMergeBlocks(LirFunction& fn) {
+  Size changes = 0;
+  Vec<LirReg> replacement(fn.reg_types.size(), kNoLirReg);
+  for (LirBlockId b = 1; b < fn.blocks.size(); b++) {
+    LirBlock& block = fn.blocks[b];
+    if (block.preds.size() != 1 || block.preds.front() == b) continue;
+    const LirBlockId pred_id = block.preds.front();
+    LirBlock& pred = fn.blocks[pred_id];
+    if (pred.insts.back().op != eLirOp::kJump) continue;
+
+    for (const LirInst& phi : block.phis) replacement[phi.dst] = phi.args.front();
+    pred.insts.pop_back();
+    pred.insts.insert(pred.insts.end(), std::make_move_iterator(block.insts.begin()),
+                      std::make_move_iterator(block.insts.end()));
+    for (LirBlockId succ : pred.Succs()) std::ranges::replace(fn.blocks[succ].preds, b, pred_id);
+    block = LirBlock{};  // Nothing jumps to it anymore.
+    changes++;
+  }
+  if (changes > 0) {
+    LirReplaceUses(fn, replacement);
+    LirRemoveUnreachable(fn);
+  }
+  return changes;
+}
+
+// Value numbering key of a pure instruction.
+struct LirValueKey {
+  eLirOp op{};
+  eLirType type{};
+  I64 imm{0};
+  std::array<LirReg, 2> args{kNoLirReg, kNoLirReg};
+
+  bool operator==(const LirValueKey&) const = default;
+};
+
+struct LirValueKeyHash {
+  Size operator()(const LirValueKey& key) const noexcept {
+    UI64 h = (static_cast<UI64>(key.op) << 8) | static_cast<UI64>(key.type);
+    for (UI64 part : {static_cast<UI64>(key.imm), static_cast<UI64>(key.args[0]), static_cast<UI64>(key.args[1])})
+      h = (h ^ (part * 0x9E3779B97F4A7C15ull)) * 0xFF51AFD7ED558CCDull;
+    return static_cast<Size>(h ^ (h >> 32));
+  }
+};
+
+/// @brief Replace an instruction by an identical one which dominates it. Constants, parameters, and binary and unary
+/// operations are compared, calls are not.
+inline Size LirEliminateCommonSubexpressions(LirFunction& fn) {
+  const Vec<LirBlockId> idom = LirDominators(fn);
+  Vec<Vec<LirBlockId>> dom_children(fn.blocks.size());
+  for (LirBlockId b = 1; b < fn.blocks.size(); b++)
+    if (idom[b] != kNoLirBlock && idom[b] != b) dom_children[idom[b]].push_back(b);
+
+  Size changes = 0;
+  Vec<LirReg> replacement(fn.reg_types.size(), kNoLirReg);
+  FlatMap<LirValueKey, LirReg, LirValueKeyHash> available{};
+  Vec<LirValueKey> scope_keys{};  // Keys added by the blocks on the path from the entry, in order.
+
+  // Walks the dominator tree depth first, an expression is available in the blocks its block dominates.
+  struct Visit {
+    LirBlockId block;
+    Size next_child;
+    Size scope_begin;
+  };
+  Vec<Visit> stack{{0, 0, 0}};
+  bool is_entered = false;
+  while (!stack.empty()) {
+    Visit& visit = stack.back();
+    if (!is_entered) {
+      std::erase_if(fn.blocks[visit.block].insts, [&](LirInst& inst) {
+        for (LirReg& arg : inst.args)
+          if (replacement[arg] != kNoLirReg) arg = replacement[arg];
+        const bool is_pure = inst.op == eLirOp::kConst || inst.op == eLirOp::kParam || IsLirOpBinary(inst.op) ||
+                             IsLirOpUnary(inst.op);
+        if (!is_pure) return false;
+        LirValueKey key{.op = inst.op, .type = inst.type, .imm = inst.imm};
+        std::copy(inst.args.begin(), inst.args.end(), key.args.begin());
+        if (IsLirOpCommutative(inst.op) && key.args[1] < key.args[0]) std::swap(key.args[0], key.args[1]);
+        auto [found, is_new] = available.try_emplace(key, inst.dst);
+        if (is_new) {
+          scope_keys.push_back(key);
+          return false;
+        }
+        replacement[inst.dst] = found->second;
+        changes++;
+        return true;
+      });
+    }
+    if (visit.next_child < dom_children[visit.block].size()) {
+      const LirBlockId child = dom_children[visit.block][visit.next_child++];
+      stack.push_back(Visit{child, 0, scope_keys.size()});
+      is_entered = false;
+      continue;
+    }
+    for (Size i = visit.scope_begin; i < scope_keys.size(); i++) available.erase(scope_keys[i]);
+    scope_keys.resize(visit.scope_begin);
+    stack.pop_back();
+    is_entered = true;
+  }
+  if (changes > 0) LirReplaceUses(fn, replacement);
+  return changes;
+}
+
+/// @brief Remove instructions and phis whose results are never used. Calls, and divisions which may trap, are kept.
+inline Size LirEliminateDeadCode(LirFunction& fn) {
+  Vec<const LirInst*> defs(fn.reg_types.size(), nullptr);
+  for (const LirBlock& block : fn.blocks) {
+    for (const LirInst& phi : block.phis) defs[phi.dst] = &phi;
+    for (const LirInst& inst : block.insts)
+      if (inst.dst != kNoLirReg) defs[inst.dst] = &inst;
+  }
+  LAMBDA xHasEffect = [&defs](const LirInst& inst) {
+    if (IsLirOpTerminator(inst.op) || inst.op == eLirOp::kCall) return true;
+    if (inst.op != eLirOp::kDiv && inst.op != eLirOp::kMod) return false;
+    const LirInst* divisor = defs[inst.args[1]];
+    return divisor == nullptr || divisor->op != eLirOp::kConst || divisor->imm == 0;
+  };
+
+  Vec<char> is_live(fn.reg_types.size(), 0);
+  Vec<const LirInst*> worklist{};
+  for (const LirBlock& block : fn.blocks)
+    for (const LirInst& inst : block.insts)
+      if (xHasEffect(inst)) {
+        if (inst.dst != kNoLirReg) is_live[inst.dst] = 1;
+        worklist.push_back(&inst);
+      }
+  while (!worklist.empty()) {
+    const LirInst* inst = worklist.back();
+    worklist.pop_back();
+    for (LirReg arg : inst->args) {
+      if (is_live[arg] || defs[arg] == nullptr) continue;
+      is_live[arg] = 1;
+      worklist.push_back(defs[arg]);
+    }
+  }
+
+  // Results of instructions with an effect were marked live above. 'defs' is not used from here on, erasing moves
+  // the instructions it points to.
+  Size changes = 0;
+  for (LirBlock& block : fn.blocks) {
+    changes += std::erase_if(block.phis, [&](const LirInst& phi) { return !is_live[phi.dst]; });
+    changes +=
+        std::erase_if(block.insts, [&](const LirInst& inst) { return inst.dst != kNoLirReg && !is_live[inst.dst]; });
+  }
+  return changes;
+}
+
+/// @brief Replace calls to small functions by a copy of the function's body. Functions which call themselves are
+/// not inlined, nor are calls in a caller which has grown past 'max_caller_insts'.
+inline Size LirInlineCalls(LirModule& module, Size max_callee_insts = 32, Size max_caller_insts = 4096) {
+  Vec<char> is_inlinable(module.functions.size(), 0);
+  for (LirFnId id = 0; id < module.functions.size(); id++) {
+    const LirFunction& fn = module.functions[id];
+    if (fn.blocks.empty() || fn.InstCount() > max_callee_insts) continue;
+    is_inlinable[id] = std::ranges::none_of(fn.blocks, [id](const LirBlock& block) {
+      return std::ranges::any_of(block.insts, [id](const LirInst& inst) {
+        return inst.op == eLirOp::kCall && inst.imm == static_cast<I64>(id);
+      });
+    });
+  }
+
+  Size changes = 0;
+  for (LirFnId caller_id = 0; caller_id < module.functions.size(); caller_id++) {
+    LirFunction& caller = module.functions[caller_id];
+    for (LirBlockId b = 0; b < caller.blocks.size(); b++) {
+      for (Size i = 0; i < caller.blocks[b].insts.size(); i++) {
+        const LirInst call = caller.blocks[b].insts[i];
+        if (call.op != eLirOp::kCall || call.imm == static_cast<I64>(caller_id)) continue;
+        if (!is_inlinable[call.imm] || caller.InstCount() > max_caller_insts) continue;
+        const LirFunction& callee = module.functions[call.imm];
+
+        // Instructions after the call continue in a new block, which the callee's returns jump to.
+        const LirBlockId cont = caller.NewBlock();
+        caller.blocks[cont].insts.assign(std::make_move_iterator(caller.blocks[b].insts.begin() + i + 1),
+                                         std::make_move_iterator(caller.blocks[b].insts.end()));
+        caller.blocks[b].insts.resize(i);
+        for (LirBlockId succ : caller.blocks[cont].Succs())
+          std::ranges::replace(caller.blocks[succ].preds, b, cont);
+
+        Vec<LirReg> regs{};
+        regs.reserve(callee.reg_types.size());
+        for (eLirType type : callee.reg_types) regs.push_back(caller.NewReg(type));
+        const auto first_block = static_cast<LirBlockId>(caller.blocks.size());
+        for (Size cb = 0; cb < callee.blocks.size(); cb++) caller.NewBlock();
+
+        Vec<LirReg> results{};
+        for (LirBlockId cb = 0; cb < callee.blocks.size(); cb++) {
+          const LirBlock& from = callee.blocks[cb];
+          LirBlock& to = caller.blocks[first_block + cb];
+          for (LirBlockId pred : from.preds) to.preds.push_back(first_block + pred);
+          LAMBDA xClone = [&](LirInst inst) {
+            if (inst.dst != kNoLirReg) inst.dst = regs[inst.dst];
+            for (LirReg& arg : inst.args) arg = regs[arg];
+            for (LirBlockId& target : inst.targets)
+              if (target != kNoLirBlock) target = first_block + target;
+            return inst;
+          };
+          for (const LirInst& phi : from.phis) to.phis.push_back(xClone(phi));
+          for (const LirInst& inst : from.insts) {
+            LirInst cloned = xClone(inst);
+            if (inst.op == eLirOp::kParam) {
+              cloned.op = eLirOp::kCopy;
+              cloned.args = {call.args[static_cast<Size>(inst.imm)]};
+            } else if (inst.op == eLirOp::kReturn) {
+              results.push_back(cloned.args[0]);
+              cloned = LirInst{.op = eLirOp::kJump};
+              cloned.targets[0] = cont;
+              caller.blocks[cont].preds.push_back(first_block + cb);
+            }
+            to.insts.push_back(std::move(cloned));
+          }
+        }
+
+        LirInst& jump = caller.blocks[b].insts.emplace_back(LirInst{.op = eLirOp::kJump});
+        jump.targets[0] = first_block;
+        caller.blocks[first_block].preds.push_back(b);
+
+        // The call's result is merged from the returns. A callee which never returns leaves it undefined.
+        LirBlock& cont_block = caller.blocks[cont];
+        if (results.empty())
+          cont_block.insts.insert(cont_block.insts.begin(), LirInst{.op = eLirOp::kConst, .type = call.type,
+                                                                    .dst = call.dst});
+        else if (results.size() == 1)
+          cont_block.insts.insert(cont_block.insts.begin(), LirInst{.op = eLirOp::kCopy, .type = call.type,
+                                                                    .dst = call.dst, .args = results});
+        else
+          cont_block.phis.push_back(LirInst{.op = eLirOp::kPhi, .type = call.type, .dst = call.dst,
+                                            .args = std::move(results)});
+        changes++;
+        break;  // The rest of this block moved to 'cont', which is visited later.
+      }
+    }
+    LirRemoveUnreachable(caller);
+  }
+  return changes;
+}
+
+/// @brief Time spent in a pass, over every run of it.
+struct LirPassTiming {
+  Str name{};
+  Size runs{0};
+  Size changes{0};
+  std::chrono::nanoseconds time{0};
+
+  double Milliseconds() const noexcept { return std::chrono::duration<double, std::milli>(time).count(); }
+};
+
+/// @brief Runs a pipeline of passes over a module, repeating it until a round changes nothing.
+class LirPassManager {
+ public:
+  using PassFn = std::function<Size(LirModule&)>;
+
+  /// @brief Add a pass over the whole module.
+  LirPassManager& Add(StrView name, PassFn pass);
+
+  /// @brief Add a pass which is applied to every function of the module.
+  LirPassManager& AddFunctionPass(StrView name, Size (*pass)(LirFunction&));
+
+  /// @brief Inlining, copy and constant propagation, block merging, then common subexpression and dead code
+  /// elimination.
+  static LirPassManager MakeDefault();
+
+  /// @brief Run the pipeline at most 'max_rounds' times. With 'is_verified', every function is checked after every
+  /// pass, and the first invalid one is reported.
+  ClRes<void> Run(LirModule& module, Size max_rounds = 8, bool is_verified = false);
+
+  const Vec<LirPassTiming>& Timings() const noexcept { return timings_; }
+  Size Rounds() const noexcept { return rounds_; }
+
+  /// @brief Table of the passes, with their runs, changes and total time.
+  Str FormatTimings() const;
+
+ private:
+  Vec<PassFn> passes_{};
+  Vec<LirPassTiming> timings_{};
+  Size rounds_{0};
+};
+
+inline LirPassManager& LirPassManager::Add(StrView name, PassFn pass) {
+  passes_.push_back(std::move(pass));
+  timings_.push_back(LirPassTiming{.name = Str{name}});
+  return *this;
+}
+
+inline LirPassManager& LirPassManager::AddFunctionPass(StrView name, Size (*pass)(LirFunction&)) {
+  return Add(name, [pass](LirModule& module) {
+    Size changes = 0;
+    for (LirFunction& fn : module.functions) changes += pass(fn);
+    return changes;
+  });
+}
+
+inline LirPassManager LirPassManager::MakeDefault() {
+  LirPassManager manager{};
+  manager.Add("inline", [](LirModule& module) { return LirInlineCalls(module); })
+      .AddFunctionPass("copy-prop", LirPropagateCopies)
+      .AddFunctionPass("const-prop", LirPropagateConstants)
+      .AddFunctionPass("merge-blocks", LirMergeBlocks)
+      .AddFunctionPass("cse", LirEliminateCommonSubexpressions)
+      .AddFunctionPass("dce", LirEliminateDeadCode);
+  return manager;
+}
+
+inline ClRes<void> LirPassManager::Run(LirModule& module, Size max_rounds, bool is_verified) {
+  for (Size round = 0; round < max_rounds; round++) {
+    rounds_++;
+    Size round_changes = 0;
+    for (Size i = 0; i < passes_.size(); i++) {
+      const auto start = std::chrono::steady_clock::now();
+      const Size changes = passes_[i](module);
+      timings_[i].time += std::chrono::steady_clock::now() - start;
+      timings_[i].runs++;
+      timings_[i].changes += changes;
+      round_changes += changes;
+      if (!is_verified) continue;
+      for (const LirFunction& fn : module.functions) {
+        auto valid = LirVerify(fn);
+        if (!valid)
+          return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+              std::source_location::current(), std::format("After pass '{}': {}", timings_[i].name,
+                                                            valid.Error().Format())));
+      }
+    }
+    if (round_changes == 0) break;
+  }
+  return ClRes<void>{};
+}
+
+inline Str LirPassManager::FormatTimings() const {
+  Str out = std::format("{:<14} {:>6} {:>8} {:>10}\n", "pass", "runs", "changes", "ms");
+  for (const LirPassTiming& timing : timings_)
+    out += std::format("{:<14} {:>6} {:>8} {:>10.3f}\n", timing.name, timing.runs, timing.changes,
+                       timing.Milliseconds());
+  return out;
+}
+
+}  // namespace cnd::lir
+
+/// @} // end of cnd_compiler
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Writer of ELF64 relocatable object files for x86-64.
+///
+/// An object holds a single text section, the function symbols defined in it and the relocations of the calls between
+/// them. Its sections are .text, .rela.text, .symtab, .strtab, .shstrtab and an empty .note.GNU-stack, which marks the
+/// stack as not executable. Fields are written little endian, whatever the host.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+// clang-format on
+
+namespace cnd::x64 {
+
+/// @brief A global function symbol defined at 'offset' in the text section.
+struct ElfSymbol {
+  Str name{};
+  UI64 offset{0};
+  UI64 size{0};
+};
+
+/// @brief Relocation at 'offset' in the text section, referring to 'symbols[symbol]' of the object.
+struct ElfRelocation {
+  UI64 offset{0};
+  UI32 symbol{0};
+  UI32 type{0};
+  I64 addend{0};
+};
+
+struct ElfObject {
+  static constexpr UI32 kRelocPc32 = 2;    ///> R_X86_64_PC32, S + A - P.
+  static constexpr UI32 kRelocPlt32 = 4;   ///> R_X86_64_PLT32, L + A - P. Same as PC32 for symbols defined here.
+  static constexpr UI16 kTextSection = 1;  ///> Section index of .text.
+  /// @brief Symbol table index of 'symbols[0]'. The null symbol and the section symbol of .text come first.
+  static constexpr UI32 kFirstSymbol = 2;
+
+  Vec<UI8> text{};
+  Vec<ElfSymbol> symbols{};
+  Vec<ElfRelocation> relocations{};
+
+  Opt<Size> FindSymbol(StrView name) const {
+    for (Size i = 0; i < symbols.size(); i++)
+      if (symbols[i].name == name) return i;
+    return std::nullopt;
+  }
+
+  /// @brief The object file.
+  Vec<UI8> Serialize() const;
+};
+
+namespace detail {
+inline void PutElf(Vec<UI8>& out, UI64 value, Size bytes) {
+  for (Size i = 0; i < bytes; i++) out.push_back(static_cast<UI8>(value >> (8 * i)));
+}
+
+inline void AlignElf(Vec<UI8>& out, Size alignment) {
+  out.resize((out.size() + alignment - 1) / alignment * alignment);
+}
+
+// Appends 'name' to a string table, returning its offset.
+inline UI32 AddElfString(Vec<UI8>& table, StrView name) {
+  const auto offset = static_cast<UI32>(table.size());
+  table.insert(table.end(), name.begin(), name.end());
+  table.push_back(0);
+  return offset;
+}
+}  // namespace detail
+
+inline Vec<UI8> ElfObject::Serialize() const {
+  using detail::PutElf;
+  enum : UI32 { kProgbits = 1, kSymtab = 2, kStrtab = 3, kRela = 4 };
+  enum : UI64 { kAlloc = 0x2, kExecInstr = 0x4, kInfoLink = 0x40 };
+  constexpr Size kHeaderSize = 64;
+  constexpr Size kSectionHeaderSize = 64;
+  constexpr Size kSymbolSize = 24;
+  constexpr Size kRelaSize = 24;
+
+  Vec<UI8> strtab{0};
+  Vec<UI8> symtab(2 * kSymbolSize, 0);
+  symtab[kSymbolSize + 4] = 3;  // STB_LOCAL, STT_SECTION.
+  symtab[kSymbolSize + 6] = kTextSection;
+  for (const ElfSymbol& symbol : symbols) {
+    PutElf(symtab, detail::AddElfString(strtab, symbol.name), 4);
+    PutElf(symtab, 0x12, 1);  // STB_GLOBAL, STT_FUNC.
+    PutElf(symtab, 0, 1);
+    PutElf(symtab, kTextSection, 2);
+    PutElf(symtab, symbol.offset, 8);
+    PutElf(symtab, symbol.size, 8);
+  }
+  Vec<UI8> rela{};
+  for (const ElfRelocation& reloc : relocations) {
+    PutElf(rela, reloc.offset, 8);
+    PutElf(rela, static_cast<UI64>(kFirstSymbol + reloc.symbol) << 32 | reloc.type, 8);
+    PutElf(rela, static_cast<UI64>(reloc.addend), 8);
+  }
+  Vec<UI8> shstrtab{0};
+
+  struct Section {
+    UI32 name;
+    UI32 type;
+    UI64 flags;
+    const Vec<UI8>* data;
+    UI32 link;
+    UI32 info;
+    UI64 align;
+    UI64 entsize;
+    UI64 offset;
+  };
+  // Every name is added before .shstrtab is laid out.
+  Section sections[] = {
+      {detail::AddElfString(shstrtab, ".text"), kProgbits, kAlloc | kExecInstr, &text, 0, 0, 16, 0, 0},
+      {detail::AddElfString(shstrtab, ".rela.text"), kRela, kInfoLink, &rela, 3, kTextSection, 8, kRelaSize, 0},
+      {detail::AddElfString(shstrtab, ".symtab"), kSymtab, 0, &symtab, 4, kFirstSymbol, 8, kSymbolSize, 0},
+      {detail::AddElfString(shstrtab, ".strtab"), kStrtab, 0, &strtab, 0, 0, 1, 0, 0},
+      {detail::AddElfString(shstrtab, ".shstrtab"), kStrtab, 0, &shstrtab, 0, 0, 1, 0, 0},
+      {detail::AddElfString(shstrtab, ".note.GNU-stack"), kProgbits, 0, nullptr, 0, 0, 1, 0, 0},
+  };
+  constexpr UI16 kShstrtabSection = 5;
+  constexpr auto kSectionCount = static_cast<UI16>(std::size(sections) + 1);
+
+  Vec<UI8> out(kHeaderSize, 0);
+  for (Section& section : sections) {
+    detail::AlignElf(out, section.align);
+    section.offset = out.size();
+    if (section.data) out.insert(out.end(), section.data->begin(), section.data->end());
+  }
+  detail::AlignElf(out, 8);
+  const UI64 section_headers = out.size();
+  out.resize(out.size() + kSectionHeaderSize, 0);  // The null section.
+  for (const Section& section : sections) {
+    PutElf(out, section.name, 4);
+    PutElf(out, section.type, 4);
+    PutElf(out, section.flags, 8);
+    PutElf(out, 0, 8);
+    PutElf(out, section.offset, 8);
+    PutElf(out, section.data ? section.data->size() : 0, 8);
+    PutElf(out, section.link, 4);
+    PutElf(out, section.info, 4);
+    PutElf(out, section.align, 8);
+    PutElf(out, section.entsize, 8);
+  }
+
+  Vec<UI8> header{0x7F, 'E', 'L', 'F', 2, 1, 1, 0};  // 64 bit, little endian, version 1, System V.
+  header.resize(16, 0);
+  PutElf(header, 1, 2);   // ET_REL.
+  PutElf(header, 62, 2);  // EM_X86_64.
+  PutElf(header, 1, 4);
+  PutElf(header, 0, 8);  // No entry.
+  PutElf(header, 0, 8);  // No program headers.
+  PutElf(header, section_headers, 8);
+  PutElf(header, 0, 4);
+  PutElf(header, kHeaderSize, 2);
+  PutElf(header, 0, 2);
+  PutElf(header, 0, 2);
+  PutElf(header, kSectionHeaderSize, 2);
+  PutElf(header, kSectionCount, 2);
+  PutElf(header, kShstrtabSection, 2);
+  std::copy(header.begin(), header.end(), out.begin());
+  return out;
+}
+
+}  // namespace cnd::x64
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Encoder of the x86-64 instructions used by the native backend.
+///
+/// Only the forms the backend selects are encoded. Arithmetic is on 32 bit registers, the stack and frame pointers are
+/// adjusted with 64 bit forms. Memory operands are a base register and a displacement. Jumps go to labels, backward
+/// jumps in range of a byte take the short form. Calls are left to the linker, with a relocation of their target.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+// clang-format on
+
+namespace cnd::x64 {
+
+enum class eX64Reg : UI8 {
+  kRax,
+  kRcx,
+  kRdx,
+  kRbx,
+  kRsp,
+  kRbp,
+  kRsi,
+  kRdi,
+  kR8,
+  kR9,
+  kR10,
+  kR11,
+  kR12,
+  kR13,
+  kR14,
+  kR15
+};
+
+/// @brief Condition codes of jcc and setcc. Flipping the low bit negates a condition.
+enum class eX64Cond : UI8 { kE = 0x4, kNe = 0x5, kL = 0xC, kGe = 0xD, kLe = 0xE, kG = 0xF };
+
+/// @brief Operations of the arithmetic group, by their opcode extension.
+enum class eX64Alu : UI8 { kAdd = 0, kOr = 1, kAnd = 4, kSub = 5, kXor = 6, kCmp = 7 };
+
+enum class eX64Shift : UI8 { kShl = 4, kSar = 7 };
+
+constexpr eX64Cond NegateX64Cond(eX64Cond cond) noexcept { return static_cast<eX64Cond>(static_cast<UI8>(cond) ^ 1); }
+
+struct X64Mem {
+  eX64Reg base{eX64Reg::kRbp};
+  I32 disp{0};
+};
+
+using X64Label = UI32;
+
+/// @brief A call to be resolved by the linker. 'offset' is the offset of its 32 bit displacement in the code.
+struct X64Reloc {
+  UI32 offset{0};
+  UI32 symbol{0};
+  I64 addend{0};
+};
+
+class X64Assembler {
+ public:
+  const Vec<UI8>& Code() const noexcept { return code_; }
+  const Vec<X64Reloc>& Relocs() const noexcept { return relocs_; }
+  Size Offset() const noexcept { return code_.size(); }
+
+  /// @brief Pad with int3 until the offset is a multiple of 'alignment'.
+  void Align(Size alignment) {
+    while (code_.size() % alignment != 0) Byte(0xCC);
+  }
+
+  X64Label NewLabel() {
+    labels_.emplace_back();
+    return static_cast<X64Label>(labels_.size() - 1);
+  }
+  void Bind(X64Label label);
+  /// @brief True if every label which was jumped to is bound.
+  bool IsComplete() const noexcept;
+
+  void AluRR(eX64Alu op, eX64Reg dst, eX64Reg src) { Op(false, Id(src), Id(dst), {Alu(op, 0x01)}); }
+  void AluRM(eX64Alu op, eX64Reg dst, X64Mem src) { OpMem(false, Id(dst), {Alu(op, 0x03)}, src); }
+  void AluMR(eX64Alu op, X64Mem dst, eX64Reg src) { OpMem(false, Id(src), {Alu(op, 0x01)}, dst); }
+  void AluRI(eX64Alu op, eX64Reg dst, I32 imm);
+  void AluMI(eX64Alu op, X64Mem dst, I32 imm);
+
+  void MovRR(eX64Reg dst, eX64Reg src) {
+    if (dst != src) Op(false, Id(src), Id(dst), {0x89});
+  }
+  void MovRI(eX64Reg dst, I32 imm);
+  void MovRM(eX64Reg dst, X64Mem src) { OpMem(false, Id(dst), {0x8B}, src); }
+  void MovMR(X64Mem dst, eX64Reg src) { OpMem(false, Id(src), {0x89}, dst); }
+  void MovMI(X64Mem dst, I32 imm) {
+    OpMem(false, 0, {0xC7}, dst);
+    Imm32(imm);
+  }
+
+  void ImulRR(eX64Reg dst, eX64Reg src) { Op(false, Id(dst), Id(src), {0x0F, 0xAF}); }
+  void ImulRM(eX64Reg dst, X64Mem src) { OpMem(false, Id(dst), {0x0F, 0xAF}, src); }
+  void ImulRRI(eX64Reg dst, eX64Reg src, I32 imm);
+
+  void Cdq() { Byte(0x99); }
+  void Idiv(eX64Reg divisor) { Op(false, 7, Id(divisor), {0xF7}); }
+  void Neg(eX64Reg reg) { Op(false, 3, Id(reg), {0xF7}); }
+  void ShiftCl(eX64Shift shift, eX64Reg reg) { Op(false, static_cast<UI8>(shift), Id(reg), {0xD3}); }
+  void ShiftI(eX64Shift shift, eX64Reg reg, UI8 count) {
+    Op(false, static_cast<UI8>(shift), Id(reg), {0xC1});
+    Byte(count);
+  }
+  void TestRR(eX64Reg lhs, eX64Reg rhs) { Op(false, Id(rhs), Id(lhs), {0x85}); }
+  /// @brief Set the low byte of 'reg' to the condition.
+  void Setcc(eX64Cond cond, eX64Reg reg) {
+    Op(false, 0, Id(reg), {0x0F, static_cast<UI8>(0x90 | Cc(cond))}, IsByteRexReg(reg));
+  }
+  /// @brief Zero extend the low byte of 'src' into 'dst'.
+  void Movzx8(eX64Reg dst, eX64Reg src) { Op(false, Id(dst), Id(src), {0x0F, 0xB6}, IsByteRexReg(src)); }
+
+  void Jmp(X64Label target) { Jump(0xEB, {0xE9}, target); }
+  void Jcc(eX64Cond cond, X64Label target) {
+    Jump(static_cast<UI8>(0x70 | Cc(cond)), {0x0F, static_cast<UI8>(0x80 | Cc(cond))}, target);
+  }
+  /// @brief Call symbol 'symbol', through a relocation.
+  void Call(UI32 symbol);
+  void Ret() { Byte(0xC3); }
+  void Leave() { Byte(0xC9); }
+
+  void Push(eX64Reg reg) { RexOnly(false, 0, Id(reg), 0x50 | (Id(reg) & 7)); }
+  void Pop(eX64Reg reg) { RexOnly(false, 0, Id(reg), 0x58 | (Id(reg) & 7)); }
+  void PushI(I32 imm);
+  void PushM(X64Mem src) { OpMem(false, 6, {0xFF}, src); }
+  void AddRsp(I32 imm) { Rsp(eX64Alu::kAdd, imm); }
+  void SubRsp(I32 imm) { Rsp(eX64Alu::kSub, imm); }
+  void MovRR64(eX64Reg dst, eX64Reg src) { Op(true, Id(src), Id(dst), {0x89}); }
+  void Lea64(eX64Reg dst, X64Mem src) { OpMem(true, Id(dst), {0x8D}, src); }
+
+ private:
+  struct Label {
+    Opt<Size> offset{};
+    Vec<Size> fixups{};  // Offsets of the 32 bit displacements jumping to the label.
+  };
+
+  Vec<UI8> code_{};
+  Vec<Label> labels_{};
+  Vec<X64Reloc> relocs_{};
+
+  static constexpr UI8 Id(eX64Reg reg) noexcept { return static_cast<UI8>(reg); }
+  static constexpr UI8 Cc(eX64Cond cond) noexcept { return static_cast<UI8>(cond); }
+  static constexpr UI8 Alu(eX64Alu op, UI8 form) noexcept { return static_cast<UI8>(static_cast<UI8>(op) << 3 | form); }
+  static constexpr bool IsImm8(I64 imm) noexcept { return imm >= -128 && imm <= 127; }
+  // Without a REX prefix, byte registers 4 to 7 are ah, ch, dh and bh instead of spl, bpl, sil and dil.
+  static constexpr bool IsByteRexReg(eX64Reg reg) noexcept { return Id(reg) >= 4 && Id(reg) < 8; }
+
+  void Byte(UI8 byte) { code_.push_back(byte); }
+  void Imm32(I32 imm) {
+    const auto bits = static_cast<UI32>(imm);
+    for (int shift = 0; shift < 32; shift += 8) Byte(static_cast<UI8>(bits >> shift));
+  }
+  void Patch32(Size at, I32 value) {
+    const auto bits = static_cast<UI32>(value);
+    for (int i = 0; i < 4; i++) code_[at + i] = static_cast<UI8>(bits >> (8 * i));
+  }
+
+  void Rex(bool is_wide, UI8 reg, UI8 rm, bool is_forced = false) {
+    const UI8 rex = static_cast<UI8>(0x40 | (is_wide ? 8 : 0) | (reg >> 3 & 1) << 2 | (rm >> 3 & 1));
+    if (rex != 0x40 || is_forced) Byte(rex);
+  }
+  void RexOnly(bool is_wide, UI8 reg, UI8 rm, UI8 opcode) {
+    Rex(is_wide, reg, rm);
+    Byte(opcode);
+  }
+  // Register to register form. 'is_byte_rex' forces a REX prefix, for setcc and movzx on registers 4 to 7.
+  void Op(bool is_wide, UI8 reg, UI8 rm, std::initializer_list<UI8> opcode, bool is_byte_rex = false) {
+    Rex(is_wide, reg, rm, is_byte_rex);
+    for (UI8 byte : opcode) Byte(byte);
+    Byte(static_cast<UI8>(0xC0 | (reg & 7) << 3 | (rm & 7)));
+  }
+  // Memory form, 'reg' is a register or an opcode extension.
+  void OpMem(bool is_wide, UI8 reg, std::initializer_list<UI8> opcode, X64Mem mem) {
+    const UI8 base = Id(mem.base);
+    Rex(is_wide, reg, base);
+    for (UI8 byte : opcode) Byte(byte);
+    // A base of rbp or r13 without displacement encodes rip relative addressing, so it takes a zero displacement.
+    const UI8 mod = mem.disp == 0 && (base & 7) != 5 ? 0 : IsImm8(mem.disp) ? 1 : 2;
+    Byte(static_cast<UI8>(mod << 6 | (reg & 7) << 3 | (base & 7)));
+    if ((base & 7) == 4) Byte(0x24);  // A base of rsp or r12 needs a SIB byte.
+    if (mod == 1) Byte(static_cast<UI8>(mem.disp));
+    if (mod == 2) Imm32(mem.disp);
+  }
+  void Rsp(eX64Alu op, I32 imm) {
+    Rex(true, 0, Id(eX64Reg::kRsp));
+    Byte(IsImm8(imm) ? 0x83 : 0x81);
+    Byte(static_cast<UI8>(0xC0 | static_cast<UI8>(op) << 3 | Id(eX64Reg::kRsp)));
+    if (IsImm8(imm))
+      Byte(static_cast<UI8>(imm));
+    else
+      Imm32(imm);
+  }
+  void Jump(UI8 short_opcode, std::initializer_list<UI8> near_opcode, X64Label target);
+};
+
+inline void X64Assembler::Bind(X64Label label) {
+  Label& bound = labels_[label];
+  bound.offset = code_.size();
+  for (Size fixup : bound.fixups) Patch32(fixup, static_cast<I32>(code_.size() - (fixup + 4)));
+  bound.fixups.clear();
+}
+
+inline bool X64Assembler::IsComplete() const noexcept {
+  return std::ranges::all_of(labels_, [](const Label& label) { return label.fixups.empty(); });
+}
+
+inline void X64Assembler::AluRI(eX64Alu op, eX64Reg dst, I32 imm) {
+  Op(false, static_cast<UI8>(op), Id(dst), {static_cast<UI8>(IsImm8(imm) ? 0x83 : 0x81)});
+  if (IsImm8(imm))
+    Byte(static_cast<UI8>(imm));
+  else
+    Imm32(imm);
+}
+
+inline void X64Assembler::AluMI(eX64Alu op, X64Mem dst, I32 imm) {
+  OpMem(false, static_cast<UI8>(op), {static_cast<UI8>(IsImm8(imm) ? 0x83 : 0x81)}, dst);
+  if (IsImm8(imm))
+    Byte(static_cast<UI8>(imm));
+  else
+    Imm32(imm);
+}
+
+inline void X64Assembler::MovRI(eX64Reg dst, I32 imm) {
+  RexOnly(false, 0, Id(dst), static_cast<UI8>(0xB8 | (Id(dst) & 7)));
+  Imm32(imm);
+}
+
+inline void X64Assembler::ImulRRI(eX64Reg dst, eX64Reg src, I32 imm) {
+  Op(false, Id(dst), Id(src), {static_cast<UI8>(IsImm8(imm) ? 0x6B : 0x69)});
+  if (IsImm8(imm))
+    Byte(static_cast<UI8>(imm));
+  else
+    Imm32(imm);
+}
+
+inline void X64Assembler::Call(UI32 symbol) {
+  Byte(0xE8);
+  relocs_.push_back(X64Reloc{.offset = static_cast<UI32>(code_.size()), .symbol = symbol, .addend = -4});
+  Imm32(0);
+}
+
+inline void X64Assembler::PushI(I32 imm) {
+  if (IsImm8(imm)) {
+    Byte(0x6A);
+    Byte(static_cast<UI8>(imm));
+  } else {
+    Byte(0x68);
+    Imm32(imm);
+  }
+}
+
+// Displacements are from the end of the jump. Labels not yet bound get a 32 bit displacement, patched by Bind.
+inline void X64Assembler::Jump(UI8 short_opcode, std::initializer_list<UI8> near_opcode, X64Label target) {
+  Label& label = labels_[target];
+  if (label.offset) {
+    const I64 short_disp = static_cast<I64>(*label.offset) - static_cast<I64>(code_.size() + 2);
+    if (IsImm8(short_disp)) {
+      Byte(short_opcode);
+      Byte(static_cast<UI8>(short_disp));
+      return;
+    }
+  }
+  for (UI8 byte : near_opcode) Byte(byte);
+  if (label.offset) {
+    Imm32(static_cast<I32>(static_cast<I64>(*label.offset) - static_cast<I64>(code_.size() + 4)));
+    return;
+  }
+  label.fixups.push_back(code_.size());
+  Imm32(0);
+}
+
+}  // namespace cnd::x64
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,835 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_compiler
+/// @brief Native x86-64 backend, compiling the low level IR into an ELF64 relocatable object.
+///
+/// Code follows the System V ABI. Functions are laid out in reverse postorder of their blocks, so most jumps fall
+/// through. Values are allocated registers by linear scan over live intervals, each the hull of the positions a value
+/// is live at in that order. Constants are never allocated, they are encoded as immediates where they are used.
+///
+/// rax, rcx, rdx and r11 are scratch registers of the instruction sequences. rsi, rdi and r8 to r10 hold values which
+/// are not live across a call, rbx and r12 to r15 hold any value and are saved by the prologue when used. A value which
+/// finds no register lives in a stack slot for its whole interval, the interval ending last is the one spilled.
+///
+/// Phis are eliminated by parallel moves on the edges into their block. Moves on an edge from a branch, to a block with
+/// phis, are placed in a stub after the block. A comparison only used by the branch ending its block sets the flags
+/// the branch jumps on. Division by zero traps, the division of the smallest integer by -1 wraps as in LirEvalOp.
+///
+/// Functions are named '__cnd__fn__<name>' in the object, as in the generated C code, except the 'main' of a process,
+/// which is 'main' so the object links into an executable.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_compiler
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "compiler_utils/CompilerProcessResult.hpp"
+#include "compiler/TranslationInput.hpp"
+#include "compiler/TranslationOutput.hpp"
+#include "codegen/ParallelCodegen.hpp"
+#include "frontend/Ast.hpp"
+#include "lir/Lir.hpp"
+#include "lir/LirBuild.hpp"
+#include "lir/LirPasses.hpp"
+#include "x64/ElfObject.hpp"
+#include "x64/X64Asm.hpp"
+// clang-format on
+
+namespace cnd::x64 {
+
+/// @brief Symbol of a function in the object.
+inline Str X64SymbolName(const lir::LirFunction& fn) { return fn.name == "main" ? fn.name : "__cnd__fn__" + fn.name; }
+
+/// @brief Compiles the functions of a module, one at a time, into a shared assembler.
+class X64FunctionCompiler {
+ public:
+  X64FunctionCompiler(const lir::LirModule& module, const lir::LirFunction& fn, X64Assembler& as)
+      : module_(module), fn_(fn), as_(as) {}
+
+  ClRes<void> Compile();
+
+  /// @brief Count of values which were given a stack slot instead of a register.
+  Size SpillCount() const noexcept { return spills_; }
+
+ private:
+  using LirReg = lir::LirReg;
+  using LirBlockId = lir::LirBlockId;
+
+  // Where a value is, or the immediate of a constant.
+  struct Loc {
+    enum class eKind : UI8 { kNone, kReg, kMem, kImm } kind{eKind::kNone};
+    eX64Reg reg{eX64Reg::kRax};
+    I32 value{0};  // Displacement from rbp, or immediate.
+
+    static Loc Reg(eX64Reg reg) { return Loc{eKind::kReg, reg, 0}; }
+    static Loc Mem(I32 disp) { return Loc{eKind::kMem, eX64Reg::kRbp, disp}; }
+    static Loc Imm(I32 imm) { return Loc{eKind::kImm, eX64Reg::kRax, imm}; }
+    bool IsReg() const noexcept { return kind == eKind::kReg; }
+    bool IsMem() const noexcept { return kind == eKind::kMem; }
+    bool IsImm() const noexcept { return kind == eKind::kImm; }
+    bool IsReg(eX64Reg other) const noexcept { return IsReg() && reg == other; }
+    X64Mem Mem() const noexcept { return X64Mem{eX64Reg::kRbp, value}; }
+    bool operator==(const Loc& other) const noexcept {
+      return kind == other.kind && (IsReg() ? reg == other.reg : value == other.value);
+    }
+  };
+
+  struct Interval {
+    LirReg value;
+    UI32 start;
+    UI32 end;
+    bool is_crossing_call;
+  };
+
+  struct Move {
+    Loc dst;
+    Loc src;
+  };
+
+  static constexpr eX64Reg kScratch = eX64Reg::kR11;
+  static constexpr Size kNoMove = std::numeric_limits<Size>::max();
+  static constexpr std::array kCallerSavedRegs{eX64Reg::kRsi, eX64Reg::kRdi, eX64Reg::kR8, eX64Reg::kR9,
+                                               eX64Reg::kR10};
+  static constexpr std::array kCalleeSavedRegs{eX64Reg::kRbx, eX64Reg::kR12, eX64Reg::kR13, eX64Reg::kR14,
+                                               eX64Reg::kR15};
+  static constexpr std::array kArgRegs{eX64Reg::kRdi, eX64Reg::kRsi, eX64Reg::kRdx,
+                                       eX64Reg::kRcx, eX64Reg::kR8,  eX64Reg::kR9};
+
+  const lir::LirModule& module_;
+  const lir::LirFunction& fn_;
+  X64Assembler& as_;
+
+  Vec<LirBlockId> order_{};
+  Vec<UI32> block_begin_{};  // Position of each block, its instructions follow two positions apart.
+  Vec<char> is_const_{};
+  Vec<I32> const_value_{};
+  Vec<char> is_fused_{};  // Comparisons setting the flags of the branch after them.
+  Vec<UI32> uses_{};
+  bool is_param_homed_{false};  // Register parameters are stored to slots, instead of moved to their values.
+  Vec<Loc> locs_{};
+  Vec<eX64Reg> saved_regs_{};
+  UI32 slot_count_{0};
+  Vec<Size> spill_slots_{};  // Values of spilled registers, their slot follows the homes of the parameters.
+  Size spills_{0};
+  Vec<X64Label> labels_{};
+  Vec<Size> move_writers_{};  // Move writing each register and slot, while parallel moves are made.
+
+
+  bool IsAllocated(LirReg reg) const noexcept { return !is_const_[reg] && !is_fused_[reg]; }
+  UI32 SlotCountBeforeSpills() const noexcept {
+    return is_param_homed_ ? std::min<UI32>(fn_.param_count, kArgRegs.size()) : 0;
+  }
+  I32 SlotDisp(UI32 slot) const noexcept { return -static_cast<I32>(8 * saved_regs_.size() + 8 * (slot + 1)); }
+  Loc LocOf(LirReg reg) const { return is_const_[reg] ? Loc::Imm(const_value_[reg]) : locs_[reg]; }
+  // Registers, then the slots of the frame.
+  Size MoveIndex(const Loc& loc) const noexcept {
+    if (loc.IsReg()) return static_cast<Size>(loc.reg);
+    return 16 + static_cast<Size>((-loc.value - static_cast<I32>(8 * saved_regs_.size())) / 8 - 1);
+  }
+  Size PredIndex(LirBlockId block, LirBlockId pred, Size nth) const;
+
+  void Analyze();
+  Vec<Interval> BuildIntervals();
+  void Allocate(Vec<Interval>& intervals);
+
+  void EmitPrologue();
+  void EmitEpilogue();
+  ClRes<void> EmitBlock(Size order_index);
+  ClRes<void> EmitInst(const lir::LirInst& inst);
+  void EmitBranch(LirBlockId block, const lir::LirInst& branch, const lir::LirInst* fused, LirBlockId next);
+  void EmitEdge(LirBlockId from, LirBlockId to, Size nth);
+  void EmitParallelMoves(Vec<Move> moves);
+  void EmitBinary(const lir::LirInst& inst);
+  void EmitDivision(const lir::LirInst& inst);
+  void EmitCall(const lir::LirInst& inst);
+  eX64Cond EmitCompare(lir::eLirOp op, Loc lhs, Loc rhs);
+
+  void Load(eX64Reg dst, const Loc& src);
+  void Store(const Loc& dst, eX64Reg src);
+  void MoveLoc(const Loc& dst, const Loc& src);
+  // Register an instruction computes its result in, 'dst' when it is a register.
+  static eX64Reg WorkReg(const Loc& dst) { return dst.IsReg() ? dst.reg : kScratch; }
+};
+
+/// @brief Compiles every function of 'module' into an object. Calls refer to the called function by symbol, each
+/// function of the module is the symbol of the same index.
+inline ClRes<ElfObject> CompileX64Object(const lir::LirModule& module) {
+  X64Assembler as{};
+  ElfObject object{};
+  for (const lir::LirFunction& fn : module.functions) {
+    as.Align(16);
+    const Size begin = as.Offset();
+    auto compiled = X64FunctionCompiler{module, fn, as}.Compile();
+    if (!compiled) return ClFail(compiled.Error());
+    object.symbols.push_back(ElfSymbol{.name = X64SymbolName(fn), .offset = begin, .size = as.Offset() - begin});
+  }
+  object.text = as.Code();
+  for (const X64Reloc& reloc : as.Relocs())
+    object.relocations.push_back(ElfRelocation{
+        .offset = reloc.offset, .symbol = reloc.symbol, .type = ElfObject::kRelocPlt32, .addend = reloc.addend});
+  return object;
+}
+
+/// @brief Builds the LIR of 'program', optimizes it when 'opt_level' is above 0, and compiles it into an object.
+inline ClRes<ElfObject> CompileX64Object(const Ast& program, Int opt_level) {
+  auto module = lir::LirBuilder::Build(program);
+  if (!module) return ClFail(module.Error());
+  if (opt_level > 0) {
+    auto optimized = lir::LirPassManager::MakeDefault().Run(*module);
+    if (!optimized) return ClFail(optimized.Error());
+  }
+  return CompileX64Object(*module);
+}
+
+/// @brief Compiles 'program' at 'input.opt_level' into the object file 'path', without a C compiler. The file is only
+/// rewritten when its content changed, and is appended to 'output.output_files'.
+inline ClRes<clang::codegen::CodeFilesReport> WriteX64Object(const Ast& program, const Path& path,
+                                                             const TrInput& input, TrOutput& output) {
+  auto object = CompileX64Object(program, input.opt_level);
+  if (!object) return ClFail(object.Error());
+  const Vec<UI8> bytes = object->Serialize();
+  const clang::codegen::CodeFilesConfig config{
+      .threads = 1,
+      .is_overwrite_allowed = input.is_overwrite_allowed,
+      .manifest = input.aux_dir.empty() ? Path{} : input.aux_dir / clang::codegen::OutputManifest::kFileName,
+  };
+  return clang::codegen::WriteCodeFiles(
+      Vec<Path>{path},
+      [&bytes](Size, clang::codegen::CodeWriter& out) {
+        out.Write(StrView{reinterpret_cast<const char*>(bytes.data()), bytes.size()});
+      },
+      output.output_files, config);
+}
+
+inline ClRes<void> X64FunctionCompiler::Compile() {
+  if (fn_.blocks.empty())
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Function '{}' has no blocks.", fn_.name)));
+  Analyze();
+  Vec<Interval> intervals = BuildIntervals();
+  Allocate(intervals);
+
+  labels_.resize(fn_.blocks.size());
+  move_writers_.assign(16 + slot_count_, kNoMove);
+  for (LirBlockId block : order_) labels_[block] = as_.NewLabel();
+  EmitPrologue();
+  for (Size i = 0; i < order_.size(); i++) {
+    auto emitted = EmitBlock(i);
+    if (!emitted) return emitted;
+  }
+  if (!as_.IsComplete())
+    return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+        std::source_location::current(), std::format("Function '{}' jumps to a block without code.", fn_.name)));
+  return ClRes<void>{};
+}
+
+// Index in the predecessors of 'block' of the 'nth' edge to it from 'pred'. A branch to the same block twice is two
+// edges, in the order of its targets.
+inline Size X64FunctionCompiler::PredIndex(LirBlockId block, LirBlockId pred, Size nth) const {
+  const Vec<LirBlockId>& preds = fn_.blocks[block].preds;
+  for (Size i = 0; i < preds.size(); i++)
+    if (preds[i] == pred && nth-- == 0) return i;
+  return preds.size();
+}
+
+// Finds constants, comparisons which can be fused into their branch, and whether the parameters are read before any
+// other value is defined. Their registers are then moved to the values in the prologue, as nothing else is live.
+inline void X64FunctionCompiler::Analyze() {
+  const Size reg_count = fn_.reg_types.size();
+  is_const_.assign(reg_count, 0);
+  const_value_.assign(reg_count, 0);
+  is_fused_.assign(reg_count, 0);
+  uses_.assign(reg_count, 0);
+  locs_.assign(reg_count, Loc{});
+  is_param_homed_ = false;
+  order_ = lir::LirReversePostorder(fn_);
+  for (LirBlockId block : order_) {
+    bool is_leading = block == 0;
+    for (const lir::LirInst& phi : fn_.blocks[block].phis)
+      for (LirReg arg : phi.args) uses_[arg]++;
+    for (const lir::LirInst& inst : fn_.blocks[block].insts) {
+      for (LirReg arg : inst.args) uses_[arg]++;
+      if (inst.op == lir::eLirOp::kConst) {
+        is_const_[inst.dst] = 1;
+        const_value_[inst.dst] = static_cast<I32>(inst.imm);
+      } else if (inst.op == lir::eLirOp::kParam) {
+        is_param_homed_ = is_param_homed_ || !is_leading;
+      } else {
+        is_leading = false;
+      }
+    }
+  }
+  for (LirBlockId block : order_) {
+    const Vec<lir::LirInst>& insts = fn_.blocks[block].insts;
+    if (insts.size() < 2 || insts.back().op != lir::eLirOp::kBranch) continue;
+    const lir::LirInst& cmp = insts[insts.size() - 2];
+    if (lir::IsLirOpComparison(cmp.op) && cmp.dst == insts.back().args[0] && uses_[cmp.dst] == 1)
+      is_fused_[cmp.dst] = 1;
+  }
+}
+
+// Liveness follows every use back through the predecessors of its block, up to the block defining the value, so its
+// cost is the size of the live ranges. Only the hull of the positions a value is live at is kept. A phi operand is
+// live at the end of the predecessor it comes from, and a phi is defined at the start of its block.
+inline Vec<X64FunctionCompiler::Interval> X64FunctionCompiler::BuildIntervals() {
+  const Size reg_count = fn_.reg_types.size();
+  const Size block_count = fn_.blocks.size();
+  constexpr UI32 kNone = std::numeric_limits<UI32>::max();
+  Vec<UI32> start(reg_count, kNone);
+  Vec<UI32> end(reg_count, 0);
+  LAMBDA xExtend = [&](LirReg reg, UI32 pos) {
+    start[reg] = std::min(start[reg], pos);
+    end[reg] = std::max(end[reg], pos);
+  };
+
+  // Positions: a block begins at an even position, its instructions follow at even positions and define their result
+  // one position later. A value used by an instruction and one it defines may share a register. Unreachable blocks
+  // have no position.
+  Vec<UI32> calls{};
+  Vec<LirBlockId> def_block(reg_count, lir::kNoLirBlock);
+  block_begin_.assign(block_count, kNone);
+  UI32 pos = 0;
+  for (LirBlockId block : order_) {
+    const lir::LirBlock& b = fn_.blocks[block];
+    block_begin_[block] = pos;
+    for (const lir::LirInst& phi : b.phis) {
+      def_block[phi.dst] = block;
+      xExtend(phi.dst, pos);
+    }
+    for (const lir::LirInst& inst : b.insts) {
+      pos += 2;
+      if (inst.op == lir::eLirOp::kCall) calls.push_back(pos);
+      for (LirReg arg : inst.args)
+        if (IsAllocated(arg)) xExtend(arg, pos);
+      if (inst.dst == lir::kNoLirReg) continue;
+      def_block[inst.dst] = block;
+      if (IsAllocated(inst.dst)) xExtend(inst.dst, pos + 1);
+    }
+    pos += 4;
+  }
+  LAMBDA xBlockEnd = [this](LirBlockId block) {
+    return block_begin_[block] + 2 * static_cast<UI32>(fn_.blocks[block].insts.size() + 1);
+  };
+
+  // Blocks a value is live into, from its uses outside the block defining it.
+  Vec<std::pair<LirReg, LirBlockId>> live_in{};
+  for (LirBlockId block : order_) {
+    const lir::LirBlock& b = fn_.blocks[block];
+    for (const lir::LirInst& phi : b.phis) {
+      for (Size p = 0; p < phi.args.size(); p++) {
+        const LirBlockId pred = b.preds[p];
+        if (!IsAllocated(phi.args[p]) || block_begin_[pred] == kNone) continue;
+        xExtend(phi.args[p], xBlockEnd(pred));
+        if (def_block[phi.args[p]] != pred) live_in.emplace_back(phi.args[p], pred);
+      }
+    }
+    for (const lir::LirInst& inst : b.insts)
+      for (LirReg arg : inst.args)
+        if (IsAllocated(arg) && def_block[arg] != block) live_in.emplace_back(arg, block);
+  }
+  // The uses of a value are walked together, so each block is entered once per value live into it.
+  std::sort(live_in.begin(), live_in.end());
+  Vec<LirReg> walked(block_count, lir::kNoLirReg);
+  Vec<LirBlockId> worklist{};
+  for (const auto& [reg, use_block] : live_in) {
+    worklist.push_back(use_block);
+    while (!worklist.empty()) {
+      const LirBlockId block = worklist.back();
+      worklist.pop_back();
+      if (walked[block] == reg) continue;
+      walked[block] = reg;
+      xExtend(reg, block_begin_[block]);
+      for (LirBlockId pred : fn_.blocks[block].preds) {
+        if (block_begin_[pred] == kNone) continue;
+        xExtend(reg, xBlockEnd(pred));
+        if (def_block[reg] != pred && walked[pred] != reg) worklist.push_back(pred);
+      }
+    }
+  }
+
+  Vec<Interval> intervals{};
+  for (LirReg reg = 0; reg < reg_count; reg++) {
+    if (start[reg] == kNone) continue;
+    const auto call = std::upper_bound(calls.begin(), calls.end(), start[reg]);
+    intervals.push_back(Interval{reg, start[reg], end[reg], call != calls.end() && *call < end[reg]});
+  }
+  std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) {
+    return a.start != b.start ? a.start < b.start : a.end < b.end;
+  });
+  return intervals;
+}
+
+inline void X64FunctionCompiler::Allocate(Vec<Interval>& intervals) {
+  Vec<const Interval*> active{};
+  std::array<char, 16> is_free{};
+  for (eX64Reg reg : kCallerSavedRegs) is_free[static_cast<Size>(reg)] = 1;
+  for (eX64Reg reg : kCalleeSavedRegs) is_free[static_cast<Size>(reg)] = 1;
+  std::array<char, 16> is_used{};
+  spill_slots_.clear();
+  LAMBDA xSpill = [&](LirReg value) {
+    locs_[value] = Loc{};
+    spill_slots_.push_back(value);
+    spills_++;
+  };
+
+  for (const Interval& cur : intervals) {
+    std::erase_if(active, [&](const Interval* interval) {
+      if (interval->end >= cur.start) return false;
+      is_free[static_cast<Size>(locs_[interval->value].reg)] = 1;
+      return true;
+    });
+
+    Opt<eX64Reg> reg{};
+    if (!cur.is_crossing_call)
+      for (eX64Reg candidate : kCallerSavedRegs)
+        if (!reg && is_free[static_cast<Size>(candidate)]) reg = candidate;
+    for (eX64Reg candidate : kCalleeSavedRegs)
+      if (!reg && is_free[static_cast<Size>(candidate)]) reg = candidate;
+
+    if (!reg) {
+      // Spill the interval ending last, among those whose register 'cur' may take.
+      auto victim = active.end();
+      for (auto it = active.begin(); it != active.end(); it++) {
+        const eX64Reg held = locs_[(*it)->value].reg;
+        const bool is_callee_saved = std::ranges::find(kCalleeSavedRegs, held) != kCalleeSavedRegs.end();
+        if ((is_callee_saved || !cur.is_crossing_call) && (victim == active.end() || (*it)->end > (*victim)->end))
+          victim = it;
+      }
+      if (victim == active.end() || (*victim)->end <= cur.end) {
+        xSpill(cur.value);
+        continue;
+      }
+      reg = locs_[(*victim)->value].reg;
+      xSpill((*victim)->value);
+      active.erase(victim);
+    }
+    is_free[static_cast<Size>(*reg)] = 0;
+    is_used[static_cast<Size>(*reg)] = 1;
+    locs_[cur.value] = Loc::Reg(*reg);
+    active.push_back(&cur);
+  }
+
+  saved_regs_.clear();
+  for (eX64Reg reg : kCalleeSavedRegs)
+    if (is_used[static_cast<Size>(reg)]) saved_regs_.push_back(reg);
+  slot_count_ = SlotCountBeforeSpills();
+  for (LirReg value : spill_slots_) locs_[value] = Loc::Mem(SlotDisp(slot_count_++));
+}
+
+// Frame: the return address, the saved rbp, the saved registers, the homes of the register parameters if they are
+// homed, then the spill slots. The stack stays 16 byte aligned below the frame, so calls push their stack arguments
+// in pairs.
+inline void X64FunctionCompiler::EmitPrologue() {
+  as_.Push(eX64Reg::kRbp);
+  as_.MovRR64(eX64Reg::kRbp, eX64Reg::kRsp);
+  for (eX64Reg reg : saved_regs_) as_.Push(reg);
+  Size frame = 8 * static_cast<Size>(slot_count_);
+  if ((8 * saved_regs_.size() + frame) % 16 != 0) frame += 8;
+  if (frame != 0) as_.SubRsp(static_cast<I32>(frame));
+  if (is_param_homed_) {
+    for (UI32 i = 0; i < SlotCountBeforeSpills(); i++) as_.MovMR(X64Mem{eX64Reg::kRbp, SlotDisp(i)}, kArgRegs[i]);
+    return;
+  }
+  // Unused parameters may share a register with the parameter after them, they are not moved.
+  Vec<Move> moves{};
+  for (const lir::LirInst& inst : fn_.blocks[0].insts)
+    if (inst.op == lir::eLirOp::kParam && inst.imm < static_cast<I64>(kArgRegs.size()) && uses_[inst.dst] != 0)
+      moves.push_back(Move{locs_[inst.dst], Loc::Reg(kArgRegs[static_cast<Size>(inst.imm)])});
+  EmitParallelMoves(std::move(moves));
+}
+
+inline void X64FunctionCompiler::EmitEpilogue() {
+  if (saved_regs_.empty()) {
+    as_.Leave();
+  } else {
+    as_.Lea64(eX64Reg::kRsp, X64Mem{eX64Reg::kRbp, -static_cast<I32>(8 * saved_regs_.size())});
+    for (auto reg = saved_regs_.rbegin(); reg != saved_regs_.rend(); reg++) as_.Pop(*reg);
+    as_.Pop(eX64Reg::kRbp);
+  }
+  as_.Ret();
+}
+
+inline ClRes<void> X64FunctionCompiler::EmitBlock(Size order_index) {
+  const LirBlockId block = order_[order_index];
+  const LirBlockId next = order_index + 1 < order_.size() ? order_[order_index + 1] : lir::kNoLirBlock;
+  const Vec<lir::LirInst>& insts = fn_.blocks[block].insts;
+  as_.Bind(labels_[block]);
+  for (Size i = 0; i < insts.size(); i++) {
+    const lir::LirInst& inst = insts[i];
+    if (inst.dst != lir::kNoLirReg && is_fused_[inst.dst]) continue;
+    switch (inst.op) {
+      case lir::eLirOp::kJump:
+        EmitEdge(block, inst.targets[0], 0);
+        if (inst.targets[0] != next) as_.Jmp(labels_[inst.targets[0]]);
+        break;
+      case lir::eLirOp::kBranch: {
+        const lir::LirInst* fused = i > 0 && is_fused_[inst.args[0]] ? &insts[i - 1] : nullptr;
+        EmitBranch(block, inst, fused, next);
+      } break;
+      case lir::eLirOp::kReturn:
+        Load(eX64Reg::kRax, LocOf(inst.args[0]));
+        EmitEpilogue();
+        break;
+      default: {
+        auto emitted = EmitInst(inst);
+        if (!emitted) return emitted;
+      }
+    }
+  }
+  return ClRes<void>{};
+}
+
+inline ClRes<void> X64FunctionCompiler::EmitInst(const lir::LirInst& inst) {
+  using enum lir::eLirOp;
+  const Loc dst = inst.dst == lir::kNoLirReg ? Loc{} : locs_[inst.dst];
+  switch (inst.op) {
+    case kConst:
+      return ClRes<void>{};
+    case kParam:
+      if (inst.imm >= static_cast<I64>(kArgRegs.size()))
+        MoveLoc(dst, Loc::Mem(static_cast<I32>(16 + 8 * (inst.imm - static_cast<I64>(kArgRegs.size())))));
+      else if (is_param_homed_)
+        MoveLoc(dst, Loc::Mem(SlotDisp(static_cast<UI32>(inst.imm))));
+      return ClRes<void>{};
+    case kCopy:
+      MoveLoc(dst, LocOf(inst.args[0]));
+      return ClRes<void>{};
+    case kAdd:
+    case kSub:
+    case kMul:
+    case kAnd:
+    case kOr:
+    case kXor:
+    case kLsh:
+    case kRsh:
+      EmitBinary(inst);
+      return ClRes<void>{};
+    case kDiv:
+    case kMod:
+      EmitDivision(inst);
+      return ClRes<void>{};
+    case kEq:
+    case kNeq:
+    case kLt:
+    case kGt:
+    case kLte:
+    case kGte:
+    case kNot:
+    case kZext: {
+      // Booleans are 0 or 1 in a full register. 'not' is 'a == 0', 'zext' is 'a != 0'.
+      const eX64Cond cond = inst.op == kNot    ? EmitCompare(kEq, LocOf(inst.args[0]), Loc::Imm(0))
+                            : inst.op == kZext ? EmitCompare(kNeq, LocOf(inst.args[0]), Loc::Imm(0))
+                                               : EmitCompare(inst.op, LocOf(inst.args[0]), LocOf(inst.args[1]));
+      const eX64Reg work = WorkReg(dst);
+      as_.Setcc(cond, work);
+      as_.Movzx8(work, work);
+      Store(dst, work);
+      return ClRes<void>{};
+    }
+    case kNeg: {
+      const eX64Reg work = WorkReg(dst);
+      Load(work, LocOf(inst.args[0]));
+      as_.Neg(work);
+      Store(dst, work);
+      return ClRes<void>{};
+    }
+    case kCall:
+      EmitCall(inst);
+      return ClRes<void>{};
+    default:
+      return ClFail(MakeClMsg<eClErr::kCompilerDevDebugError>(
+          std::source_location::current(),
+          std::format("Cannot select x86-64 instructions for '{}'.", lir::eLirOpToCStr(inst.op))));
+  }
+}
+
+// The false edge falls through after the jump on the condition. When the true target is next and the false one has
+// no phis, the condition is negated so the true edge falls through instead.
+inline void X64FunctionCompiler::EmitBranch(LirBlockId block, const lir::LirInst& branch, const lir::LirInst* fused,
+                                            LirBlockId next) {
+  const LirBlockId if_true = branch.targets[0];
+  const LirBlockId if_false = branch.targets[1];
+  const Size false_nth = if_true == if_false ? 1 : 0;
+  eX64Cond cond{};
+  if (fused) {
+    cond = EmitCompare(fused->op, LocOf(fused->args[0]), LocOf(fused->args[1]));
+  } else {
+    const Loc value = LocOf(branch.args[0]);
+    if (value.IsImm()) {
+      const LirBlockId target = value.value != 0 ? if_true : if_false;
+      EmitEdge(block, target, value.value != 0 ? 0 : false_nth);
+      if (target != next) as_.Jmp(labels_[target]);
+      return;
+    }
+    cond = EmitCompare(lir::eLirOp::kNeq, value, Loc::Imm(0));
+  }
+
+  if (if_true == next && if_true != if_false && fn_.blocks[if_false].phis.empty()) {
+    as_.Jcc(NegateX64Cond(cond), labels_[if_false]);
+    EmitEdge(block, if_true, 0);
+    return;
+  }
+  const bool is_stub = !fn_.blocks[if_true].phis.empty();
+  const X64Label true_label = is_stub ? as_.NewLabel() : labels_[if_true];
+  as_.Jcc(cond, true_label);
+  EmitEdge(block, if_false, false_nth);
+  if (if_false != next || is_stub) as_.Jmp(labels_[if_false]);
+  if (is_stub) {
+    as_.Bind(true_label);
+    EmitEdge(block, if_true, 0);
+    if (if_true != next) as_.Jmp(labels_[if_true]);
+  }
+}
+
+inline void X64FunctionCompiler::EmitEdge(LirBlockId from, LirBlockId to, Size nth) {
+  const lir::LirBlock& target = fn_.blocks[to];
+  if (target.phis.empty()) return;
+  const Size pred = PredIndex(to, from, nth);
+  Vec<Move> moves{};
+  for (const lir::LirInst& phi : target.phis) moves.push_back(Move{locs_[phi.dst], LocOf(phi.args[pred])});
+  EmitParallelMoves(std::move(moves));
+}
+
+// A move is made once no other move reads its destination. A location has one writer, so the moves left when none is
+// ready form disjoint cycles. The destination of a move of one cycle is saved in the scratch register, the move
+// reading it reads the scratch register instead, and the cycle is made before another one is broken.
+inline void X64FunctionCompiler::EmitParallelMoves(Vec<Move> moves) {
+  std::erase_if(moves, [](const Move& move) { return move.dst == move.src; });
+  const Size count = moves.size();
+  for (Size i = 0; i < count; i++) move_writers_[MoveIndex(moves[i].dst)] = i;
+  LAMBDA xWriterOf = [this](const Loc& src) { return src.IsImm() ? kNoMove : move_writers_[MoveIndex(src)]; };
+  Vec<Size> readers(count, 0);  // Moves not made yet reading the destination of each move.
+  for (const Move& move : moves)
+    if (const Size writer = xWriterOf(move.src); writer != kNoMove) readers[writer]++;
+  Vec<Size> ready{};
+  for (Size i = 0; i < count; i++)
+    if (readers[i] == 0) ready.push_back(i);
+
+  Vec<char> is_done(count, 0);
+  Opt<Loc> saved{};
+  for (Size done = 0, blocked = 0; done < count; done++) {
+    if (ready.empty()) {
+      while (is_done[blocked]) blocked++;
+      saved = moves[blocked].dst;
+      Load(kScratch, *saved);
+      ready.push_back(blocked);
+    }
+    const Size i = ready.back();
+    ready.pop_back();
+    MoveLoc(moves[i].dst, saved && moves[i].src == *saved ? Loc::Reg(kScratch) : moves[i].src);
+    is_done[i] = 1;
+    const Size writer = xWriterOf(moves[i].src);
+    if (writer != kNoMove && !is_done[writer] && --readers[writer] == 0) ready.push_back(writer);
+  }
+  for (const Move& move : moves) move_writers_[MoveIndex(move.dst)] = kNoMove;
+}
+
+// Computes 'lhs op rhs' in the work register. A work register holding 'rhs' would be overwritten by 'lhs' first, so
+// the operands of a commutative op are swapped, and other ops work in the scratch register.
+inline void X64FunctionCompiler::EmitBinary(const lir::LirInst& inst) {
+  using enum lir::eLirOp;
+  const Loc dst = locs_[inst.dst];
+  Loc lhs = LocOf(inst.args[0]);
+  Loc rhs = LocOf(inst.args[1]);
+  const bool is_commutative = lir::IsLirOpCommutative(inst.op);
+  if (is_commutative && lhs.IsImm() && !rhs.IsImm()) std::swap(lhs, rhs);
+  eX64Reg work = WorkReg(dst);
+  if (rhs.IsReg(work) && !lhs.IsReg(work)) {
+    if (is_commutative)
+      std::swap(lhs, rhs);
+    else
+      work = kScratch;
+  }
+
+  if ((inst.op == kLsh || inst.op == kRsh) && !rhs.IsImm()) Load(eX64Reg::kRcx, rhs);
+  Load(work, lhs);
+  switch (inst.op) {
+    case kMul:
+      if (rhs.IsReg())
+        as_.ImulRR(work, rhs.reg);
+      else if (rhs.IsMem())
+        as_.ImulRM(work, rhs.Mem());
+      else
+        as_.ImulRRI(work, work, rhs.value);
+      break;
+    case kLsh:
+    case kRsh: {
+      const eX64Shift shift = inst.op == kLsh ? eX64Shift::kShl : eX64Shift::kSar;
+      if (rhs.IsImm())
+        as_.ShiftI(shift, work, static_cast<UI8>(rhs.value & 31));
+      else
+        as_.ShiftCl(shift, work);
+    } break;
+    default: {
+      const eX64Alu alu = inst.op == kAdd   ? eX64Alu::kAdd
+                          : inst.op == kSub ? eX64Alu::kSub
+                          : inst.op == kAnd ? eX64Alu::kAnd
+                          : inst.op == kOr  ? eX64Alu::kOr
+                                            : eX64Alu::kXor;
+      if (rhs.IsReg())
+        as_.AluRR(alu, work, rhs.reg);
+      else if (rhs.IsMem())
+        as_.AluRM(alu, work, rhs.Mem());
+      else
+        as_.AluRI(alu, work, rhs.value);
+    }
+  }
+  Store(dst, work);
+}
+
+// idiv traps on the smallest integer divided by -1, so a divisor of -1 negates, or gives a remainder of 0.
+inline void X64FunctionCompiler::EmitDivision(const lir::LirInst& inst) {
+  const bool is_div = inst.op == lir::eLirOp::kDiv;
+  const Loc rhs = LocOf(inst.args[1]);
+  Load(eX64Reg::kRax, LocOf(inst.args[0]));
+  LAMBDA xMinusOne = [&]() {
+    if (is_div)
+      as_.Neg(eX64Reg::kRax);
+    else
+      as_.AluRR(eX64Alu::kXor, eX64Reg::kRdx, eX64Reg::kRdx);
+  };
+  if (rhs.IsImm() && rhs.value == -1) {
+    xMinusOne();
+  } else if (rhs.IsImm()) {
+    as_.MovRI(eX64Reg::kRcx, rhs.value);
+    as_.Cdq();
+    as_.Idiv(eX64Reg::kRcx);
+  } else {
+    Load(eX64Reg::kRcx, rhs);
+    const X64Label divide = as_.NewLabel();
+    const X64Label done = as_.NewLabel();
+    as_.AluRI(eX64Alu::kCmp, eX64Reg::kRcx, -1);
+    as_.Jcc(eX64Cond::kNe, divide);
+    xMinusOne();
+    as_.Jmp(done);
+    as_.Bind(divide);
+    as_.Cdq();
+    as_.Idiv(eX64Reg::kRcx);
+    as_.Bind(done);
+  }
+  Store(locs_[inst.dst], is_div ? eX64Reg::kRax : eX64Reg::kRdx);
+}
+
+// Arguments are pushed last to first, then the first six are popped into their registers, so reading the arguments
+// never sees a register already overwritten by another argument. Values live across the call are in callee saved
+// registers or slots.
+inline void X64FunctionCompiler::EmitCall(const lir::LirInst& inst) {
+  const Size stack_args = inst.args.size() > kArgRegs.size() ? inst.args.size() - kArgRegs.size() : 0;
+  const Size pad = stack_args % 2;
+  if (pad != 0) as_.SubRsp(8);
+  for (auto arg = inst.args.rbegin(); arg != inst.args.rend(); arg++) {
+    const Loc loc = LocOf(*arg);
+    if (loc.IsReg())
+      as_.Push(loc.reg);
+    else if (loc.IsMem())
+      as_.PushM(loc.Mem());
+    else
+      as_.PushI(loc.value);
+  }
+  for (Size i = 0; i < std::min(inst.args.size(), kArgRegs.size()); i++) as_.Pop(kArgRegs[i]);
+  as_.Call(static_cast<UI32>(inst.imm));
+  if (stack_args + pad != 0) as_.AddRsp(static_cast<I32>(8 * (stack_args + pad)));
+  Store(locs_[inst.dst], eX64Reg::kRax);
+}
+
+// Sets the flags for 'lhs op rhs', returning the condition which holds when it is true. An immediate left operand is
+// swapped to the right, with the condition mirrored.
+inline eX64Cond X64FunctionCompiler::EmitCompare(lir::eLirOp op, Loc lhs, Loc rhs) {
+  using enum lir::eLirOp;
+  if (lhs.IsImm() && !rhs.IsImm()) {
+    std::swap(lhs, rhs);
+    op = op == kLt ? kGt : op == kGt ? kLt : op == kLte ? kGte : op == kGte ? kLte : op;
+  }
+  if (lhs.IsImm() || (lhs.IsMem() && rhs.IsMem())) {
+    Load(kScratch, lhs);
+    lhs = Loc::Reg(kScratch);
+  }
+  if (lhs.IsReg()) {
+    if (rhs.IsReg())
+      as_.AluRR(eX64Alu::kCmp, lhs.reg, rhs.reg);
+    else if (rhs.IsMem())
+      as_.AluRM(eX64Alu::kCmp, lhs.reg, rhs.Mem());
+    else if (rhs.value == 0)
+      as_.TestRR(lhs.reg, lhs.reg);
+    else
+      as_.AluRI(eX64Alu::kCmp, lhs.reg, rhs.value);
+  } else if (rhs.IsReg()) {
+    as_.AluMR(eX64Alu::kCmp, lhs.Mem(), rhs.reg);
+  } else {
+    as_.AluMI(eX64Alu::kCmp, lhs.Mem(), rhs.value);
+  }
+  switch (op) {
+    case kEq: return eX64Cond::kE;
+    case kNeq: return eX64Cond::kNe;
+    case kLt: return eX64Cond::kL;
+    case kGt: return eX64Cond::kG;
+    case kLte: return eX64Cond::kLe;
+    default: return eX64Cond::kGe;
+  }
+}
+
+inline void X64FunctionCompiler::Load(eX64Reg dst, const Loc& src) {
+  if (src.IsReg())
+    as_.MovRR(dst, src.reg);
+  else if (src.IsMem())
+    as_.MovRM(dst, src.Mem());
+  else if (src.value == 0)
+    as_.AluRR(eX64Alu::kXor, dst, dst);
+  else
+    as_.MovRI(dst, src.value);
+}
+
+inline void X64FunctionCompiler::Store(const Loc& dst, eX64Reg src) {
+  if (dst.IsReg())
+    as_.MovRR(dst.reg, src);
+  else if (dst.IsMem())
+    as_.MovMR(dst.Mem(), src);
+}
+
+// Memory to memory moves go through rax, which holds no value between instructions.
+inline void X64FunctionCompiler::MoveLoc(const Loc& dst, const Loc& src) {
+  if (dst == src || dst.kind == Loc::eKind::kNone) return;
+  if (dst.IsReg()) {
+    Load(dst.reg, src);
+  } else if (src.IsReg()) {
+    as_.MovMR(dst.Mem(), src.reg);
+  } else if (src.IsImm()) {
+    as_.MovMI(dst.Mem(), src.value);
+  } else {
+    as_.MovRM(eX64Reg::kRax, src.Mem());
+    as_.MovMR(dst.Mem(), eX64Reg::kRax);
+  }
+}
+
+}  // namespace cnd::x64
+
+/// @} // end of cnd_compiler
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
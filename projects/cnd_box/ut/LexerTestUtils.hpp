@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Token comparisons shared by the lexer unit tests.
+///
+/// These methods should ONLY be used within unit tests.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/tk.hpp"
+// clang-format on
+
+namespace cnd_unit_test::test_util {
+using cnd::Tk;
+
+// Tokens are identical if they are equal down to the position fields and the source chars their literals view.
+inline bool IsTkIdentical(const Tk& a, const Tk& b) {
+  return a.type_ == b.type_ && a.file_ == b.file_ && a.beg_line_ == b.beg_line_ && a.end_line_ == b.end_line_ &&
+         a.beg_col_ == b.beg_col_ && a.end_col_ == b.end_col_ && a.literal_.data() == b.literal_.data() &&
+         a.literal_.size() == b.literal_.size();
+}
+
+}  // namespace cnd_unit_test::test_util
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Parsed test programs shared by the back end unit tests.
+///
+/// These methods should ONLY be used within unit tests.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "ccapi/CommonCppApi.hpp"
+#include "frontend/Parser.hpp"
+// clang-format on
+
+namespace cnd_unit_test::test_util {
+using cnd::Ast;
+using cnd::Tk;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using cnd::trtools::parser::ParseSyntax;
+using cnd::trtools::parser::TkCursorT;
+
+// Functions with loops, branches and calls, which the compile time virtual machine evaluates too. Each terminates for
+// any arguments, 'fib' takes exponential time for large ones.
+static constexpr const char* kLirFunctions =
+    "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+    "fn@sq(const int @x)>const int:{ return x * x; };"
+    "fn@sumsq(const int @n)>const int:{"
+    "  def int @s:0;"
+    "  for (def int @i:0; i < n; i++) { s = s + sq(i); }"
+    "  return s + 2 * 3;"
+    "};"
+    "fn@collatz(const int @n)>const int:{"
+    "  def int @steps:0;"
+    "  def int @x:n;"
+    "  while (x > 1) { if (x % 2 == 0) { x = x >> 1; } else { x = 3 * x + 1; } steps++; };"
+    "  return steps ^ (n & 7) | 0;"
+    "};"
+    "fn@sign(const int @n)>const int:{"
+    "  if (n < 0) { return 0 - 1; } elif (n > 0) { return 1; } else { return 0; }"
+    "};"
+    "fn@shared(const int @a, const int @b)>const int:{"
+    "  def int @p:a + b;"
+    "  def int @q:b + a;"
+    "  def int @unused:p * 100;"
+    "  def int @c:4;"
+    "  if (c > 3) { c = c * 2; } else { c = 0; }"
+    "  return p * q + c;"
+    "};"
+    "fn@divmod(const int @a, const int @b)>const int:{"
+    "  if (b == 0) { return 0 - 1; };"
+    "  return a / b * 1000 + a % b;"
+    "};";
+
+// Parsed program, with the tokens it was parsed from. The tree refers to the tokens.
+struct ParsedProgram {
+  Vec<Tk> tokens{};
+  Ast ast{};
+};
+
+// Lexes and parses 'src'. The tree is empty if it does not parse.
+inline ParsedProgram ParseProgram(const char* src) {
+  ParsedProgram program{.tokens = Lexer::LexSanitized(src).value_or(Vec<Tk>{})};
+  std::span<const Tk> tokens_span{program.tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (parsed) program.ast = parsed.Extract().ast;
+  return program;
+}
+
+}  // namespace cnd_unit_test::test_util
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the compile time value representation and its operations.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "hir/AnyValue.hpp"
+// clang-format on
+
+namespace cnd_unit_test::hir::any_value {
+using cnd::hir::Array;
+using cnd::hir::AV;
+using cnd::hir::Error;
+using cnd::hir::F32;
+using cnd::hir::I32;
+using cnd::hir::kIsInlineValue;
+using cnd::hir::None;
+using cnd::hir::RefArena;
+using cnd::hir::RefArenaScope;
+using cnd::hir::RefBlock;
+using cnd::hir::String;
+
+// Value of an I32 result, or a sentinel if the operation did not produce an I32.
+inline I32::DataT I32Of(const AV& value) { return AV::Is<I32>(value) ? AV::CppRef<I32>(value).data : -999; }
+
+TEST(UtAnyValue, ScalarsAreStoredInline) {
+  static_assert(kIsInlineValue<I32> && kIsInlineValue<F32> && kIsInlineValue<None> && kIsInlineValue<Error>);
+  static_assert(!kIsInlineValue<String>);
+  static_assert(std::is_trivially_copyable_v<AV>);
+
+  AV a = AV::Make<I32>(5);
+  AV b = a;
+  AV::CppRef<I32>(b).data = 7;
+  EXPECT_EQ(I32Of(a), 5);
+  EXPECT_EQ(I32Of(b), 7);
+
+  // A scalar cannot be referenced, a reference could not alias the value stored in place.
+  EXPECT_TRUE(AV::Is<Error>(AV::Ref(a)));
+  EXPECT_TRUE(AV::Is<Error>(AV::WeakRef(a)));
+  EXPECT_EQ(I32Of(a), 5);
+  EXPECT_TRUE(AV::IsInline(a));
+
+  // Default made scalars hold a zero value instead of a null payload.
+  EXPECT_EQ(I32Of(AV::Make<I32>()), 0);
+}
+
+TEST(UtAnyValue, HeapValuesAreShared) {
+  AV s = AV::Make<String>("abc");
+  EXPECT_TRUE(!AV::IsInline(s));
+  AV r = AV::Ref(s);
+  AV::CppRef<String>(r).data += "d";
+  EXPECT_TRUE(AV::CppRef<String>(s).data == "abcd");
+
+  AV copy = AV::Copy(s);
+  AV::CppRef<String>(copy).data += "e";
+  EXPECT_TRUE(AV::CppRef<String>(s).data == "abcd");
+}
+
+TEST(UtAnyValue, IntegralOperations) {
+  const AV twelve = AV::Make<I32>(12);
+  const AV ten = AV::Make<I32>(10);
+  EXPECT_EQ(I32Of(AV::Add(twelve, ten)), 22);
+  EXPECT_EQ(I32Of(AV::Sub(twelve, ten)), 2);
+  EXPECT_EQ(I32Of(AV::Mul(twelve, ten)), 120);
+  EXPECT_EQ(I32Of(AV::Div(twelve, ten)), 1);
+  EXPECT_EQ(I32Of(AV::Mod(twelve, ten)), 2);
+  EXPECT_EQ(I32Of(AV::And(twelve, ten)), 8);
+  EXPECT_EQ(I32Of(AV::Or(twelve, ten)), 14);
+  EXPECT_EQ(I32Of(AV::Xor(twelve, ten)), 6);
+  EXPECT_EQ(I32Of(AV::Lsh(twelve, AV::Make<I32>(2))), 48);
+  EXPECT_EQ(I32Of(AV::Rsh(twelve, AV::Make<I32>(2))), 3);
+
+  // Bitwise operations are not defined for floating points.
+  EXPECT_TRUE(AV::Is<Error>(AV::And(twelve, AV::Make<F32>(1.0f))));
+  EXPECT_TRUE(AV::Is<Error>(AV::Xor(AV::Make<F32>(1.0f), ten)));
+}
+
+TEST(UtAnyValue, PooledValuesAreSingleBlocks) {
+  RefArena arena{};
+  RefArenaScope scope{arena};
+  AV s = AV::Make<String>("abc");
+  const auto& ref = AV::Ref<String>(s);
+  // The reference count is the head of the block holding the string.
+  EXPECT_TRUE(RefBlock<String>::FromCount(&ref.Payload()->control.count)->Value() == &ref.ConstSelf());
+  EXPECT_EQ(arena.Pool<String>().LiveCount(), 1);
+
+  // A released block is reused by the next value of the same type.
+  const String* first = &ref.ConstSelf();
+  AV::Release(s);
+  EXPECT_EQ(arena.Pool<String>().LiveCount(), 0);
+  AV t = AV::Make<String>("def");
+  EXPECT_TRUE(&AV::CppRef<String>(t) == first);
+  EXPECT_EQ(arena.Pool<String>().SlabCount(), 1);
+}
+
+TEST(UtAnyValue, ArenaOutlivesUnreleasedValues) {
+  {
+    RefArena arena{};
+    RefArenaScope scope{arena};
+    // Values which are never released are destroyed with the arena.
+    for (int i = 0; i < 1000; i++) static_cast<void>(AV::Make<String>(std::string(64, 'x')));
+    EXPECT_EQ(arena.Pool<String>().LiveCount(), 1000);
+    EXPECT_TRUE(arena.Pool<String>().SlabCount() > 1);
+  }
+  // Without an active arena, values are heap blocks.
+  AV s = AV::Make<String>("abc");
+  EXPECT_TRUE(AV::Ref<String>(s).Payload()->control.pool == nullptr);
+  AV::Release(s);
+}
+
+TEST(UtAnyValue, CopiesShareUntilMutated) {
+  RefArena arena{};
+  RefArenaScope scope{arena};
+  AV arr = AV::Make<Array>(Array::DataT{AV::Make<I32>(1), AV::Make<String>("abc")});
+  AV copy = AV::Copy(arr);
+  AV alias = AV::Ref(arr);
+  EXPECT_TRUE(AV::Ref<Array>(copy).Payload() == AV::Ref<Array>(arr).Payload());
+  EXPECT_EQ(arena.Pool<Array>().LiveCount(), 1);
+
+  // The first mutation clones the data for the mutated handle, its references observe the clone.
+  AV::CppRef<Array>(alias).data.push_back(AV::Make<I32>(3));
+  EXPECT_TRUE(AV::Ref<Array>(copy).Payload() != AV::Ref<Array>(arr).Payload());
+  EXPECT_TRUE(AV::Ref<Array>(alias).Payload() == AV::Ref<Array>(arr).Payload());
+  EXPECT_EQ(AV::CppRef<Array>(std::as_const(arr)).data.size(), 3);
+  EXPECT_EQ(AV::CppRef<Array>(std::as_const(copy)).data.size(), 2);
+
+  // Nested values are shared by the clone until they are mutated themselves.
+  const AV& copied_str = AV::CppRef<Array>(std::as_const(copy)).data[1];
+  AV& str = AV::CppRef<Array>(arr).data[1];
+  EXPECT_TRUE(AV::Ref<String>(str).Payload() == AV::Ref<String>(copied_str).Payload());
+  AV::CppRef<String>(str).data += "d";
+  EXPECT_TRUE(AV::CppRef<String>(copied_str).data == "abc");
+  EXPECT_TRUE(AV::CppRef<String>(std::as_const(str)).data == "abcd");
+
+  // Mutating the last owner does not clone.
+  AV::CppRef<Array>(copy).data.push_back(AV::Make<I32>(4));
+  EXPECT_EQ(arena.Pool<Array>().LiveCount(), 2);
+  AV::Release(copy);
+  AV::Release(alias);
+  AV::Release(arr);
+  EXPECT_EQ(arena.Pool<Array>().LiveCount(), 0);
+  EXPECT_EQ(arena.Pool<String>().LiveCount(), 0);
+}
+
+}  // namespace cnd_unit_test::hir::any_value
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the flat syntax tree arena and its node view.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "frontend/Parser.hpp"
+#include "frontend/ast_arena.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::ast_arena {
+using cnd::Ast;
+using cnd::AstArena;
+using cnd::AstView;
+using cnd::eAst;
+using cnd::Size;
+using cnd::Tk;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using namespace cnd::trtools::parser;
+
+// Checks that every child of 'node' names 'node' as its parent.
+inline bool ParentsAreConsistent(AstView node) {
+  for (AstView child : node.Children())
+    if (child.Parent().Id() != node.Id() || !ParentsAreConsistent(child)) return false;
+  return true;
+}
+
+TEST(UtAstArena, BuildsTreeByIndex) {
+  Vec<Tk> tokens = Lexer::LexSanitized("a+b*c").value_or(Vec<Tk>{});
+  ASSERT_TRUE(tokens.size() >= 5);
+  AstArena arena{std::span<const Tk>{tokens}};
+  const auto add = arena.Add(eAst::kAdd, 0, 5);
+  const auto a = arena.Add(eAst::kIdent, 0, 1);
+  const auto mul = arena.Add(eAst::kMul, 2, 5);
+  arena.AppendChild(add, a);
+  arena.AppendChild(add, mul);
+  arena.AppendChild(mul, arena.Add(eAst::kIdent, 2, 3));
+  arena.AppendChild(mul, arena.Add(eAst::kIdent, 4, 5));
+  arena.SetRoot(add);
+
+  AstView root = arena.Root();
+  ASSERT_EQ(arena.Count(), Size{5});
+  EXPECT_TRUE(root.TypeIs(eAst::kAdd));
+  EXPECT_TRUE(!root.Parent().Valid());
+  ASSERT_EQ(root.ChildCount(), Size{2});
+  EXPECT_TRUE(root.At(0).GetLiteral() == "a");
+  EXPECT_TRUE(root.At(1).TypeIs(eAst::kMul));
+  EXPECT_TRUE(root.At(1).GetLiteral() == "b*c");
+  EXPECT_TRUE(root.At(1).At(1).RawLiteral() == "c");
+  EXPECT_TRUE(root.At(1).Parent().Id() == root.Id());
+  EXPECT_TRUE(ParentsAreConsistent(root));
+}
+
+TEST(UtAstArena, FlattenedTreeMatchesParsedTree) {
+  Vec<Tk> tokens = Lexer::LexSanitized(
+                       "lib@L:{def @v:f(a,[b,c])+1*2;fn@add(const int @a,const int @b)>const int:{a<=>b;};};")
+                       .value_or(Vec<Tk>{});
+  ASSERT_TRUE(!tokens.empty());
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  ASSERT_TRUE(parsed.has_value());
+
+  AstArena arena = AstArena::FromAst(tokens_span, parsed->ast);
+  ASSERT_EQ(arena.Count(), AstArena::CountNodes(parsed->ast));
+  AstView root = arena.Root();
+  EXPECT_TRUE(root == parsed->ast);
+  EXPECT_TRUE(root.Format() == parsed->ast.Format());
+  EXPECT_TRUE(Ast::CompareAst(root.ToAst(), parsed->ast));
+  EXPECT_TRUE(ParentsAreConsistent(root));
+
+  Size visited = 0;
+  for (AstView child : root.Children()) {
+    EXPECT_TRUE(child == parsed->ast.At(visited));
+    visited++;
+  }
+  ASSERT_EQ(visited, parsed->ast.children.size());
+}
+
+TEST(UtAstArena, ComparisonDetectsDifferences) {
+  Vec<Tk> tokens = Lexer::LexSanitized("a+b").value_or(Vec<Tk>{});
+  ASSERT_TRUE(tokens.size() >= 3);
+  AstArena arena{std::span<const Tk>{tokens}};
+  const auto add = arena.Add(eAst::kAdd, 0, 3);
+  arena.AppendChild(add, arena.Add(eAst::kIdent, 0, 1));
+  arena.AppendChild(add, arena.Add(eAst::kIdent, 2, 3));
+  const auto lone = arena.Add(eAst::kAdd, 0, 3);
+  arena.AppendChild(lone, arena.Add(eAst::kIdent, 0, 1));
+
+  EXPECT_TRUE(arena.View(add) == arena.View(add));
+  EXPECT_TRUE(!(arena.View(add) == arena.View(lone)));
+  EXPECT_TRUE(!(arena.View(add).At(0) == arena.View(add).At(1)));
+}
+
+}  // namespace cnd_unit_test::frontend::ast_arena
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
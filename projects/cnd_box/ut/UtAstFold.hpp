@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests constant folding and dead branch elimination over the Ast.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "hir/Compeval.hpp"
+// clang-format on
+
+namespace cnd_unit_test::hir::fold {
+using cnd::Ast;
+using cnd::eAst;
+using cnd::Tk;
+using cnd::TrInput;
+using cnd::TrOutput;
+using cnd::Vec;
+using cnd::hir::AstFolder;
+using cnd::hir::TrUnit;
+using cnd::trtools::Lexer;
+using namespace cnd::trtools::parser;
+
+// Folded expression, with the tokens it was parsed from.
+struct FoldedExpr {
+  Vec<Tk> tokens{};
+  Ast ast{};
+};
+
+inline FoldedExpr FoldExpr(AstFolder& folder, const char* expr) {
+  FoldedExpr folded{.tokens = Lexer::LexSanitized(expr).value_or(Vec<Tk>{})};
+  std::span<const Tk> tokens_span{folded.tokens};
+  auto parsed = ParsePrimaryExpr(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (parsed) folded.ast = parsed.Extract().ast;
+  folder.Fold(folded.ast);
+  return folded;
+}
+
+inline const Ast* FindFirst(const Ast& ast, eAst type) {
+  if (ast.TypeIs(type)) return &ast;
+  for (const Ast& child : ast.children)
+    if (const Ast* found = FindFirst(child, type)) return found;
+  return nullptr;
+}
+
+TEST(UtAstFold, FoldsLiteralExpressions) {
+  AstFolder folder{};
+  auto arith = FoldExpr(folder, "1+2*3");
+  EXPECT_TRUE(arith.ast.TypeIs(eAst::kLitInt) && arith.ast.children.empty());
+  EXPECT_TRUE(arith.ast.RawLiteral() == "7");
+  auto nested = FoldExpr(folder, "(4+5)*(6-1)");
+  EXPECT_TRUE(nested.ast.TypeIs(eAst::kLitInt) && nested.ast.RawLiteral() == "45");
+  auto compared = FoldExpr(folder, "7>5");
+  EXPECT_TRUE(compared.ast.TypeIs(eAst::kLitBool) && compared.ast.RawLiteral() == "true");
+
+  // Only the literal operand of an expression on a name folds.
+  auto partial = FoldExpr(folder, "x*2+(1+2)");
+  ASSERT_TRUE(partial.ast.TypeIs(eAst::kAdd));
+  EXPECT_TRUE(partial.ast.At(0).TypeIs(eAst::kMul));
+  EXPECT_TRUE(partial.ast.At(1).TypeIs(eAst::kLitInt) && partial.ast.At(1).RawLiteral() == "3");
+
+  // Division by zero is left for the evaluator.
+  EXPECT_TRUE(FoldExpr(folder, "1/0").ast.TypeIs(eAst::kDiv));
+  EXPECT_EQ(folder.FoldedExprs(), 7);
+
+  // Folding a folded tree changes nothing.
+  folder.Fold(partial.ast);
+  EXPECT_EQ(folder.FoldedExprs(), 7);
+}
+
+TEST(UtAstFold, PrunesConstantBranches) {
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  auto tokens = Lexer::LexSanitized(
+      "fn@pick(const int @n)>const int:{"
+      "  cxif (1 > 2) { return 1; } cxelif (n > 3) { return 2; } cxelif (2 == 2) { return 3; } cxelse { return 4; }"
+      "  return 5;"
+      "};"
+      "return pick(9) * 10 + pick(1);");
+  ASSERT_TRUE(tokens.has_value());
+  std::span<const Tk> tokens_span{*tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  ASSERT_TRUE(parsed.has_value());
+  unit.trees["test"] = parsed.Extract().ast;
+  ASSERT_TRUE(unit.EvalSourceFile("test").has_value());
+  EXPECT_EQ(output.return_value, 23);
+
+  // The false clause is removed, the true one becomes the else and the clauses after it are removed.
+  const Ast* stmt = FindFirst(unit.trees["test"], eAst::kIfStatement);
+  ASSERT_TRUE(stmt != nullptr);
+  ASSERT_EQ(stmt->children.size(), 2);
+  EXPECT_TRUE(stmt->At(0).TypeIs(eAst::kKwCxif));
+  EXPECT_TRUE(stmt->At(1).TypeIs(eAst::kKwCxelse));
+  EXPECT_EQ(unit.folder.PrunedClauses(), 2);
+}
+
+TEST(UtAstFold, BranchesWithoutConstantConditions) {
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  auto tokens = Lexer::LexSanitized(
+      "fn@sign(const int @n)>const int:{"
+      "  if (n < 0) { return 0 - 1; } elif (2 < 1) { return 9; } elif (n > 0) { return 1; } else { return 0; }"
+      "};"
+      "fn@dead(const int @n)>const int:{"
+      "  cxif (1 > 2) { return 9; };"
+      "  return n;"
+      "};"
+      "return sign(0 - 5) + sign(5) * 10 + sign(0) * 100 + dead(1000);");
+  ASSERT_TRUE(tokens.has_value());
+  std::span<const Tk> tokens_span{*tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  ASSERT_TRUE(parsed.has_value());
+  unit.trees["test"] = parsed.Extract().ast;
+  ASSERT_TRUE(unit.EvalSourceFile("test").has_value());
+  EXPECT_EQ(output.return_value, 1009);
+  EXPECT_EQ(unit.folder.PrunedClauses(), 2);
+
+  // Mixing the two forms of clauses is a syntax error.
+  auto mixed = Lexer::LexSanitized("fn@f(const int @n)>const int:{ cxif (n > 0) { return 1; } else { return 0; } };");
+  ASSERT_TRUE(mixed.has_value());
+  std::span<const Tk> mixed_span{*mixed};
+  EXPECT_TRUE(!ParseSyntax(TkCursorT{mixed_span.cbegin(), mixed_span.cend()}));
+}
+
+}  // namespace cnd_unit_test::hir::fold
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
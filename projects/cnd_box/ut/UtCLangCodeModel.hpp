@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the C code model built from the C& syntax tree, and writing its translation units.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "ProgramTestUtils.hpp"
+#include "codegen/CLangCodeModel.hpp"
+#include "compiler/Compiler.hpp"
+#include <filesystem>
+#include <fstream>
+// clang-format on
+
+namespace cnd_unit_test::codegen::code_model {
+using cnd::Path;
+using cnd::Str;
+using cnd::Symbols;
+using cnd::TrInput;
+using cnd::TrOutput;
+using cnd::Vec;
+using cnd::clang::codegen::CodeModel;
+using cnd::clang::codegen::Decl;
+using cnd::trtools::Compiler;
+using cnd_unit_test::test_util::ParsedProgram;
+using cnd_unit_test::test_util::ParseProgram;
+
+inline Str ReadFile(const Path& path) {
+  std::ifstream file{path, std::ios::binary};
+  return Str(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+}
+
+TEST(UtCLangCodeModel, WritesUnitsToOutputFiles) {
+  const ParsedProgram globals = ParseProgram("def int @a:1 + 2;def @b:a * 3;");
+  const ParsedProgram more = ParseProgram("const def int @c:sq(a, -b);");
+  auto model = CodeModel::FromCndAst(globals.ast, "globals.c");
+  ASSERT_TRUE(model.has_value());
+  ASSERT_TRUE(model->AppendAst(more.ast, "more.c").has_value());
+
+  TrInput input{};
+  input.out_dir = std::filesystem::temp_directory_path() / "UtCLangCodeModel";
+  std::filesystem::remove_all(input.out_dir);
+  std::filesystem::create_directories(input.out_dir);
+  input.codegen_threads = 2;
+  TrOutput output{};
+  auto written = model->WriteUnits(input, output);
+  ASSERT_TRUE(written.has_value());
+  EXPECT_EQ(written->written, 2);
+
+  // Units are listed in key order.
+  ASSERT_TRUE(output.output_files == (Vec<Path>{input.out_dir / "globals.c", input.out_dir / "more.c"}));
+  EXPECT_TRUE(ReadFile(output.output_files[0]) == "int a = (1 + 2);\nauto b = (a * 3);\n");
+  EXPECT_TRUE(ReadFile(output.output_files[1]) == "const int c = sq(a, (-b));\n");
+  std::filesystem::remove_all(input.out_dir);
+}
+
+TEST(UtCLangCodeModel, FindsDeclarationsByInternedName) {
+  const ParsedProgram globals = ParseProgram("def int @a:1;def @b:a;");
+  const ParsedProgram more = ParseProgram("static def int @c:b;");
+  auto model = CodeModel::FromCndAst(globals.ast, "globals.c");
+  ASSERT_TRUE(model.has_value());
+  ASSERT_TRUE(model->AppendAst(more.ast, "more.c").has_value());
+
+  // Names are looked up by the symbol the lexer interned, in whichever unit declares them.
+  const Decl* b = model->Find(Symbols().Intern("b"));
+  ASSERT_TRUE(b != nullptr);
+  EXPECT_TRUE(b->ident == "b" && b->type_name == "auto");
+  const Decl* c = model->Find(Symbols().Intern("c"));
+  ASSERT_TRUE(c != nullptr);
+  EXPECT_TRUE(c->type_name == "static int");
+  EXPECT_TRUE(model->unitmap.at("more.c").Find(c->symbol) == c);
+  EXPECT_TRUE(model->unitmap.at("globals.c").Find(c->symbol) == nullptr);
+  EXPECT_TRUE(model->Find(Symbols().Intern("undeclared")) == nullptr);
+
+  // A name declared by another unit is a duplicate.
+  EXPECT_TRUE(!model->AppendAst(ParseProgram("def int @a:2;").ast, "other.c"));
+}
+
+TEST(UtCLangCodeModel, CompilerWritesUnitsOfSourceFiles) {
+  const Path dir = std::filesystem::temp_directory_path() / "UtCLangCodeModelCompiler";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  { std::ofstream{dir / "globals.cnd", std::ios::binary} << "def int @a:1 + 2;def @b:a * 3;"; }
+
+  // Without an output directory nothing is generated.
+  TrInput input{};
+  input.src_files.push_back(dir / "globals.cnd");
+  auto evaluated = Compiler{input}.Translate();
+  ASSERT_TRUE(evaluated.has_value());
+  EXPECT_TRUE(evaluated->output_files.empty());
+
+  // Each source file is generated from its folded tree into a unit named after it.
+  input.out_dir = dir / "out";
+  auto translated = Compiler{input}.Translate();
+  ASSERT_TRUE(translated.has_value());
+  ASSERT_TRUE(translated->output_files == (Vec<Path>{input.out_dir / "globals.c"}));
+  EXPECT_TRUE(ReadFile(translated->output_files[0]) == "int a = 3;\nauto b = (a * 3);\n");
+  std::filesystem::remove_all(dir);
+}
+
+TEST(UtCLangCodeModel, RejectsWhatCannotBeGenerated) {
+  // Functions and statements have no model yet.
+  EXPECT_TRUE(!CodeModel::FromCndAst(ParseProgram("fn@f(const int @n)>const int:{return n;};").ast, "f.c"));
+  EXPECT_TRUE(!CodeModel::FromCndAst(ParseProgram("def int @a;").ast, "a.c"));
+  EXPECT_TRUE(!CodeModel::FromCndAst(ParseProgram("def int @a:1;def @a:2;").ast, "a.c"));
+}
+
+}  // namespace cnd_unit_test::codegen::code_model
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the chunked output sink of the code generators.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "codegen/CodeWriter.hpp"
+#include "codegen/CLangCodegen.hpp"
+#include "codegen/ParallelCodegen.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+// clang-format on
+
+namespace cnd_unit_test::codegen::writer {
+using cnd::Path;
+using cnd::Size;
+using cnd::Str;
+using cnd::StrView;
+using cnd::Vec;
+using cnd::clang::codegen::ClassDecl;
+using cnd::clang::codegen::CodeFilesConfig;
+using cnd::clang::codegen::CodeIndentScope;
+using cnd::clang::codegen::CodeWriter;
+using cnd::clang::codegen::EnumDecl;
+using cnd::clang::codegen::MethodDecl;
+using cnd::clang::codegen::OutputManifest;
+using cnd::clang::codegen::WriteCodeFiles;
+using cnd::clang::codegen::WriteExprList;
+
+TEST(UtCodeWriter, IndentsStartedLines) {
+  CodeWriter out{};
+  out << "struct S {\n";
+  {
+    CodeIndentScope body{out};
+    out << "int a;\n\nint b = " << 42 << ";\n";
+    WriteExprList(out, Vec<Str>{"x", "y"}, ",\n", false, "int ", ";\n");
+  }
+  out << "};\n";
+  EXPECT_TRUE(out.ToString() == "struct S {\n  int a;\n\n  int b = 42;\n  int x,\n  y;\n};\n");
+  EXPECT_EQ(out.Indentation(), 0);
+}
+
+TEST(UtCodeWriter, GeneratorsKeepTheirOutput) {
+  // The same text the string returning generators produced.
+  CodeWriter out{};
+  const ClassDecl cls{"Foo",
+                      {"Base"},
+                      {MethodDecl{.name = "f", .return_type = "int", .params = {{"int", "a"}, {"int", "b", {"2"}}},
+                                  .definition = {"return a+b;"}},
+                       MethodDecl{.name = "g"}},
+                      {"int x"}};
+  cls.Codegen(out);
+  EnumDecl{"E", "int", true, {{"A"}, {"B", "3"}}}.Codegen(out);
+  EXPECT_TRUE(out.ToString() ==
+              "class Foo : public Base {\npublic:\n    int x;\n    int f(int a, int b = 2){return a+b;}\n\n;\n"
+              "    void g();\n;\n};\n"
+              "enum class E : int {\n  A,\n  B = 3\n};\n\n");
+}
+
+TEST(UtCodeWriter, WritesAcrossChunks) {
+  CodeWriter out{};
+  const Str line(CodeWriter::kChunkSize - 1, 'a');
+  out << line << line << 'b';
+  out << Str(CodeWriter::kChunkSize * 2 + 3, 'c');
+  const Size expected = line.size() * 2 + 1 + CodeWriter::kChunkSize * 2 + 3;
+  EXPECT_EQ(out.WrittenBytes(), expected);
+  EXPECT_EQ(out.BufferedBytes(), expected);
+  const Str text = out.ToString();
+  ASSERT_EQ(text.size(), expected);
+  EXPECT_TRUE(text.compare(0, line.size() * 2, line + line) == 0);
+  EXPECT_EQ(text[line.size() * 2], 'b');
+  EXPECT_TRUE(StrView{text}.substr(line.size() * 2 + 1) == Str(CodeWriter::kChunkSize * 2 + 3, 'c'));
+}
+
+TEST(UtCodeWriter, SinkBoundsBufferedBytes) {
+  std::ostringstream sink{};
+  Str expected{};
+  {
+    CodeWriter out{sink};
+    for (int i = 0; i < 50000; i++) {
+      out << "int v" << i << " = " << i << ";\n";
+      expected += "int v" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+    }
+    out << Str(CodeWriter::kChunkSize * 3, 'z');  // Larger than a chunk, passed to the sink whole.
+    expected += Str(CodeWriter::kChunkSize * 3, 'z');
+    EXPECT_TRUE(out.PeakBufferedBytes() <= CodeWriter::kChunkSize);
+    EXPECT_EQ(out.WrittenBytes(), expected.size());
+  }  // The destructor flushes the rest.
+  EXPECT_TRUE(sink.str() == expected);
+}
+
+TEST(UtCodeWriter, ParallelFilesKeepUnitOrder) {
+  const Path dir = std::filesystem::temp_directory_path() / "UtCodeWriter";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  Vec<Path> paths{};
+  for (int i = 0; i < 32; i++) paths.push_back(dir / ("unit" + std::to_string(i) + ".c"));
+  auto write_unit = [](Size i, CodeWriter& out) {
+    for (Size line = 0; line < (i % 5 + 1) * 1000; line++) out << "int u" << i << "_" << line << ";\n";
+  };
+
+  Vec<Path> output_files{};
+  ASSERT_TRUE(WriteCodeFiles(paths, write_unit, output_files, {.threads = 4}).has_value());
+  ASSERT_TRUE(output_files == paths);
+  for (Size i = 0; i < paths.size(); i++) {
+    CodeWriter expected{};
+    write_unit(i, expected);
+    std::ifstream file{paths[i], std::ios::binary};
+    EXPECT_TRUE(Str(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}) == expected.ToString());
+  }
+
+  // A unit which cannot be written fails the whole run, and no file is listed.
+  Vec<Path> failing = paths;
+  failing[7] = dir / "missing" / "unit7.c";
+  Vec<Path> failed_files{};
+  EXPECT_TRUE(!WriteCodeFiles(failing, write_unit, failed_files, {.threads = 4}));
+  EXPECT_TRUE(failed_files.empty());
+  std::filesystem::remove_all(dir);
+}
+
+TEST(UtCodeWriter, UnchangedFilesAreNotRewritten) {
+  const Path dir = std::filesystem::temp_directory_path() / "UtCodeWriterIncremental";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  const Vec<Path> paths{dir / "a.c", dir / "b.c", dir / "c.c"};
+  Str b_text = "int b = 1;\n";
+  auto write_unit = [&](Size i, CodeWriter& out) { out << (i == 1 ? StrView{b_text} : "int same = 0;\n"); };
+  const CodeFilesConfig config{.threads = 2, .manifest = dir / "aux" / OutputManifest::kFileName};
+
+  Vec<Path> output_files{};
+  auto first = WriteCodeFiles(paths, write_unit, output_files, config);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->written, 3);
+  EXPECT_EQ(OutputManifest::Load(config.manifest).Count(), 3);
+
+  const auto a_time = std::filesystem::last_write_time(paths[0]);
+  b_text = "int b = 2;\n";
+  auto second = WriteCodeFiles(paths, write_unit, output_files, config);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(second->written, 1);
+  EXPECT_EQ(second->unchanged, 2);
+  EXPECT_TRUE(std::filesystem::last_write_time(paths[0]) == a_time);
+  std::ifstream b_file{paths[1]};
+  EXPECT_TRUE(Str(std::istreambuf_iterator<char>{b_file}, std::istreambuf_iterator<char>{}) == b_text);
+  EXPECT_EQ(output_files.size(), 6);
+
+  // Without a manifest, identical files are found by their content. A different file the compiler did not write is
+  // only replaced if overwriting is allowed.
+  std::filesystem::remove(config.manifest);
+  { std::ofstream{paths[2], std::ios::trunc} << "int user_edit;\n"; }
+  auto denied = WriteCodeFiles(paths, write_unit, output_files, config);
+  ASSERT_TRUE(!denied);
+  EXPECT_TRUE(denied.Error().Format().find("'" + paths[2].string() +
+                                           "' file path already exists. Can't use existing path for generated code") !=
+              Str::npos);
+  auto forced = WriteCodeFiles(paths, write_unit, output_files, {.is_overwrite_allowed = true});
+  ASSERT_TRUE(forced.has_value());
+  EXPECT_EQ(forced->written, 1);
+  EXPECT_EQ(forced->unchanged, 2);
+  std::filesystem::remove_all(dir);
+}
+
+}  // namespace cnd_unit_test::codegen::writer
+
+/// @} // end of cnd_unit_test
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
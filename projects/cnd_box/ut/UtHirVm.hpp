@@ -0,0 +1,262 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the compile time bytecode lowering and register virtual machine.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "hir/Compeval.hpp"
+// clang-format on
+
+namespace cnd_unit_test::hir::vm {
+using cnd::ClFail;
+using cnd::ClRes;
+using cnd::Symbols;
+using cnd::Tk;
+using cnd::TrInput;
+using cnd::TrOutput;
+using cnd::Vec;
+using cnd::hir::AV;
+using cnd::hir::eHirDispatch;
+using cnd::hir::I32;
+using cnd::hir::Namespace;
+using cnd::hir::TrUnit;
+using cnd::trtools::Lexer;
+using namespace cnd::trtools::parser;
+
+// Lexes, parses and evaluates 'src' as the only source file of a translation unit.
+inline ClRes<TrOutput> EvalSource(const char* src, eHirDispatch dispatch = cnd::hir::kDefaultHirDispatch) {
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  unit.vm.dispatch = dispatch;
+  auto tokens = Lexer::LexSanitized(src);
+  if (!tokens) return ClFail(tokens.error());
+  std::span<const Tk> tokens_span{*tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return ClFail(parsed.error());
+  unit.trees["test"] = parsed.Extract().ast;
+  auto eval_res = unit.EvalSourceFile("test");
+  if (!eval_res) return ClFail(eval_res.Error());
+  return output;
+}
+
+// Evaluates 'expr' with the Ast walker and on the virtual machine, in a unit where 'x' is defined as 6.
+inline bool VmMatchesAstWalker(const char* expr) {
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  Vec<Tk> decl_tokens = Lexer::LexSanitized("def @x:6;").value_or(Vec<Tk>{});
+  std::span<const Tk> decl_span{decl_tokens};
+  auto decl = ParseSyntax(TkCursorT{decl_span.cbegin(), decl_span.cend()});
+  if (!decl) return false;
+  unit.trees["decl"] = decl.Extract().ast;
+  if (!unit.EvalSourceFile("decl")) return false;
+
+  Vec<Tk> tokens = Lexer::LexSanitized(expr).value_or(Vec<Tk>{});
+  std::span<const Tk> tokens_span{tokens};
+  auto parsed = ParsePrimaryExpr(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  if (!parsed) return false;
+  auto walked = unit.EvalPrimaryExpr(parsed->ast, unit.global);
+  auto executed = unit.EvalExpr(parsed->ast, unit.global);
+  if (!walked || !executed || walked->TypeIndex() != executed->TypeIndex()) return false;
+  return AV::CppRef<cnd::hir::Bool>(AV::Eq(*walked, *executed)).data;
+}
+
+TEST(UtHirVm, ExpressionsMatchAstWalker) {
+  EXPECT_TRUE(VmMatchesAstWalker("1+2*3"));
+  EXPECT_TRUE(VmMatchesAstWalker("(4+5)*(6-1)"));
+  EXPECT_TRUE(VmMatchesAstWalker("100/7%5"));
+  EXPECT_TRUE(VmMatchesAstWalker("1<<4|3"));
+  EXPECT_TRUE(VmMatchesAstWalker("12^5&7"));
+  EXPECT_TRUE(VmMatchesAstWalker("7>5"));
+  EXPECT_TRUE(VmMatchesAstWalker("3<=2"));
+  EXPECT_TRUE(VmMatchesAstWalker("x*x+1==37"));
+  EXPECT_TRUE(VmMatchesAstWalker("(x-1)*(x+1)"));
+}
+
+TEST(UtHirVm, RecursiveFunction) {
+  auto result = EvalSource(
+      "fn@fib(const int @n)>const int:{"
+      "  if (n <= 1) { return n; };"
+      "  return fib(n - 1) + fib(n - 2);"
+      "};"
+      "return fib(15);");
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->return_value, 610);
+}
+
+TEST(UtHirVm, SwitchAndThreadedDispatchAgree) {
+  static constexpr const char* kSrc =
+      "fn@collatz(const int @n)>const int:{"
+      "  def int @steps:0;"
+      "  def int @x:n;"
+      "  while (x != 1) { if (x % 2 == 0) { x = x >> 1; } else { x = 3 * x + 1; } steps++; };"
+      "  return steps ^ (n & 7) | 0;"
+      "};"
+      "return collatz(27);";
+  auto switched = EvalSource(kSrc, eHirDispatch::kSwitch);
+  auto threaded = EvalSource(kSrc, eHirDispatch::kThreaded);
+  ASSERT_TRUE(switched.has_value());
+  ASSERT_TRUE(threaded.has_value());
+  ASSERT_EQ(switched->return_value, 111 ^ (27 & 7));
+  ASSERT_EQ(threaded->return_value, switched->return_value);
+}
+
+TEST(UtHirVm, LoopsLocalsAndGlobals) {
+  // 'accumulate' calls 'fibb' before its definition, and writes the global 'total'.
+  auto result = EvalSource(
+      "def @total:0;"
+      "fn@accumulate(const int @n)>const int:{"
+      "  def int @i:0;"
+      "  while (i < n) { total = total + fibb(i); i++; };"
+      "  return total;"
+      "};"
+      "fn@fibb(const int @n)>const int:{"
+      "  if (n <= 1) { return n; };"
+      "  def int @a:1;"
+      "  def int @b:2;"
+      "  for (def int @i:2; i <= n; i++) {"
+      "    def int @c:a + b;"
+      "    a = b;"
+      "    b = c;"
+      "  }"
+      "  return b;"
+      "};"
+      "return accumulate(10);");
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->return_value, 229);
+}
+
+TEST(UtHirVm, MemoizesPureCalls) {
+  // 'counted' writes a global, so only 'fib' is memoized and 'calls' still counts every call.
+  static constexpr const char* kSrc =
+      "def @calls:0;"
+      "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+      "fn@counted(const int @n)>const int:{ calls = calls + 1; return fib(n); };"
+      "return counted(30) + counted(30) + calls;";
+  auto tokens = Lexer::LexSanitized(kSrc);
+  ASSERT_TRUE(tokens.has_value());
+  std::span<const Tk> tokens_span{*tokens};
+  auto parsed = ParseSyntax(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  ASSERT_TRUE(parsed.has_value());
+
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  unit.trees["test"] = parsed.Extract().ast;
+  ASSERT_TRUE(unit.EvalSourceFile("test").has_value());
+  EXPECT_EQ(output.return_value, 2 * 832040 + 2);
+  EXPECT_TRUE(unit.program.functions[*unit.program.FindFunction(Symbols().Intern("fib"))].is_pure);
+  EXPECT_TRUE(!unit.program.functions[*unit.program.FindFunction(Symbols().Intern("counted"))].is_pure);
+  EXPECT_EQ(unit.vm.MemoCount(), 31);  // fib(0) to fib(30), the second counted(30) hits fib(30).
+  EXPECT_TRUE(unit.vm.MemoBytes() <= unit.vm.memo_budget);
+
+  // Memoization does not change results.
+  auto unmemoized = EvalSource(
+      "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+      "return fib(18);");
+  auto memoized = EvalSource(
+      "fn@fib(const int @n)>const int:{ if (n <= 1) { return n; }; return fib(n - 1) + fib(n - 2); };"
+      "return fib(18) + fib(18) - fib(18);");
+  ASSERT_TRUE(unmemoized.has_value());
+  ASSERT_TRUE(memoized.has_value());
+  EXPECT_EQ(memoized->return_value, unmemoized->return_value);
+}
+
+TEST(UtHirVm, RejectsInvalidPrograms) {
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{return n;};fn@f(const int @n)>const int:{return n;};"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{return g(n);};"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{return n;};return f(1, 2);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{return f(n);};return f(1);"));
+  EXPECT_TRUE(!EvalSource("def @a:1;def @a:2;"));
+}
+
+TEST(UtHirVm, LocalModifiersAndTypeConstraints) {
+  auto typed = EvalSource(
+      "fn@f(const int @n)>const int:{"
+      "  const def int @k:n * 2;"
+      "  def int @z;"
+      "  def bool @b:n > 0;"
+      "  z = z + k;"
+      "  return z + 1;"
+      "};"
+      "return f(4);");
+  ASSERT_TRUE(typed.has_value());
+  EXPECT_EQ(typed->return_value, 9);
+
+  // Const locals are not written, and a value of another type is rejected when it is stored.
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ const def @k:n; k = 1; return k; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ const def @k:n; k++; return k; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ const def @k; return n; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ def int @k:n < 2; return n; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ def int @k:n; k = n > 0; return n; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ def bool @k:n; return n; };return f(1);"));
+
+  // Modifiers and constraints the evaluator has no meaning for are diagnosed instead of ignored.
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ static def @k:n; return k; };return f(1);"));
+  EXPECT_TRUE(!EvalSource("fn@f(const int @n)>const int:{ def str @k:n; return n; };return f(1);"));
+}
+
+TEST(UtHirVm, NamespacesResolveToSlots) {
+  const auto sym_a = Symbols().Intern("a");
+  const auto sym_b = Symbols().Intern("b");
+  Namespace outer{.parent = nullptr, .ident = "outer"};
+  Namespace inner{.parent = &outer, .ident = "inner"};
+  const auto a = outer.DeclareVariable(sym_a);
+  const auto b = outer.DeclareVariable(sym_b);
+  inner.DeclareVariable(sym_a);
+  AV* bound = &outer.vars[b];
+  for (int i = 0; i < 1000; i++) outer.DeclareVariable(Symbols().Intern("v" + std::to_string(i)));
+  EXPECT_EQ(outer.DeclareVariable(sym_a), a);
+  EXPECT_TRUE(bound == &outer.vars[b]);  // Slots never move, globals of the program are bound to them.
+
+  outer.vars[b] = AV::Make<I32>(5);
+  auto found = inner.ResolveVariableSlot(sym_b);
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(found->depth, 1);
+  EXPECT_EQ(found->slot, b);
+  EXPECT_EQ(AV::CppRef<I32>(inner.At(*found)).data, 5);
+
+  // Inner declarations shadow outer ones.
+  auto shadowed = inner.ResolveVariableSlot(sym_a);
+  ASSERT_TRUE(shadowed.has_value());
+  EXPECT_EQ(shadowed->depth, 0);
+  EXPECT_TRUE(!inner.ResolveVariableSlot(Symbols().Intern("c")));
+}
+
+}  // namespace cnd_unit_test::hir::vm
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
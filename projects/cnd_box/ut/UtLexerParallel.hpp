@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests chunked parallel lexing against the serial lexer.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "LexerTestUtils.hpp"
+#include "frontend/lexer.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::lexer_parallel {
+using cnd::Size;
+using cnd::Str;
+using cnd::StrView;
+using cnd::Tk;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using cnd_unit_test::test_util::IsTkIdentical;
+
+// Fragments with strings and comments which span lines and hold chars that open other tokens.
+inline Str MakeParallelTestSource(Size min_size) {
+  static constexpr const char* kFragments[] = {
+      "def @a:12;\n",
+      "  \t\n",
+      "`line \" comment /` with an opening quote and block comment\n",
+      "/` block \"\n\n comment `/\n",
+      "while(a<10){ std::msg(\"str\\\"in\ng\\\\\"); a=b+3.14f;}\n",
+      "def @x: 1b + 42u + 7c;\n",
+      "\n\r\n",
+      "def @q: \"\\\\\";\n",
+      "/`x``/\n",
+  };
+  Str src;
+  for (Size i = 0; src.size() < min_size; i = (i * 7 + 3) % std::size(kFragments)) src += kFragments[i];
+  return src;
+}
+
+TEST(UtLexerParallel, SplitsAreTokenStarts) {
+  const Str src = MakeParallelTestSource(Lexer::kParallelMinChunkSize * 8);
+  auto serial = Lexer::Lex(src);
+  ASSERT_TRUE(serial.has_value());
+  const Vec<Size> splits = Lexer::FindParallelSplits(src, 8);
+  ASSERT_TRUE(splits.size() > 2);
+  EXPECT_TRUE(splits.front() == 0 && splits.back() == src.size());
+  for (Size k = 1; k + 1 < splits.size(); k++) {
+    const char* split = src.data() + splits[k];
+    EXPECT_TRUE(split[-1] == '\n');
+    EXPECT_TRUE(
+        std::any_of(serial->begin(), serial->end(), [split](const Tk& tk) { return tk.literal_.data() == split; }));
+  }
+}
+
+TEST(UtLexerParallel, MatchesSerial) {
+  const Str src = MakeParallelTestSource(Lexer::kParallelMinChunkSize * 8);
+  auto expected = Lexer::Lex(src);
+  ASSERT_TRUE(expected.has_value());
+  for (unsigned threads : {1u, 2u, 3u, 8u}) {
+    auto actual = Lexer::LexParallel(src, threads);
+    ASSERT_TRUE(actual.has_value());
+    ASSERT_EQ(actual->size(), expected->size());
+    for (Size i = 0; i < actual->size(); i++) EXPECT_TRUE(IsTkIdentical((*actual)[i], (*expected)[i]));
+  }
+}
+
+TEST(UtLexerParallel, FailsLikeSerial) {
+  Str src = MakeParallelTestSource(Lexer::kParallelMinChunkSize * 4);
+  src += "/` unterminated block comment\n";
+  EXPECT_TRUE(!Lexer::Lex(src).has_value());
+  EXPECT_TRUE(!Lexer::LexParallel(src, 4).has_value());
+}
+
+}  // namespace cnd_unit_test::frontend::lexer_parallel
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
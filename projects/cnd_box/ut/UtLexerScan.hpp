@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the vectorized source run scanner against the scalar lexer.
+///
+/// Every scanning mode must produce a token stream identical to the scalar mode, down to the literal views and
+/// line/col fields.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "LexerTestUtils.hpp"
+#include "frontend/lexer.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::lexer_scan {
+using namespace cnd::trtools::srcscan;
+using cnd::Str;
+using cnd::StrView;
+using cnd::Tk;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using cnd_unit_test::test_util::IsTkIdentical;
+
+// Mixed source covering every run kind, long enough to cross several 32 byte blocks.
+inline constexpr const char* kScanTestSource =
+    "`Fibonacci series: the sum of two elements defines the next\n"
+    "def @alpha_beta_gamma_delta_epsilon_zeta_eta_theta:1;\r\n"
+    "def @b:2;   \t\t   \v\f\n"
+    "while (alpha_beta_gamma_delta_epsilon_zeta_eta_theta < 1234567890123456789012345678901234567890){\n"
+    "\tstd::msg(\"a string literal which is long enough to span a few vector blocks\");\n"
+    "\tdef @c:b; a = b; b = a + c; def @r: 3.14159265358979323846264338327950288419716939937510;\n"
+    "}\n"
+    "/` block comment with a ` stray backtick and more than thirty two characters of body `/\n";
+
+template <eScanRun RUN>
+inline bool IsRunIdenticalAtEachOffset(StrView src) {
+  const char* end = src.data() + src.size();
+  for (const char* it = src.data(); it != end; it++) {
+    const char* expected = detail::ScanRunScalar<RUN>(it, end);
+    for (eScanIsa isa : {eScanIsa::kScalar, eScanIsa::kSse2, eScanIsa::kAvx2}) {
+      SetScanIsa(isa);
+      if (ScanRun<RUN>(it, end) != expected) return false;
+    }
+  }
+  SetScanIsa(DetectScanIsa());
+  return true;
+}
+
+TEST(UtLexerScan, RunsMatchScalar) {
+  Str src = kScanTestSource;
+  for (int i = 0; i < 256; i++) src.push_back(static_cast<char>(i));  // Every byte value, including high bit chars.
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kAlnumus>(src));
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kNumeric>(src));
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kWhitespace>(src));
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kNewline>(src));
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kNotNewline>(src));
+  EXPECT_TRUE(IsRunIdenticalAtEachOffset<eScanRun::kNotBacktick>(src));
+}
+
+TEST(UtLexerScan, LexIdenticalAcrossIsa) {
+  SetScanIsa(eScanIsa::kScalar);
+  auto expected = Lexer::Lex(kScanTestSource);
+  ASSERT_TRUE(expected.has_value());
+  for (eScanIsa isa : {eScanIsa::kSse2, eScanIsa::kAvx2}) {
+    SetScanIsa(isa);
+    auto actual = Lexer::Lex(kScanTestSource);
+    ASSERT_TRUE(actual.has_value());
+    ASSERT_EQ(actual->size(), expected->size());
+    for (cnd::Size i = 0; i < actual->size(); i++) EXPECT_TRUE(IsTkIdentical((*actual)[i], (*expected)[i]));
+  }
+  SetScanIsa(DetectScanIsa());
+}
+
+}  // namespace cnd_unit_test::frontend::lexer_scan
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests SSA construction of the low level IR and the optimization passes over it.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "ProgramTestUtils.hpp"
+#include "hir/Compeval.hpp"
+#include "lir/LirBuild.hpp"
+#include "lir/LirPasses.hpp"
+// clang-format on
+
+namespace cnd_unit_test::lir {
+using cnd::Ast;
+using cnd::ClRes;
+using cnd::I64;
+using cnd::Symbols;
+using cnd::TrInput;
+using cnd::TrOutput;
+using cnd::Vec;
+using cnd::hir::TrUnit;
+using cnd::lir::eLirOp;
+using cnd::lir::LirBuilder;
+using cnd::lir::LirEliminateDeadCode;
+using cnd::lir::LirExecute;
+using cnd::lir::LirFunction;
+using cnd::lir::LirModule;
+using cnd::lir::LirPassManager;
+using cnd::lir::LirVerify;
+using cnd_unit_test::test_util::kLirFunctions;
+using cnd_unit_test::test_util::ParsedProgram;
+using cnd_unit_test::test_util::ParseProgram;
+
+// Result of calling function 'name' of 'module' with 'args', or -1 if it fails.
+inline I64 Call(const LirModule& module, const char* name, Vec<I64> args) {
+  auto fn = module.FindFunction(Symbols().Intern(name));
+  if (!fn) return -1;
+  auto result = LirExecute(module, *fn, args);
+  return result ? *result : -1;
+}
+
+// Return value of 'call' evaluated after 'kLirFunctions' on the compile time virtual machine.
+inline I64 EvalOnVm(const char* call) {
+  const cnd::Str src = cnd::Str{kLirFunctions} + "return " + call + ";";
+  ParsedProgram program = ParseProgram(src.c_str());
+  TrInput input{};
+  TrOutput output{};
+  TrUnit unit{input, output};
+  unit.trees["test"] = std::move(program.ast);
+  if (!unit.EvalSourceFile("test")) return -2;
+  return output.return_value;
+}
+
+inline cnd::Size CountOps(const LirFunction& fn, eLirOp op) {
+  cnd::Size count = 0;
+  for (const auto& block : fn.blocks) {
+    for (const auto& phi : block.phis) count += phi.op == op;
+    for (const auto& inst : block.insts) count += inst.op == op;
+  }
+  return count;
+}
+
+TEST(UtLir, BuildsVerifiedSsa) {
+  ParsedProgram program = ParseProgram(kLirFunctions);
+  auto module = LirBuilder::Build(program.ast);
+  ASSERT_TRUE(module.has_value());
+  EXPECT_EQ(module->functions.size(), 7);
+  for (const LirFunction& fn : module->functions) EXPECT_TRUE(LirVerify(fn).has_value());
+
+  // Variables assigned in a loop are merged by phis at its header.
+  const LirFunction& collatz = module->functions[*module->FindFunction(Symbols().Intern("collatz"))];
+  EXPECT_TRUE(CountOps(collatz, eLirOp::kPhi) >= 2);
+
+  // Names must resolve to a local or parameter, calls to a function of the program.
+  EXPECT_TRUE(!LirBuilder::Build(ParseProgram("fn@f(const int @n)>const int:{ return m; };").ast));
+  EXPECT_TRUE(!LirBuilder::Build(ParseProgram("fn@f(const int @n)>const int:{ return g(n); };").ast));
+  EXPECT_TRUE(!LirBuilder::Build(
+      ParseProgram("fn@f(const int @n)>const int:{ return n; };fn@g(const int @n)>const int:{ return f(n, 1); };")
+          .ast));
+}
+
+TEST(UtLir, MatchesVirtualMachine) {
+  ParsedProgram program = ParseProgram(kLirFunctions);
+  auto module = LirBuilder::Build(program.ast);
+  ASSERT_TRUE(module.has_value());
+  EXPECT_EQ(Call(*module, "fib", {15}), EvalOnVm("fib(15)"));
+  EXPECT_EQ(Call(*module, "sumsq", {10}), EvalOnVm("sumsq(10)"));
+  EXPECT_EQ(Call(*module, "collatz", {27}), EvalOnVm("collatz(27)"));
+  EXPECT_EQ(Call(*module, "sign", {-5}) + Call(*module, "sign", {5}) * 10, EvalOnVm("sign(0 - 5) + sign(5) * 10"));
+  EXPECT_EQ(Call(*module, "shared", {2, 3}), EvalOnVm("shared(2, 3)"));
+}
+
+TEST(UtLir, PassesKeepResults) {
+  ParsedProgram program = ParseProgram(kLirFunctions);
+  auto module = LirBuilder::Build(program.ast);
+  ASSERT_TRUE(module.has_value());
+  const cnd::Size unoptimized = module->InstCount();
+  LirPassManager passes = LirPassManager::MakeDefault();
+  ASSERT_TRUE(passes.Run(*module, 8, true).has_value());
+  EXPECT_TRUE(module->InstCount() < unoptimized);
+
+  EXPECT_EQ(Call(*module, "fib", {15}), 610);
+  EXPECT_EQ(Call(*module, "sumsq", {10}), 291);
+  EXPECT_EQ(Call(*module, "collatz", {27}), 111 ^ (27 & 7));
+  EXPECT_EQ(Call(*module, "sign", {-5}), -1);
+  EXPECT_EQ(Call(*module, "shared", {2, 3}), 33);
+
+  // 'sq' is inlined into the loop, 'fib' calls itself and is not.
+  const auto& sumsq = module->functions[*module->FindFunction(Symbols().Intern("sumsq"))];
+  const auto& fib = module->functions[*module->FindFunction(Symbols().Intern("fib"))];
+  EXPECT_EQ(CountOps(sumsq, eLirOp::kCall), 0);
+  EXPECT_EQ(CountOps(fib, eLirOp::kCall), 2);
+
+  // 'a + b' and 'b + a' are computed once, the unused product is removed and the branch on 'c' is resolved.
+  const auto& shared = module->functions[*module->FindFunction(Symbols().Intern("shared"))];
+  EXPECT_EQ(CountOps(shared, eLirOp::kAdd), 2);
+  EXPECT_EQ(CountOps(shared, eLirOp::kMul), 1);
+  EXPECT_EQ(CountOps(shared, eLirOp::kBranch), 0);
+  EXPECT_EQ(shared.blocks.size(), 1);
+}
+
+TEST(UtLir, DeadCodeKeepsValidSsa) {
+  // Everything computed before the branch is unused, and so is the division by the constant 'k' after it.
+  ParsedProgram program = ParseProgram(
+      "fn@dead(const int @n)>const int:{"
+      "  def int @u:n * 3;"
+      "  def int @k:7;"
+      "  if (n > 0) { def int @t:(n + 1) % k; };"
+      "  return n;"
+      "};");
+  auto module = LirBuilder::Build(program.ast);
+  ASSERT_TRUE(module.has_value());
+  LirFunction& dead = module->functions.front();
+  EXPECT_TRUE(LirEliminateDeadCode(dead) > 0);
+  EXPECT_TRUE(LirVerify(dead).has_value());
+  EXPECT_EQ(CountOps(dead, eLirOp::kMod), 0);
+  EXPECT_EQ(Call(*module, "dead", {4}), 4);
+}
+
+TEST(UtLir, ReportsPassTimings) {
+  ParsedProgram program = ParseProgram(kLirFunctions);
+  auto module = LirBuilder::Build(program.ast);
+  ASSERT_TRUE(module.has_value());
+  LirPassManager passes = LirPassManager::MakeDefault();
+  ASSERT_TRUE(passes.Run(*module).has_value());
+  ASSERT_EQ(passes.Timings().size(), 6);
+  for (const auto& timing : passes.Timings()) {
+    EXPECT_EQ(timing.runs, passes.Rounds());
+    EXPECT_TRUE(timing.Milliseconds() >= 0.0);
+  }
+  EXPECT_TRUE(passes.Timings().front().name == "inline");
+  EXPECT_TRUE(passes.Timings().front().changes > 0);
+  EXPECT_TRUE(passes.FormatTimings().find("cse") != cnd::Str::npos);
+
+  // The pipeline stops at the first round which changes nothing.
+  const cnd::Size rounds = passes.Rounds();
+  ASSERT_TRUE(passes.Run(*module).has_value());
+  EXPECT_EQ(passes.Rounds(), rounds + 1);
+}
+
+}  // namespace cnd_unit_test::lir
+
+/// @} // end of cnd_unit_test
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
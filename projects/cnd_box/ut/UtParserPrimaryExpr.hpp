@@ -584,6 +584,53 @@ TEST(UtParserPrimaryExprGrammar, ParseListFold) {
   /// Summation -> Production
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/* UtParserPrimaryExprPratt : The Pratt and the recursive descent expression parsers must produce identical trees.   */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline LLPrsResT ParsePrimaryExprRecursiveDescent(TkCursorT c) {
+  detail::ExprParserScope selected{detail::eExprParser::kRecursiveDescent};
+  return ParsePrimaryExpr(c);
+}
+
+inline LLPrsResT ParsePrimaryExprPratt(TkCursorT c) {
+  detail::ExprParserScope selected{detail::eExprParser::kPratt};
+  return ParsePrimaryExpr(c);
+}
+
+inline void TestPrattMatchesRecursiveDescent(std::string_view code) {
+  auto source = cnd::trtools::Lexer::LexSanitized(code);
+  ASSERT_TRUE(source.has_value());
+  std::span<const cnd::Tk> src_view = *source;
+  auto recursive = ParsePrimaryExprRecursiveDescent(TkCursorT{src_view.cbegin(), src_view.cend()});
+  auto pratt = ParsePrimaryExprPratt(TkCursorT{src_view.cbegin(), src_view.cend()});
+  ASSERT_EQ(pratt.has_value(), recursive.has_value());
+  if (!pratt) return;
+  EXPECT_TRUE(pratt->head.Iter() == recursive->head.Iter());
+  EXPECT_TRUE(pratt->ast == recursive->ast);
+}
+
+TEST(UtParserPrimaryExprPratt, TopDownExpressions) {
+  for (const char* code : {"1", "(1)", "[1]", "{1}", "1 + 1", "1 + 2 * 3", "1 * 2 + 3", "1 + 2 - 3", "a.b.c.d",
+                           "(1+2)*3", "!a", "!!a", "a=b=c", "x=a=b=c", "!1+2", "!a.b", "1+!2", "a()", "!a()",
+                           "!!a()()", "a()+2", "a().b", "a.b()", "1+a()", "a.b().c.d", "foo.bar()*1+1",
+                           "(foo.bar() + 1) * 1", "foo = 1 + 2", "a+b+c+d()", "foo(a, b, c)", "foo[a, b, c]",
+                           "foo{a,b,c}", "foo::bar", "-1", "-1+2", "-1 - -1", "+1", "+1+2", "+1 + +1"})
+    TestPrattMatchesRecursiveDescent(code);
+}
+
+TEST(UtParserPrimaryExprPratt, EveryPrecedenceLevel) {
+  for (const char* code : {"a , b = c || d && e | f ^ g & h == i < j <=> k << l + m * n",
+                           "a * b + c << d <=> e < f == g & h ^ i | j && k || l = m , n",
+                           "a = b + c = d", "a < b > c <= d >= e", "a == b != c", "a >> b << c", "a / b % c * d",
+                           "f(a = b, c || d)[e & f]{g <=> h}", "(a , b) = [c = d = e]"})
+    TestPrattMatchesRecursiveDescent(code);
+}
+
+TEST(UtParserPrimaryExprPratt, InvalidExpressionsFailInBoth) {
+  for (const char* code : {"a +", "a + * b", "a = ", "(a , )"}) TestPrattMatchesRecursiveDescent(code);
+}
+
 }  // namespace cnd_unit_test::frontend::parser
 /// @} // end of cnd_unit_test
 
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the parser scope searches which scan for the closer of a bracket.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "frontend/Parser.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::parser_scopes {
+using cnd::eTk;
+using cnd::Tk;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using namespace cnd::trtools::parser;
+
+inline Vec<Tk> LexForScopes(const char* src) {
+  auto tokens = Lexer::LexSanitized(src);
+  return tokens ? std::move(*tokens) : Vec<Tk>{};
+}
+
+// A closer inside the scope used to be checked against the opener, so every nested scope was "Mismatched scopes".
+TEST(UtParserScopes, NestedScopes) {
+  Vec<Tk> tokens = LexForScopes("((a),[b,{c}])d");
+  std::span<const Tk> tokens_span{tokens};
+  auto paren = FindParen(TkCursorT{tokens_span.cbegin(), tokens_span.cend()});
+  ASSERT_TRUE(paren.has_value());
+  EXPECT_TRUE(paren->Begin() == tokens_span.cbegin());
+  EXPECT_TRUE(paren->ContainedEnd()->TypeIs(eTk::kRParen));
+  EXPECT_TRUE(paren->End()->TypeIs(eTk::kIdent));
+
+  EXPECT_TRUE(!FindParen(TkCursorT{tokens_span.cbegin(), tokens_span.cbegin() + 4}).has_value());
+  Vec<Tk> mismatched = LexForScopes("(a,[b)]");
+  std::span<const Tk> mismatched_span{mismatched};
+  EXPECT_TRUE(!FindParen(TkCursorT{mismatched_span.cbegin(), mismatched_span.cend()}).has_value());
+}
+
+// The scan used to start after the opener, so it took the first token in the brackets for the opener.
+TEST(UtParserScopes, BracketScopeStartsAtOpener) {
+  Vec<Tk> tokens = LexForScopes("[a][b[c]]");
+  std::span<const Tk> tokens_span{tokens};
+  TkCursorT crsr{tokens_span.cbegin(), tokens_span.cend()};
+  auto single = FindBracket(crsr);
+  ASSERT_TRUE(single.has_value());
+  EXPECT_TRUE(single->Begin() == crsr.Iter());
+  EXPECT_TRUE(single->ContainedEnd()->TypeIs(eTk::kRBracket));
+
+  TkCursorT nested_crsr{single->End(), tokens_span.cend()};
+  auto nested = FindBracket(nested_crsr);
+  ASSERT_TRUE(nested.has_value());
+  EXPECT_TRUE(nested->Begin() == nested_crsr.Iter());
+  EXPECT_TRUE(nested->ContainedEnd() == tokens_span.cbegin() + 8);
+}
+
+}  // namespace cnd_unit_test::frontend::parser_scopes
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests source file loading through the SourceManager and LoadSourceFile.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "compiler_utils/LoadSourceFile.hpp"
+#include "compiler_utils/SourceManager.hpp"
+#include "frontend/lexer.hpp"
+// clang-format on
+
+namespace cnd_unit_test::compiler_utils::source_manager {
+using cnd::Size;
+using cnd::Str;
+using cnd::StrView;
+using cnd::trtools::kSourcePadding;
+using cnd::trtools::Lexer;
+using cnd::trtools::LoadSourceFile;
+using cnd::trtools::SourceManager;
+
+inline constexpr StrView kSourceManagerTestSource = "def @a:1;\ndef @b:a;\n";
+
+// Writes 'text' to a file under the working directory and returns its path.
+inline Str WriteSourceManagerTestFile(StrView name, StrView text) {
+  std::filesystem::create_directory("_ut_source_manager");
+  Str path = "_ut_source_manager/" + Str{name};
+  std::ofstream{path, std::ios::binary}.write(text.data(), static_cast<std::streamsize>(text.size()));
+  return path;
+}
+
+TEST(UtSourceManager, LoadsOnceWithPadding) {
+  const Str path = WriteSourceManagerTestFile("a.cnd", kSourceManagerTestSource);
+  SourceManager sources;
+  auto id = sources.Load(path);
+  ASSERT_TRUE(id.has_value());
+  EXPECT_TRUE(*id != SourceManager::kNoFile);
+  EXPECT_TRUE(sources.Text(*id) == kSourceManagerTestSource);
+  for (Size i = 0; i < kSourcePadding; i++) EXPECT_TRUE(sources.Text(*id).data()[sources.Text(*id).size() + i] == '\0');
+
+  // Loading the same path again, even spelled differently, returns the same id and bytes.
+  const char* first_data = sources.Text(*id).data();
+  auto again = sources.Load("_ut_source_manager/./a.cnd");
+  ASSERT_TRUE(again.has_value());
+  EXPECT_TRUE(*again == *id);
+  EXPECT_TRUE(sources.Count() == 1);
+  EXPECT_TRUE(sources.Text(*again).data() == first_data);
+}
+
+TEST(UtSourceManager, ViewsStayStable) {
+  SourceManager sources;
+  auto first = sources.Load(WriteSourceManagerTestFile("first.cnd", kSourceManagerTestSource));
+  ASSERT_TRUE(first.has_value());
+  const StrView first_text = sources.Text(*first);
+  const StrView first_path = sources.PathOf(*first);
+  for (int i = 0; i < 32; i++) {
+    auto id = sources.Load(WriteSourceManagerTestFile("f" + std::to_string(i) + ".cnd", kSourceManagerTestSource));
+    ASSERT_TRUE(id.has_value());
+  }
+  EXPECT_TRUE(sources.Text(*first).data() == first_text.data());
+  EXPECT_TRUE(sources.PathOf(*first).data() == first_path.data());
+}
+
+TEST(UtSourceManager, TokensCarryFileId) {
+  SourceManager sources;
+  sources.Load(WriteSourceManagerTestFile("other.cnd", kSourceManagerTestSource));
+  auto id = sources.Load(WriteSourceManagerTestFile("b.cnd", kSourceManagerTestSource));
+  ASSERT_TRUE(id.has_value());
+  auto tokens = Lexer::LexSanitized(sources.Text(*id), *id);
+  ASSERT_TRUE(tokens.has_value());
+  ASSERT_TRUE(!tokens->empty());
+  for (const auto& tk : *tokens) EXPECT_TRUE(tk.file_ == *id);
+}
+
+TEST(UtSourceManager, MissingFileFails) {
+  SourceManager sources;
+  EXPECT_TRUE(!sources.Load("_ut_source_manager/does_not_exist.cnd").has_value());
+  EXPECT_TRUE(sources.Count() == 0);
+}
+
+TEST(UtSourceManager, LoadSourceFileTerminates) {
+  auto loaded = LoadSourceFile<char>(WriteSourceManagerTestFile("c.cnd", kSourceManagerTestSource));
+  ASSERT_TRUE(loaded.has_value());
+  ASSERT_EQ(loaded->size(), kSourceManagerTestSource.size() + 1);
+  EXPECT_TRUE(loaded->back() == '\0');
+  EXPECT_TRUE(StrView(loaded->data()) == kSourceManagerTestSource);
+}
+
+}  // namespace cnd_unit_test::compiler_utils::source_manager
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests identifier interning in the SymbolTable and the symbols stamped into lexed tokens.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "compiler_utils/SymbolTable.hpp"
+#include "frontend/lexer.hpp"
+// clang-format on
+
+namespace cnd_unit_test::compiler_utils::symbol_table {
+using cnd::eTk;
+using cnd::kNoSymbol;
+using cnd::Size;
+using cnd::Str;
+using cnd::SymbolId;
+using cnd::SymbolTable;
+using cnd::Symbols;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+
+TEST(UtSymbolTable, InternsOncePerName) {
+  SymbolTable table;
+  const SymbolId foo = table.Intern("foo");
+  EXPECT_TRUE(foo != kNoSymbol);
+  EXPECT_TRUE(table.Intern(Str{"foo"}) == foo);
+  EXPECT_TRUE(table.Intern("bar") != foo);
+  EXPECT_TRUE(table.Find("foo") == foo);
+  EXPECT_TRUE(table.Find("baz") == kNoSymbol);
+  EXPECT_TRUE(table.Name(foo) == "foo");
+  EXPECT_TRUE(table.Count() == 2);
+}
+
+TEST(UtSymbolTable, NamesOutliveTheirSource) {
+  SymbolTable table;
+  Vec<SymbolId> ids{};
+  for (Size i = 0; i < 1000; i++) ids.push_back(table.Intern(Str{"name"} + std::to_string(i)));
+  for (Size i = 0; i < ids.size(); i++) EXPECT_TRUE(table.Name(ids[i]) == Str{"name"} + std::to_string(i));
+}
+
+TEST(UtSymbolTable, ConcurrentInterningAgrees) {
+  SymbolTable table;
+  Vec<Vec<SymbolId>> seen(4);
+  Vec<std::thread> threads{};
+  for (Size t = 0; t < seen.size(); t++)
+    threads.emplace_back([&table, &ids = seen[t]] {
+      for (Size i = 0; i < 500; i++) ids.push_back(table.Intern("s" + std::to_string(i % 100)));
+    });
+  for (auto& thread : threads) thread.join();
+  EXPECT_TRUE(table.Count() == 100);
+  for (const auto& ids : seen) EXPECT_TRUE(ids == seen[0]);
+}
+
+TEST(UtSymbolTable, LexerStampsIdentifiers) {
+  auto first = Lexer::LexSanitized("def @count:1;def @total:count;");
+  auto second = Lexer::LexSanitized("fn@f(const int @count)>const int:{return count;};");
+  ASSERT_TRUE(first.has_value() && second.has_value());
+  SymbolId count = kNoSymbol;
+  for (const auto& tk : *first) {
+    if (tk.TypeIs(eTk::kIdent)) {
+      EXPECT_TRUE(tk.Symbol() == Symbols().Find(tk.Literal()));
+      if (tk.Literal() == "count") count = tk.Symbol();
+    } else {
+      EXPECT_TRUE(tk.Symbol() == kNoSymbol);
+    }
+  }
+  ASSERT_TRUE(count != kNoSymbol);
+  // The same name lexed from another source has the same id.
+  for (const auto& tk : *second)
+    if (tk.TypeIs(eTk::kIdent) && tk.Literal() == "count") EXPECT_TRUE(tk.Symbol() == count);
+}
+
+}  // namespace cnd_unit_test::compiler_utils::symbol_table
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the bracket match index and the parser scope searches which consult it.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "frontend/Parser.hpp"
+#include "frontend/tk_match_index.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::tk_match_index {
+using cnd::eTk;
+using cnd::Size;
+using cnd::Tk;
+using cnd::TkMatchIndex;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+using namespace cnd::trtools::parser;
+
+inline Vec<Tk> LexForMatchIndex(const char* src) {
+  auto tokens = Lexer::LexSanitized(src);
+  return tokens ? std::move(*tokens) : Vec<Tk>{};
+}
+
+TEST(UtTkMatchIndex, MatchesNestedPairs) {
+  // 0 1 2 3 4 5 6 7 8 9 10 11
+  // f ( a [ 1 ] , { b } )  ;
+  Vec<Tk> tokens = LexForMatchIndex("f(a[1],{b});");
+  ASSERT_TRUE(tokens.size() >= 12);
+  TkMatchIndex index{std::span<const Tk>{tokens}};
+  ASSERT_EQ(index.Count(), tokens.size());
+  EXPECT_TRUE(index.MatchOf(1) == 10);
+  EXPECT_TRUE(index.MatchOf(10) == 1);
+  EXPECT_TRUE(index.MatchOf(3) == 5);
+  EXPECT_TRUE(index.MatchOf(5) == 3);
+  EXPECT_TRUE(index.MatchOf(7) == 9);
+  EXPECT_TRUE(index.MatchOf(9) == 7);
+  EXPECT_TRUE(index.MatchOf(0) == TkMatchIndex::kNoMatch);
+  EXPECT_TRUE(index.MatchOf(11) == TkMatchIndex::kNoMatch);
+}
+
+TEST(UtTkMatchIndex, MalformedScopesHaveNoMatch) {
+  // 0 1 2 3 4 5 6
+  // ( [ a ) ] { b
+  Vec<Tk> tokens = LexForMatchIndex("([a)]{b");
+  ASSERT_TRUE(tokens.size() >= 7);
+  TkMatchIndex index{std::span<const Tk>{tokens}};
+  EXPECT_TRUE(index.MatchOf(0) == TkMatchIndex::kNoMatch);
+  EXPECT_TRUE(index.MatchOf(1) == TkMatchIndex::kNoMatch);
+  EXPECT_TRUE(index.MatchOf(3) == TkMatchIndex::kNoMatch);
+  EXPECT_TRUE(index.MatchOf(4) == TkMatchIndex::kNoMatch);
+  EXPECT_TRUE(index.MatchOf(5) == TkMatchIndex::kNoMatch);
+}
+
+TEST(UtTkMatchIndex, ScopeSearchesAgreeWithScan) {
+  Vec<Tk> tokens = LexForMatchIndex("(a,(b,c),[d,{e,f}],g(h,i)){j;k(l);}[m,n]");
+  std::span<const Tk> tokens_span{tokens};
+  TkCursorT paren{tokens_span.cbegin(), tokens_span.cend()};
+
+  // Without an active index every search scans.
+  auto scanned_paren = FindParen(paren);
+  auto scanned_args = FindSeperatedParen(paren.Iter(), paren.End(), eTk::kComma);
+  ASSERT_TRUE(scanned_paren.has_value());
+  ASSERT_TRUE(scanned_args.has_value());
+
+  TkMatchIndex index{tokens_span};
+  detail::TkMatchIndexScope index_scope{index};
+  auto indexed_paren = FindParen(paren);
+  auto indexed_args = FindSeperatedParen(paren.Iter(), paren.End(), eTk::kComma);
+  ASSERT_TRUE(indexed_paren.has_value());
+  ASSERT_TRUE(indexed_args.has_value());
+
+  EXPECT_TRUE(indexed_paren->Begin() == scanned_paren->Begin());
+  EXPECT_TRUE(indexed_paren->End() == scanned_paren->End());
+  ASSERT_EQ(indexed_args->size(), scanned_args->size());
+  ASSERT_EQ(indexed_args->size(), Size{4});
+  for (Size i = 0; i < indexed_args->size(); i++) {
+    EXPECT_TRUE((*indexed_args)[i].Begin() == (*scanned_args)[i].Begin());
+    EXPECT_TRUE((*indexed_args)[i].End() == (*scanned_args)[i].End());
+  }
+
+  TkCursorT brace{indexed_paren->End(), tokens_span.cend()};
+  auto indexed_brace = FindBrace(brace);
+  ASSERT_TRUE(indexed_brace.has_value());
+  EXPECT_TRUE(indexed_brace->ContainedEnd()->TypeIs(eTk::kRBrace));
+
+  TkCursorT bracket{indexed_brace->End(), tokens_span.cend()};
+  auto indexed_bracket = FindBracket(bracket);
+  ASSERT_TRUE(indexed_bracket.has_value());
+  EXPECT_TRUE(indexed_bracket->Begin() == bracket.Iter());
+  EXPECT_TRUE(indexed_bracket->ContainedEnd()->TypeIs(eTk::kRBracket));
+}
+
+TEST(UtTkMatchIndex, MismatchedScopeStillFails) {
+  Vec<Tk> tokens = LexForMatchIndex("(a,[b)]");
+  std::span<const Tk> tokens_span{tokens};
+  TkMatchIndex index{tokens_span};
+  detail::TkMatchIndexScope index_scope{index};
+  EXPECT_TRUE(!FindParen(TkCursorT{tokens_span.cbegin(), tokens_span.cend()}).has_value());
+}
+
+}  // namespace cnd_unit_test::frontend::tk_match_index
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the compact token buffer and the fused sanitizing lexer against the Vec<Tk> lexer output.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "frontend/lexer.hpp"
+#include "frontend/TkCursor.hpp"
+// clang-format on
+
+namespace cnd_unit_test::frontend::token_buffer {
+using cnd::eTk;
+using cnd::Size;
+using cnd::StrView;
+using cnd::Tk;
+using cnd::TkCursor;
+using cnd::TokenBuffer;
+using cnd::TokenBufferSpan;
+using cnd::Vec;
+using cnd::trtools::Lexer;
+
+inline constexpr const char* kTokenBufferTestSource =
+    "`Fibonacci series\n"
+    "def @a:0; def @b:1;\n"
+    "/` block\n comment `/\n"
+    "while (a < 100){\n"
+    "\tstd::msg(\"fib\"); def @c:a+b; a = b; b = c;\n"
+    "}\n";
+
+inline bool IsSameTypeAndLiteral(const Tk& a, const Tk& b) {
+  return a.Type() == b.Type() && a.Literal().data() == b.Literal().data() && a.Literal().size() == b.Literal().size();
+}
+
+TEST(UtTokenBuffer, LexCompactMatchesLex) {
+  auto expected = Lexer::Lex(kTokenBufferTestSource);
+  auto actual = Lexer::LexCompact(kTokenBufferTestSource);
+  ASSERT_TRUE(expected.has_value());
+  ASSERT_TRUE(actual.has_value());
+  ASSERT_EQ(actual->Count(), expected->size());
+  for (Size i = 0; i < actual->Count(); i++) EXPECT_TRUE(IsSameTypeAndLiteral(actual->At(i), (*expected)[i]));
+}
+
+TEST(UtTokenBuffer, SanitizeMatchesVecSanitize) {
+  auto expected = Lexer::Lex(kTokenBufferTestSource);
+  auto actual = Lexer::LexCompact(kTokenBufferTestSource);
+  ASSERT_TRUE(expected.has_value());
+  ASSERT_TRUE(actual.has_value());
+  Vec<Tk> expected_sanitized = Lexer::Sanitize(*expected);
+  Vec<Tk> actual_sanitized = Lexer::Sanitize(*actual);
+  ASSERT_EQ(actual_sanitized.size(), expected_sanitized.size());
+  for (Size i = 0; i < actual_sanitized.size(); i++)
+    EXPECT_TRUE(IsSameTypeAndLiteral(actual_sanitized[i], expected_sanitized[i]));
+}
+
+TEST(UtTokenBuffer, LexSanitizedMatchesSanitize) {
+  auto expected = Lexer::Lex(kTokenBufferTestSource);
+  auto actual = Lexer::LexSanitized(kTokenBufferTestSource);
+  ASSERT_TRUE(expected.has_value());
+  ASSERT_TRUE(actual.has_value());
+  Vec<Tk> expected_sanitized = Lexer::Sanitize(*expected);
+  ASSERT_EQ(actual->size(), expected_sanitized.size());
+  for (Size i = 0; i < actual->size(); i++) EXPECT_TRUE(IsSameTypeAndLiteral((*actual)[i], expected_sanitized[i]));
+}
+
+TEST(UtTokenBuffer, LocationsFromOffsets) {
+  auto buf = Lexer::LexCompact(kTokenBufferTestSource);
+  ASSERT_TRUE(buf.has_value());
+  Vec<Tk> expanded = buf->Expand();
+  ASSERT_EQ(expanded.size(), buf->Count());
+  for (Size i = 0; i < buf->Count(); i++) {
+    const Tk tk = buf->At(i);
+    EXPECT_TRUE(tk.beg_line_ == expanded[i].beg_line_ && tk.beg_col_ == expanded[i].beg_col_);
+    EXPECT_TRUE(tk.end_line_ == expanded[i].end_line_ && tk.end_col_ == expanded[i].end_col_);
+  }
+  // "while" opens the 6th line, the block comment spans lines 3 and 4.
+  for (Size i = 0; i < buf->Count(); i++) {
+    if (buf->Literal(i) == "while") EXPECT_TRUE(buf->BegLine(i) == 5 && buf->BegCol(i) == 0);
+    if (buf->TypeIs(i, eTk::kBlockComment)) EXPECT_TRUE(buf->BegLine(i) == 2 && buf->EndLine(i) == 3);
+  }
+}
+
+TEST(UtTokenBuffer, LocationsWithCarriageReturns) {
+  // Lines are counted as the lexer counts them, every newline char ends one.
+  const char* src = "def @a:1;\r\ndef @b:22;\r\n  a = 333;";
+  auto buf = Lexer::LexCompact(src);
+  auto tokens = Lexer::Lex(src);
+  ASSERT_TRUE(buf.has_value());
+  ASSERT_TRUE(tokens.has_value());
+  ASSERT_EQ(buf->Count(), tokens->size());
+  for (Size i = 0; i < buf->Count(); i++) {
+    if (buf->TypeIs(i, eTk::kLitInt)) EXPECT_EQ(buf->BegLine(i), (*tokens)[i].beg_line_);
+    if (buf->Literal(i) == "22") EXPECT_TRUE(buf->BegLine(i) == 2 && buf->BegCol(i) == 7);
+    if (buf->Literal(i) == "333") EXPECT_TRUE(buf->BegLine(i) == 4 && buf->BegCol(i) == 6 && buf->EndCol(i) == 9);
+    if (buf->Literal(i) == "=") EXPECT_TRUE(buf->BegLine(i) == 4 && buf->BegCol(i) == 4);
+  }
+}
+
+TEST(UtTokenBuffer, CursorOverSpan) {
+  auto buf = Lexer::LexCompact(kTokenBufferTestSource);
+  ASSERT_TRUE(buf.has_value());
+  TokenBufferSpan<const Tk> span{*buf};
+  TkCursor<TokenBufferSpan> crsr{span.cbegin(), span.cend()};
+  Size visited = 0;
+  while (!crsr.AtEnd()) {
+    EXPECT_TRUE(IsSameTypeAndLiteral(crsr.Get(), buf->At(visited)));
+    crsr.Advance();
+    visited++;
+  }
+  ASSERT_EQ(visited, buf->Count());
+}
+
+TEST(UtTokenBuffer, IteratorsOutliveTheirSpan) {
+  auto buf = Lexer::LexCompact(kTokenBufferTestSource);
+  ASSERT_TRUE(buf.has_value());
+  TokenBufferSpan<const Tk>::const_iterator begin{};
+  TokenBufferSpan<const Tk>::const_iterator end{};
+  {
+    TokenBufferSpan<const Tk> span{*buf};
+    TokenBufferSpan<const Tk> copy = span;
+    begin = copy.cbegin();
+    end = copy.cend();
+  }
+  TkCursor<TokenBufferSpan> crsr{begin, end};
+  Size visited = 0;
+  while (!crsr.AtEnd()) {
+    EXPECT_TRUE(IsSameTypeAndLiteral(crsr.Get(), buf->At(visited)));
+    if (!crsr.Next().AtEnd()) EXPECT_TRUE(IsSameTypeAndLiteral(crsr.Peek(), buf->At(visited + 1)));
+    crsr.Advance();
+    visited++;
+  }
+  ASSERT_EQ(visited, buf->Count());
+}
+
+TEST(UtTokenBuffer, SmallerThanTkVec) {
+  auto tokens = Lexer::Lex(kTokenBufferTestSource);
+  ASSERT_TRUE(tokens.has_value());
+  TokenBuffer buf = TokenBuffer::FromTokens(kTokenBufferTestSource, *tokens);
+  EXPECT_TRUE(buf.ResidentBytes() < tokens->size() * sizeof(Tk));
+}
+
+}  // namespace cnd_unit_test::frontend::token_buffer
+
+/// @} // end of cnd_unit_test
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cnd_unit_test
+/// @brief Tests the x86-64 assembler, the ELF object writer and native code compiled from the low level IR.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cnd_unit_test
+/// @{
+#pragma once
+// clang-format off
+#include "minitest.hpp"
+#include "ProgramTestUtils.hpp"
+#include "lir/LirBuild.hpp"
+#include "lir/LirPasses.hpp"
+#include "x64/X64Codegen.hpp"
+#if defined(__linux__) && defined(__x86_64__)
+#include <sys/mman.h>
+#define CND_UT_X64_NATIVE 1
+#endif
+// clang-format on
+
+namespace cnd_unit_test::x64 {
+using cnd::Ast;
+using cnd::I32;
+using cnd::I64;
+using cnd::Size;
+using cnd::UI8;
+using cnd::Vec;
+using cnd::lir::LirBuilder;
+using cnd::lir::LirExecute;
+using cnd::lir::LirFnId;
+using cnd::lir::LirModule;
+using cnd::lir::LirPassManager;
+using cnd::x64::CompileX64Object;
+using cnd::x64::ElfObject;
+using cnd::x64::eX64Alu;
+using cnd::x64::eX64Cond;
+using cnd::x64::eX64Reg;
+using cnd::x64::X64Assembler;
+using cnd::x64::X64Label;
+using cnd::x64::X64Mem;
+using cnd_unit_test::test_util::kLirFunctions;
+using cnd_unit_test::test_util::ParsedProgram;
+using cnd_unit_test::test_util::ParseProgram;
+
+// Short circuiting operators, which the compile time virtual machine does not lower.
+static constexpr const char* kShortCircuitFunction =
+    "fn@clamp(const int @lo, const int @x)>const int:{ return (x < lo || x > lo + 9) && x != 0; };";
+
+inline cnd::ClRes<LirModule> BuildModule(const Ast& program, bool is_optimized) {
+  auto module = LirBuilder::Build(program);
+  if (!module || !is_optimized) return module;
+  if (auto run = LirPassManager::MakeDefault().Run(*module, 8, true); !run) return cnd::ClFail(run.Error());
+  return module;
+}
+
+#ifdef CND_UT_X64_NATIVE
+// Text of an object mapped executable, with its calls resolved. Every symbol called is defined by the object.
+class NativeText {
+ public:
+  explicit NativeText(const ElfObject& object) : object_(object), size_((object.text.size() + 4095) / 4096 * 4096) {
+    void* mem = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) return;
+    text_ = static_cast<UI8*>(mem);
+    std::memcpy(text_, object.text.data(), object.text.size());
+    for (const auto& reloc : object.relocations) {
+      const auto value = static_cast<I32>(static_cast<I64>(object.symbols[reloc.symbol].offset) + reloc.addend -
+                                          static_cast<I64>(reloc.offset));
+      std::memcpy(text_ + reloc.offset, &value, sizeof(value));
+    }
+    if (mprotect(mem, size_, PROT_READ | PROT_EXEC) != 0) Unmap();
+  }
+  NativeText(const NativeText&) = delete;
+  NativeText& operator=(const NativeText&) = delete;
+  ~NativeText() { Unmap(); }
+
+  // Functions take their arguments in the first registers of the calling convention, so extra arguments are ignored.
+  using Fn = int (*)(int, int);
+  Fn Find(cnd::StrView symbol) const {
+    const auto index = object_.FindSymbol(symbol);
+    if (!text_ || !index) return nullptr;
+    return reinterpret_cast<Fn>(text_ + object_.symbols[*index].offset);
+  }
+
+ private:
+  const ElfObject& object_;
+  Size size_;
+  UI8* text_{nullptr};
+
+  void Unmap() {
+    if (text_) munmap(text_, size_);
+    text_ = nullptr;
+  }
+};
+#endif
+
+TEST(UtX64, EncodesInstructions) {
+  X64Assembler as{};
+  as.MovRR(eX64Reg::kRax, eX64Reg::kRcx);                // mov eax, ecx
+  as.Push(eX64Reg::kR12);                                // push r12
+  as.Setcc(eX64Cond::kNe, eX64Reg::kRsi);                // setne sil, needs a rex prefix
+  as.MovRM(eX64Reg::kRax, X64Mem{eX64Reg::kRbp, -8});    // mov eax, [rbp - 8]
+  as.MovRM(eX64Reg::kRdx, X64Mem{eX64Reg::kRsp, 0});     // mov edx, [rsp]
+  as.AluRI(eX64Alu::kAdd, eX64Reg::kR9, 1);              // add r9d, 1
+  const Vec<UI8> expected{0x89, 0xC8, 0x41, 0x54, 0x40, 0x0F, 0x95, 0xC6, 0x8B,
+                          0x45, 0xF8, 0x8B, 0x14, 0x24, 0x41, 0x83, 0xC1, 0x01};
+  EXPECT_TRUE(as.Code() == expected);
+
+  // Forward jumps are near and patched when their label is bound, backward jumps in range are short.
+  X64Assembler jumps{};
+  const X64Label loop = jumps.NewLabel();
+  const X64Label done = jumps.NewLabel();
+  jumps.Bind(loop);
+  jumps.Jcc(eX64Cond::kE, done);
+  jumps.Jmp(loop);
+  EXPECT_TRUE(!jumps.IsComplete());
+  jumps.Bind(done);
+  jumps.Call(3);
+  EXPECT_TRUE(jumps.IsComplete());
+  const Vec<UI8> expected_jumps{0x0F, 0x84, 0x02, 0x00, 0x00, 0x00, 0xEB, 0xF8, 0xE8, 0x00, 0x00, 0x00, 0x00};
+  EXPECT_TRUE(jumps.Code() == expected_jumps);
+  ASSERT_EQ(jumps.Relocs().size(), 1);
+  EXPECT_EQ(jumps.Relocs().front().offset, 9);
+  EXPECT_EQ(jumps.Relocs().front().symbol, 3);
+  EXPECT_EQ(jumps.Relocs().front().addend, -4);
+}
+
+TEST(UtX64, WritesRelocatableObject) {
+  const cnd::Str src = cnd::Str{kLirFunctions} + "proc@root:{ main:{ return fib(10) - sq(3); }; };";
+  ParsedProgram program = ParseProgram(src.c_str());
+  auto object = CompileX64Object(program.ast, 0);
+  ASSERT_TRUE(object.has_value());
+
+  // Functions keep the names of the generated C code, the main of the process links as 'main'.
+  const auto fib = object->FindSymbol("__cnd__fn__fib");
+  ASSERT_TRUE(fib.has_value());
+  EXPECT_TRUE(object->FindSymbol("main").has_value());
+  EXPECT_TRUE(!object->FindSymbol("fib").has_value());
+  for (const auto& symbol : object->symbols) EXPECT_TRUE(symbol.offset % 16 == 0 && symbol.size > 0);
+
+  // Every call is relocated, 'fib' calls itself twice.
+  Size self_calls = 0;
+  for (const auto& reloc : object->relocations) {
+    EXPECT_EQ(reloc.type, ElfObject::kRelocPlt32);
+    const auto& caller = object->symbols[*fib];
+    self_calls += reloc.symbol == *fib && reloc.offset >= caller.offset && reloc.offset < caller.offset + caller.size;
+  }
+  EXPECT_EQ(self_calls, 2);
+
+  const Vec<UI8> bytes = object->Serialize();
+  ASSERT_TRUE(bytes.size() > 64);
+  const Vec<UI8> ident{0x7F, 'E', 'L', 'F', 2, 1, 1};
+  EXPECT_TRUE(std::equal(ident.begin(), ident.end(), bytes.begin()));
+  EXPECT_EQ(bytes[16], 1);     // ET_REL
+  EXPECT_EQ(bytes[18], 0x3E);  // EM_X86_64
+  EXPECT_EQ(bytes[60], 7);     // Null, text, relocations, symbols, strings, section names and the stack note.
+  const cnd::StrView name = "__cnd__fn__collatz";
+  EXPECT_TRUE(std::search(bytes.begin(), bytes.end(), name.begin(), name.end()) != bytes.end());
+}
+
+TEST(UtX64, MatchesInterpreter) {
+  const cnd::Str src = cnd::Str{kLirFunctions} + kShortCircuitFunction;
+  ParsedProgram program = ParseProgram(src.c_str());
+  const Vec<std::array<I32, 2>> args{{0, 0},   {1, 7},    {-7, 3},     {15, -4},          {27, 2},
+                                     {-1, 12}, {100, 99}, {12, 0},     {-2147483647 - 1, -1}};
+  for (bool is_optimized : {false, true}) {
+    auto module = BuildModule(program.ast, is_optimized);
+    ASSERT_TRUE(module.has_value());
+    auto object = CompileX64Object(*module);
+    ASSERT_TRUE(object.has_value());
+    EXPECT_EQ(object->symbols.size(), module->functions.size());
+#ifdef CND_UT_X64_NATIVE
+    NativeText text{*object};
+    for (LirFnId fn = 0; fn < module->functions.size(); fn++) {
+      const auto native = text.Find(cnd::x64::X64SymbolName(module->functions[fn]));
+      ASSERT_TRUE(native != nullptr);
+      for (const auto& [a, b] : args) {
+        if (module->functions[fn].name == "fib" && (a < 0 || a > 20)) continue;
+        const Vec<I64> lir_args{a, b};
+        auto expected = LirExecute(*module, fn, std::span{lir_args}.first(module->functions[fn].param_count));
+        ASSERT_TRUE(expected.has_value());
+        EXPECT_EQ(native(a, b), static_cast<I32>(*expected));
+      }
+    }
+#endif
+  }
+}
+
+TEST(UtX64, CompilesRuntimePrograms) {
+  // Programs of the runtime test corpus, returning from the main of their process.
+  struct RuntimeProgram {
+    const char* src;
+    I32 exit_code;
+  };
+  const RuntimeProgram programs[] = {
+      {"proc@root:{ main:{ return 0; }; };", 0},
+      {"proc@root:{ main:{ def @a:-9; return ~a; }; };", 8},
+      {"proc@root:{ main:{ def @a:144; def @b:12; return a / b + a % 7; }; };", 16},
+      {"proc@root:{ main:{ def @a:5; return (a << 3) | ((a >> 1) ^ 1); }; };", 43},
+      {"proc@root:{ main:{"
+       "  def @t:true;"
+       "  def @f:false;"
+       "  def @z:0;"
+       "  return (t && f) + (t || f) * 2 + (f && (1 / z) == 1) * 4 + (t || (1 / z) == 1) * 8;"
+       "}; };",
+       10},
+  };
+  for (const auto& [src, exit_code] : programs) {
+    ParsedProgram program = ParseProgram(src);
+    for (cnd::Int opt_level : {0, 1}) {
+      auto module = BuildModule(program.ast, opt_level > 0);
+      ASSERT_TRUE(module.has_value());
+      auto result = LirExecute(*module, 0, {});
+      ASSERT_TRUE(result.has_value());
+      EXPECT_EQ(*result, exit_code);
+
+      auto object = CompileX64Object(program.ast, opt_level);
+      ASSERT_TRUE(object.has_value());
+      ASSERT_TRUE(object->FindSymbol("main").has_value());
+#ifdef CND_UT_X64_NATIVE
+      NativeText text{*object};
+      const auto native_main = text.Find("main");
+      ASSERT_TRUE(native_main != nullptr);
+      EXPECT_EQ(native_main(0, 0), exit_code);
+#endif
+    }
+  }
+}
+
+}  // namespace cnd_unit_test::x64
+
+/// @} // end of cnd_unit_test
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// This program is free software : you can redistribute it and / or modify it
+// under the terms of the GNU Affero General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
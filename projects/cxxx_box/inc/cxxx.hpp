@@ -31,6 +31,8 @@
 
 // Data Structures
 #include "cxxx_tree.hpp"
+// cxx::FlatMap
+#include "cxxx_flat_map.hpp"
 
 namespace cxx {
 constexpr auto AdvanceIt(auto&& iter, size_t i) {
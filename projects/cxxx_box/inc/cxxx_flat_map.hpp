@@ -0,0 +1,560 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language Environment
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup cppmodule2_cppextended
+/// @brief Flat open addressing hash map.
+///
+/// FlatMap stores its elements in a single array of slots, next to an array
+/// of one byte control words. A control word is either empty, deleted, or the
+/// low 7 bits of the hash of the element in its slot. Lookups compare the
+/// control words of a group of 16 slots at once and only compare the keys
+/// of slots whose 7 bits match, so a lookup rarely touches more than one
+/// cache line of keys.
+///
+/// The interface follows std::unordered_map. Unlike std::unordered_map,
+/// inserting may move every element: references and iterators are
+/// invalidated by any insertion which grows the table. Lookups accept any
+/// key type when both the hash and the key equality are transparent.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup cppmodule2_cppextended
+/// @{
+#ifndef HEADER_GUARD_CALE_EXTENDED_CPP_STANDARD_FLAT_MAP_H
+#define HEADER_GUARD_CALE_EXTENDED_CPP_STANDARD_FLAT_MAP_H
+// Cxx C++ Standard Lib
+#include "cxxx_import_std.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// clang-format off
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define CXXX_FLAT_MAP_SSE2 1
+  #include <emmintrin.h>
+#else
+  #define CXXX_FLAT_MAP_SSE2 0
+#endif
+// clang-format on
+
+namespace cxx {
+
+/// Default hash of FlatMap. Strings are hashed as string views, so maps keyed
+/// by std::string are searchable by any string-like key.
+template <class T>
+struct FlatHash : std::hash<T> {};
+
+template <>
+struct FlatHash<std::string> {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view str) const noexcept {
+    return std::hash<std::string_view>{}(str);
+  }
+};
+
+namespace flat_map_detail {
+using CtrlT = std::int8_t;
+inline constexpr CtrlT kEmpty = -128;
+inline constexpr CtrlT kDeleted = -2;
+inline constexpr CtrlT kSentinel = -1;  // Ends iteration, past the last slot.
+inline constexpr std::size_t kGroupWidth = 16;
+
+/// Spreads the entropy of a hash over all of its bits. Standard library
+/// hashes of integers are often the identity.
+constexpr std::size_t Mix(std::size_t hash) noexcept {
+  const std::uint64_t mixed =
+      static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<std::size_t>(mixed ^ (mixed >> 32));
+}
+
+/// The control words of the 16 slots starting at 'ctrl'. Each match returns
+/// a bitmask with bit i set if slot i satisfies the condition.
+class Group {
+ public:
+  explicit Group(const CtrlT* ctrl) noexcept {
+#if CXXX_FLAT_MAP_SSE2
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    std::memcpy(ctrl_, ctrl, kGroupWidth);
+#endif
+  }
+
+  std::uint32_t Match(CtrlT h2) const noexcept {
+#if CXXX_FLAT_MAP_SSE2
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; i++)
+      mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+    return mask;
+#endif
+  }
+
+  std::uint32_t MatchEmpty() const noexcept { return Match(kEmpty); }
+
+  // Empty and deleted words are the only ones below the sentinel.
+  std::uint32_t MatchEmptyOrDeleted() const noexcept {
+#if CXXX_FLAT_MAP_SSE2
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_)));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; i++)
+      mask |= static_cast<std::uint32_t>(ctrl_[i] < kSentinel) << i;
+    return mask;
+#endif
+  }
+
+ private:
+#if CXXX_FLAT_MAP_SSE2
+  __m128i ctrl_;
+#else
+  CtrlT ctrl_[kGroupWidth];
+#endif
+};
+}  // namespace flat_map_detail
+
+/// @brief Swiss table style hash map with open addressing.
+/// @tparam Key Key type.
+/// @tparam T Mapped type.
+/// @tparam Hash Hash of keys. Heterogeneous lookup requires 'is_transparent'.
+/// @tparam KeyEqual Key equality. Heterogeneous lookup requires
+/// 'is_transparent'.
+///
+/// The capacity is always a power of two minus one, the last control word
+/// being the sentinel. The first 15 control words are cloned after the
+/// sentinel, so a group may be loaded at any slot without wrapping.
+template <class Key, class T, class Hash = FlatHash<Key>,
+          class KeyEqual = std::equal_to<>>
+class FlatMap {
+  using CtrlT = flat_map_detail::CtrlT;
+  using Group = flat_map_detail::Group;
+  static constexpr std::size_t kGroupWidth = flat_map_detail::kGroupWidth;
+  static constexpr std::size_t kClonedBytes = kGroupWidth - 1;
+  static constexpr std::size_t kMinCapacity = kGroupWidth - 1;
+
+  template <class K>
+  static constexpr bool kIsTransparent =
+      requires {
+        typename Hash::is_transparent;
+        typename KeyEqual::is_transparent;
+      } || std::same_as<K, Key>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+ private:
+  // Elements are moved through their non-const view when the table grows.
+  union Slot {
+    Slot() noexcept {}
+    ~Slot() noexcept {}
+    value_type value;
+    std::pair<Key, T> mutable_value;
+  };
+
+  template <bool kConst>
+  class Iterator {
+    friend class FlatMap;
+    template <bool>
+    friend class Iterator;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = FlatMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<kConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<kConst, const value_type*, value_type*>;
+
+    Iterator() noexcept = default;
+    // An iterator converts to a const iterator.
+    template <bool kOtherConst>
+      requires(kConst && !kOtherConst)
+    Iterator(const Iterator<kOtherConst>& other) noexcept
+        : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+    reference operator*() const noexcept { return slot_->value; }
+    pointer operator->() const noexcept { return &slot_->value; }
+
+    Iterator& operator++() noexcept {
+      ctrl_++;
+      slot_++;
+      SkipFree();
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator prev = *this;
+      ++*this;
+      return prev;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+      return a.ctrl_ == b.ctrl_;
+    }
+
+   private:
+    const CtrlT* ctrl_{nullptr};
+    Slot* slot_{nullptr};
+
+    Iterator(const CtrlT* ctrl, Slot* slot) noexcept
+        : ctrl_(ctrl), slot_(slot) {}
+
+    void SkipFree() noexcept {
+      while (*ctrl_ < flat_map_detail::kSentinel) {
+        ctrl_++;
+        slot_++;
+      }
+    }
+  };
+
+ public:
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatMap() noexcept = default;
+
+  FlatMap(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (const value_type& elem : init) try_emplace(elem.first, elem.second);
+  }
+
+  FlatMap(const FlatMap& other) {
+    reserve(other.size_);
+    for (const value_type& elem : other) try_emplace(elem.first, elem.second);
+  }
+
+  FlatMap(FlatMap&& other) noexcept { swap(other); }
+
+  FlatMap& operator=(const FlatMap& other) {
+    if (this != &other) {
+      FlatMap copy{other};
+      swap(copy);
+    }
+    return *this;
+  }
+
+  FlatMap& operator=(FlatMap&& other) noexcept {
+    if (this != &other) {
+      FlatMap moved{std::move(other)};
+      swap(moved);
+    }
+    return *this;
+  }
+
+  ~FlatMap() { Deallocate(); }
+
+  void swap(FlatMap& other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+  iterator begin() noexcept {
+    if (size_ == 0) return end();
+    iterator it{ctrl_, slots_};
+    it.SkipFree();
+    return it;
+  }
+  const_iterator begin() const noexcept {
+    return const_cast<FlatMap*>(this)->begin();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept { return {ctrl_ + capacity_, slots_ + capacity_}; }
+  const_iterator end() const noexcept {
+    return const_cast<FlatMap*>(this)->end();
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  /// Destroys every element. Keeps the allocated slots.
+  void clear() noexcept {
+    if (capacity_ == 0) return;
+    DestroyElements();
+    ResetCtrl();
+    size_ = 0;
+    growth_left_ = MaxSizeOf(capacity_);
+  }
+
+  /// Grows the table to hold at least 'count' elements without rehashing.
+  void reserve(size_type count) {
+    if (count <= size_ + growth_left_) return;
+    size_type capacity = kMinCapacity;
+    while (MaxSizeOf(capacity) < count) capacity = capacity * 2 + 1;
+    Rehash(capacity);
+  }
+
+  template <class K>
+    requires kIsTransparent<K>
+  iterator find(const K& key) {
+    const size_type index = FindIndex(key);
+    return index == capacity_ ? end() : iterator{ctrl_ + index, slots_ + index};
+  }
+
+  template <class K>
+    requires kIsTransparent<K>
+  const_iterator find(const K& key) const {
+    return const_cast<FlatMap*>(this)->find(key);
+  }
+
+  iterator find(const Key& key) { return find<Key>(key); }
+  const_iterator find(const Key& key) const { return find<Key>(key); }
+
+  template <class K>
+    requires kIsTransparent<K>
+  bool contains(const K& key) const {
+    return FindIndex(key) != capacity_;
+  }
+  bool contains(const Key& key) const { return contains<Key>(key); }
+
+  template <class K>
+    requires kIsTransparent<K>
+  size_type count(const K& key) const {
+    return contains(key) ? 1 : 0;
+  }
+  size_type count(const Key& key) const { return count<Key>(key); }
+
+  T& at(const Key& key) {
+    const size_type index = FindIndex(key);
+    if (index == capacity_) throw std::out_of_range("FlatMap::at");
+    return slots_[index].value.second;
+  }
+  const T& at(const Key& key) const { return const_cast<FlatMap*>(this)->at(key); }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+  T& operator[](Key&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  template <class... ArgTs>
+  std::pair<iterator, bool> try_emplace(const Key& key, ArgTs&&... args) {
+    return EmplaceKey(key, std::forward<ArgTs>(args)...);
+  }
+
+  template <class... ArgTs>
+  std::pair<iterator, bool> try_emplace(Key&& key, ArgTs&&... args) {
+    return EmplaceKey(std::move(key), std::forward<ArgTs>(args)...);
+  }
+
+  template <class K, class... ArgTs>
+  std::pair<iterator, bool> emplace(K&& key, ArgTs&&... args) {
+    return EmplaceKey(std::forward<K>(key), std::forward<ArgTs>(args)...);
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return EmplaceKey(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return EmplaceKey(value.first, std::move(value.second));
+  }
+
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    auto result = EmplaceKey(key, std::forward<M>(obj));
+    if (!result.second) result.first->second = std::forward<M>(obj);
+    return result;
+  }
+
+  template <class K>
+    requires kIsTransparent<K>
+  size_type erase(const K& key) {
+    const size_type index = FindIndex(key);
+    if (index == capacity_) return 0;
+    EraseAt(index);
+    return 1;
+  }
+  size_type erase(const Key& key) { return erase<Key>(key); }
+
+  /// Erases the element at 'pos', returns an iterator to the next element.
+  iterator erase(const_iterator pos) {
+    const size_type index = static_cast<size_type>(pos.ctrl_ - ctrl_);
+    EraseAt(index);
+    iterator next{ctrl_ + index, slots_ + index};
+    next.SkipFree();
+    return next;
+  }
+  iterator erase(iterator pos) { return erase(const_iterator{pos}); }
+
+ private:
+  CtrlT* ctrl_{nullptr};
+  Slot* slots_{nullptr};
+  size_type capacity_{0};
+  size_type size_{0};
+  size_type growth_left_{0};  // Empty slots left to fill before growing.
+
+  // Tables are at most 7/8 full, so probing always reaches an empty slot.
+  static constexpr size_type MaxSizeOf(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+  static size_type HashOf(const auto& key) noexcept {
+    return flat_map_detail::Mix(Hash{}(key));
+  }
+  static size_type H1(size_type hash) noexcept { return hash >> 7; }
+  static CtrlT H2(size_type hash) noexcept {
+    return static_cast<CtrlT>(hash & 0x7F);
+  }
+
+  // Index of the slot holding 'key', or 'capacity_' if there is none.
+  template <class K>
+  size_type FindIndex(const K& key) const {
+    if (size_ == 0) return capacity_;
+    const size_type hash = HashOf(key);
+    size_type offset = H1(hash) & capacity_;
+    for (size_type probe = kGroupWidth;; probe += kGroupWidth) {
+      const Group group{ctrl_ + offset};
+      for (std::uint32_t match = group.Match(H2(hash)); match != 0;
+           match &= match - 1) {
+        const size_type index =
+            (offset + std::countr_zero(match)) & capacity_;
+        if (KeyEqual{}(slots_[index].value.first, key)) return index;
+      }
+      if (group.MatchEmpty() != 0) return capacity_;
+      offset = (offset + probe) & capacity_;
+    }
+  }
+
+  // First empty or deleted slot on the probe sequence of 'hash'.
+  size_type FindFree(size_type hash) const noexcept {
+    size_type offset = H1(hash) & capacity_;
+    for (size_type probe = kGroupWidth;; probe += kGroupWidth) {
+      const std::uint32_t free = Group{ctrl_ + offset}.MatchEmptyOrDeleted();
+      if (free != 0) return (offset + std::countr_zero(free)) & capacity_;
+      offset = (offset + probe) & capacity_;
+    }
+  }
+
+  // Writes a control word and its clone past the sentinel.
+  void SetCtrl(size_type index, CtrlT ctrl) noexcept {
+    ctrl_[index] = ctrl;
+    ctrl_[((index - kClonedBytes) & capacity_) + kClonedBytes] = ctrl;
+  }
+
+  template <class K, class... ArgTs>
+  std::pair<iterator, bool> EmplaceKey(K&& key, ArgTs&&... args) {
+    size_type index = FindIndex(key);
+    if (index != capacity_)
+      return {iterator{ctrl_ + index, slots_ + index}, false};
+
+    if (growth_left_ == 0) Grow();
+    const size_type hash = HashOf(key);
+    index = FindFree(hash);
+    if (ctrl_[index] == flat_map_detail::kEmpty) growth_left_--;
+    ::new (static_cast<void*>(&slots_[index].mutable_value)) std::pair<Key, T>(
+        std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+        std::forward_as_tuple(std::forward<ArgTs>(args)...));
+    SetCtrl(index, H2(hash));
+    size_++;
+    return {iterator{ctrl_ + index, slots_ + index}, true};
+  }
+
+  void EraseAt(size_type index) noexcept {
+    std::destroy_at(&slots_[index].mutable_value);
+    SetCtrl(index, flat_map_detail::kDeleted);
+    size_--;
+  }
+
+  // Doubles the table, or only drops deleted slots if they take up most of it.
+  void Grow() {
+    if (capacity_ == 0)
+      Rehash(kMinCapacity);
+    else if (size_ <= MaxSizeOf(capacity_) / 2)
+      Rehash(capacity_);
+    else
+      Rehash(capacity_ * 2 + 1);
+  }
+
+  void Rehash(size_type capacity) {
+    CtrlT* old_ctrl = ctrl_;
+    Slot* old_slots = slots_;
+    const size_type old_capacity = capacity_;
+
+    ctrl_ = new CtrlT[capacity + 1 + kClonedBytes];
+    slots_ = std::allocator<Slot>{}.allocate(capacity);
+    capacity_ = capacity;
+    ResetCtrl();
+    growth_left_ = MaxSizeOf(capacity) - size_;
+
+    for (size_type i = 0; i < old_capacity; i++) {
+      if (old_ctrl[i] < 0) continue;
+      std::pair<Key, T>& elem = old_slots[i].mutable_value;
+      const size_type hash = HashOf(elem.first);
+      const size_type index = FindFree(hash);
+      ::new (static_cast<void*>(&slots_[index].mutable_value))
+          std::pair<Key, T>(std::move(elem));
+      std::destroy_at(&elem);
+      SetCtrl(index, H2(hash));
+    }
+    if (old_ctrl != nullptr) {
+      delete[] old_ctrl;
+      std::allocator<Slot>{}.deallocate(old_slots, old_capacity);
+    }
+  }
+
+  void ResetCtrl() noexcept {
+    std::memset(ctrl_, flat_map_detail::kEmpty, capacity_ + 1 + kClonedBytes);
+    ctrl_[capacity_] = flat_map_detail::kSentinel;
+  }
+
+  void DestroyElements() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<std::pair<Key, T>>) {
+      for (size_type i = 0; i < capacity_; i++)
+        if (ctrl_[i] >= 0) std::destroy_at(&slots_[i].mutable_value);
+    }
+  }
+
+  void Deallocate() noexcept {
+    if (capacity_ == 0) return;
+    DestroyElements();
+    delete[] ctrl_;
+    std::allocator<Slot>{}.deallocate(slots_, capacity_);
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+};
+
+}  // namespace cxx
+
+#endif HEADER_GUARD_CALE_EXTENDED_CPP_STANDARD_FLAT_MAP_H
+/// @} // end of cppmodule2_cppextended
+///////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language Environment
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// Licensed under the GNU Affero General Public License, Version 3.
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+///////////////////////////////////////////////////////////////////////////////
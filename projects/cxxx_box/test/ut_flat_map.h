@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+// Licensed under the GNU Affero General Public License, Version 3.
+///////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language Environment
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @ingroup unittest0_cppextended
+/// @brief FlatMap Unit Tests
+///////////////////////////////////////////////////////////////////////////////
+
+/// @addtogroup unittest0_cppextended
+/// @{
+#ifndef HEADER_GUARD_CAOCO_UNIT_TESTS_UT0_FLAT_MAP_H
+#define HEADER_GUARD_CAOCO_UNIT_TESTS_UT0_FLAT_MAP_H
+// Includes:
+#include "cxxx.hpp"
+#include "minitest.hpp"
+
+TEST(CxxFlatMap, InsertFindErase) {
+  cxx::FlatMap<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.find(1) == map.end());
+
+  // Enough elements to grow the table several times.
+  for (int i = 0; i < 1000; i++) EXPECT_TRUE(map.try_emplace(i, std::to_string(i)).second);
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_FALSE(map.try_emplace(7, "seven").second);
+  EXPECT_EQ(map.at(7), "7");
+  map[7] = "seven";
+  EXPECT_EQ(map.find(7)->second, "seven");
+
+  // Erased keys are not found, and their slots are reused.
+  for (int i = 0; i < 1000; i += 2) EXPECT_EQ(map.erase(i), 1);
+  EXPECT_EQ(map.erase(0), 0);
+  EXPECT_EQ(map.size(), 500);
+  EXPECT_FALSE(map.contains(10));
+  EXPECT_TRUE(map.contains(11));
+  const auto capacity = map.capacity();
+  for (int i = 0; i < 1000; i += 2) map[i] = "again";
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(CxxFlatMap, IterationVisitsEachElementOnce) {
+  cxx::FlatMap<int, int> map;
+  for (int i = 0; i < 300; i++) map[i] = i * 2;
+  int count = 0;
+  int sum = 0;
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(value, key * 2);
+    count++;
+    sum += key;
+  }
+  EXPECT_EQ(count, 300);
+  EXPECT_EQ(sum, 299 * 300 / 2);
+
+  // Erasing through iterators continues at the next element.
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 3 == 0)
+      it = map.erase(it);
+    else
+      ++it;
+  }
+  EXPECT_EQ(map.size(), 200);
+  EXPECT_EQ(std::distance(map.begin(), map.end()), 200);
+}
+
+TEST(CxxFlatMap, HeterogeneousStringLookup) {
+  cxx::FlatMap<std::string, int> map{{"alpha", 1}, {"beta", 2}};
+  const std::string_view key = "beta";
+  EXPECT_TRUE(map.find(key) != map.end());
+  EXPECT_EQ(map.find(key)->second, 2);
+  EXPECT_TRUE(map.contains("alpha"));
+  EXPECT_EQ(map.erase(std::string_view{"alpha"}), 1);
+  EXPECT_FALSE(map.contains("alpha"));
+}
+
+TEST(CxxFlatMap, CopyAndMove) {
+  cxx::FlatMap<std::string, std::string> map;
+  for (int i = 0; i < 100; i++) map[std::to_string(i)] = std::string(32, 'a' + i % 26);
+  cxx::FlatMap<std::string, std::string> copy = map;
+  copy["0"] = "changed";
+  EXPECT_EQ(map["0"], std::string(32, 'a'));
+  cxx::FlatMap<std::string, std::string> moved = std::move(copy);
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_EQ(moved["0"], "changed");
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+}
+
+#endif HEADER_GUARD_CAOCO_UNIT_TESTS_UT0_FLAT_MAP_H
+/// @} // end of unittest0_cppextended
+///////////////////////////////////////////////////////////////////////////////
+// @project: C& Programming Language Environment
+// @author(s): Anton Yashchenko
+// @website: https://www.acpp.dev
+///////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 Anton Yashchenko
+//
+// Licensed under the GNU Affero General Public License, Version 3.
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+///////////////////////////////////////////////////////////////////////////////
\ No newline at end of file